@@ -0,0 +1,221 @@
+//go:build ts3stub
+
+// Package bench measures the overhead the bindings add to client lib calls and callbacks.
+//
+// It runs against the stub client lib of internal/ts3stub, whose functions return right
+// away, so the numbers are the cost of the Go side: cgo transitions, string and array
+// marshalling, result conversion and callback re-entry.
+//
+//	go test -tags ts3stub -bench . -benchmem ./bench
+package bench
+
+import (
+	"context"
+	"fmt"
+	"os"
+	"sync/atomic"
+	"testing"
+
+	"github.com/Piekario/ts3sdk"
+	"github.com/Piekario/ts3sdk/internal/ts3stub"
+)
+
+var conn ts3sdk.ConnectionHandlerID
+
+func TestMain(m *testing.M) {
+	if err := ts3sdk.Initialize("", "", ts3sdk.LogTypeNone); err != nil {
+		fmt.Fprintln(os.Stderr, "initializing the stub client lib:", err)
+		os.Exit(1)
+	}
+	var err error
+	if conn, err = ts3sdk.CreateServerConnectionHandler(); err != nil {
+		fmt.Fprintln(os.Stderr, "creating a connection handler:", err)
+		os.Exit(1)
+	}
+	code := m.Run()
+	ts3sdk.Shutdown()
+	os.Exit(code)
+}
+
+// One binding per way of passing arguments and results
+func BenchmarkBinding(b *testing.B) {
+	ctx := context.Background()
+	clientIDs := []ts3sdk.ClientID{1, 2, 3, 4, 5, 6, 7, 8}
+
+	bindings := []struct {
+		name string
+		call func() error
+	}{
+		{"NoArguments/SetKeyPressedDuringChunk", ts3sdk.SetKeyPressedDuringChunk},
+		{"Scalars/SetClientVolumeModifier", func() error { return ts3sdk.SetClientVolumeModifier(conn, 1, 0.5) }},
+		{"String/PlayWaveFile", func() error { return ts3sdk.PlayWaveFile(conn, "sounds/welcome.wav") }},
+		{"FiveStrings/StartConnection", func() error {
+			return ts3sdk.StartConnection(conn, "identity", "localhost", 9987, "GoClient", "", "secret")
+		}},
+		{"ClientIDArray/RequestMuteClients", func() error { return ts3sdk.RequestMuteClients(conn, clientIDs) }},
+		{"ClientIDArray/RequestClientMove", func() error { return ts3sdk.RequestClientMove(conn, 1, 2, "") }},
+		{"ScalarResult/GetClientID", func() error { _, err := ts3sdk.GetClientID(conn); return err }},
+		{"ScalarResult/GetConnectionVariableAsDouble", func() error {
+			_, err := ts3sdk.GetConnectionVariableAsDouble(conn, 1, ts3sdk.ConnectionPing)
+			return err
+		}},
+		{"StringResult/GetClientLibVersion", func() error { _, err := ts3sdk.GetClientLibVersion(); return err }},
+		{"StringResult/GetClientVariableAsString", func() error {
+			_, err := ts3sdk.GetClientVariableAsString(conn, 1, ts3sdk.ClientNickname)
+			return err
+		}},
+		{"ArrayResult/GetClientList", func() error { _, err := ts3sdk.GetClientList(conn); return err }},
+		{"ArrayResult/GetChannelList", func() error { _, err := ts3sdk.GetChannelList(conn); return err }},
+		{"Snapshot/GetClientSnapshot", func() error { _, err := ts3sdk.GetClientSnapshot(conn); return err }},
+		{"Async/RequestSendChannelTextMsgAsync", func() error {
+			r, err := ts3sdk.RequestSendChannelTextMsgAsync(ctx, conn, "hello", 1)
+			if err != nil {
+				return err
+			}
+			return r.Wait(ctx)
+		}},
+		{"Async/RequestClientKickFromChannelAsync", func() error {
+			r, err := ts3sdk.RequestClientKickFromChannelAsync(ctx, conn, clientIDs, "bye")
+			if err != nil {
+				return err
+			}
+			return r.Wait(ctx)
+		}},
+	}
+
+	for _, binding := range bindings {
+		b.Run(binding.name, func(b *testing.B) {
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				if err := binding.call(); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+	}
+}
+
+// The properties GetClientSnapshot collects, for 100, 1,000 and 10,000 visible clients: in one
+// call, in one call reusing the snapshot, and queried per client
+func BenchmarkClientSnapshot(b *testing.B) {
+	for _, clients := range []int{100, 1000, 10000} {
+		ts3stub.SetClients(uint64(conn), clients, 100)
+		if s, err := ts3sdk.GetClientSnapshot(conn); err != nil || s.Len() != clients || s.Nicknames[clients-1] == "" {
+			b.Fatalf("snapshot of %d clients: %v", clients, err)
+		}
+
+		b.Run(fmt.Sprintf("Snapshot/%d", clients), func(b *testing.B) {
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				if _, err := ts3sdk.GetClientSnapshot(conn); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+		b.Run(fmt.Sprintf("Update/%d", clients), func(b *testing.B) {
+			s := &ts3sdk.ClientSnapshot{}
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				if err := s.Update(conn); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+		b.Run(fmt.Sprintf("PerClient/%d", clients), func(b *testing.B) {
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				if err := queryClients(); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+	}
+	ts3stub.SetClients(0, 0, 0)
+}
+
+// queryClients fetches what a ClientSnapshot holds with one binding call per client and property
+func queryClients() error {
+	clientIDs, err := ts3sdk.GetClientList(conn)
+	if err != nil {
+		return err
+	}
+	for _, clientID := range clientIDs {
+		if _, err := ts3sdk.GetChannelOfClient(conn, clientID); err != nil {
+			return err
+		}
+		for _, flag := range []ts3sdk.ClientProperties{ts3sdk.ClientFlagTalking, ts3sdk.ClientInputMuted, ts3sdk.ClientOutputMuted} {
+			if _, err := ts3sdk.GetClientVariableAsInt(conn, clientID, flag); err != nil {
+				return err
+			}
+		}
+		if _, err := ts3sdk.GetClientVariableAsString(conn, clientID, ts3sdk.ClientNickname); err != nil {
+			return err
+		}
+	}
+	return nil
+}
+
+// Codes the client lib doesn't use, each one is converted once
+var unusedCode = ts3sdk.Error(0x100000)
+
+// Converting error codes to messages, fetched from the client lib once per code
+func BenchmarkError(b *testing.B) {
+	b.Run("Cached", func(b *testing.B) {
+		b.ReportAllocs()
+		err := ts3sdk.ErrorConnectionLost
+		_ = err.Error()
+		for i := 0; i < b.N; i++ {
+			_ = err.Error()
+		}
+	})
+	b.Run("FirstUse", func(b *testing.B) {
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			unusedCode++
+			_ = unusedCode.Error()
+		}
+	})
+}
+
+// Events raised on a C thread and delivered to Go callbacks directly, per event
+func BenchmarkCallback(b *testing.B) {
+	var delivered atomic.Int64
+	cb := ts3sdk.Callbacks{
+		ClientMove: func(ts3sdk.ConnectionHandlerID, ts3sdk.ClientID, ts3sdk.ChannelID, ts3sdk.ChannelID, int, string) {
+			delivered.Add(1)
+		},
+		UpdateClient: func(ts3sdk.ConnectionHandlerID, ts3sdk.ClientID, ts3sdk.ClientID, string, string) {
+			delivered.Add(1)
+		},
+		TalkStatusChange: func(ts3sdk.ConnectionHandlerID, int, int, ts3sdk.ClientID) {
+			delivered.Add(1)
+		},
+	}
+	cb.ClientKickFromServer = func(ts3sdk.ConnectionHandlerID, ts3sdk.ClientID, ts3sdk.ChannelID, ts3sdk.ChannelID, int, ts3sdk.ClientID, string, string, string) {
+		delivered.Add(1)
+	}
+	if err := ts3sdk.SetClientCallbacks(cb); err != nil {
+		b.Fatal(err)
+	}
+	defer ts3sdk.SetClientCallbacks(ts3sdk.Callbacks{})
+
+	events := []struct {
+		name  string
+		event ts3stub.Event
+	}{
+		{"ClientMove", ts3stub.ClientMove},
+		{"UpdateClient", ts3stub.UpdateClient},
+		{"TalkStatusChange", ts3stub.TalkStatusChange},
+		{"ClientKickFromServer", ts3stub.ClientKickFromServer},
+	}
+	for _, e := range events {
+		b.Run(e.name, func(b *testing.B) {
+			b.ReportAllocs()
+			delivered.Store(0)
+			ts3stub.Fire(e.event, uint64(conn), b.N)
+			if n := delivered.Load(); n != int64(b.N) {
+				b.Fatalf("%d of %d events delivered", n, b.N)
+			}
+		})
+	}
+}
@@ -3,13 +3,17 @@ package ts3sdk
 
 /*
 #include <stdlib.h>
+#include <string.h>
 #include <teamspeak/clientlib.h>
 #include <teamspeak/public_definitions.h>
 #include <teamspeak/public_errors.h>
+#include "eventqueue.h"
 */
 import "C"
 import (
 	"sync"
+	"sync/atomic"
+	"unsafe"
 )
 
 // Callback types for TeamSpeak 3 events
@@ -55,6 +59,9 @@ type (
 
 	// TextMessageCallback is called when a text message is received
 	TextMessageCallback func(serverConnectionHandlerID ConnectionHandlerID, targetMode int, toID uint64, fromID ClientID, fromName string, fromUniqueIdentifier string, message string)
+
+	// ServerErrorCallback is called when the server answers a request, returnCode is the one passed with the request
+	ServerErrorCallback func(serverConnectionHandlerID ConnectionHandlerID, errorMessage string, errorNumber Error, returnCode string, extraMessage string)
 )
 
 // Callbacks holds all the callback functions
@@ -73,56 +80,53 @@ type Callbacks struct {
 	ClientMoveTimeout      ClientMoveTimeoutCallback
 	TalkStatusChange       TalkStatusChangeCallback
 	TextMessage            TextMessageCallback
+	ServerError            ServerErrorCallback
+
+	// Callbacks for the remaining events, generated from clientlib.h
+	ExtraCallbacks
 }
 
-// Global callbacks instance and mutex to protect it
+// Global callbacks snapshot. Event handlers load it without locking, registration swaps it atomically.
 var (
-	callbacks      Callbacks
-	callbacksMutex sync.RWMutex
+	callbacks      atomic.Pointer[Callbacks]
+	noCallbacks    Callbacks
+	callbacksMutex sync.Mutex // serializes registration
 )
 
-// SetClientCallbacks sets the callback functions for TeamSpeak 3 events
+// loadCallbacks returns the current callbacks snapshot, never nil
+func loadCallbacks() *Callbacks {
+	if cb := callbacks.Load(); cb != nil {
+		return cb
+	}
+	return &noCallbacks
+}
+
+// SetClientCallbacks sets the callback functions for TeamSpeak 3 events. They are called
+// directly on the client lib threads. Callbacks set before are replaced, batched delivery is stopped.
 func SetClientCallbacks(cb Callbacks) error {
 	callbacksMutex.Lock()
 	defer callbacksMutex.Unlock()
 
-	callbacks = cb
-
-	// Create C callback struct
-	var uiCallbacks C.struct_ClientUIFunctions
-
-	// Set C callbacks to our exported Go functions
-	uiCallbacks.onConnectStatusChangeEvent = C.onConnectStatusChangeEvent
-	uiCallbacks.onServerProtocolVersionEvent = C.onServerProtocolVersionEvent
-	uiCallbacks.onNewChannelEvent = C.onNewChannelEvent
-	uiCallbacks.onNewChannelCreatedEvent = C.onNewChannelCreatedEvent
-	uiCallbacks.onDelChannelEvent = C.onDelChannelEvent
-	uiCallbacks.onChannelMoveEvent = C.onChannelMoveEvent
-	uiCallbacks.onUpdateChannelEvent = C.onUpdateChannelEvent
-	uiCallbacks.onUpdateChannelEditedEvent = C.onUpdateChannelEditedEvent
-	uiCallbacks.onUpdateClientEvent = C.onUpdateClientEvent
-	uiCallbacks.onClientMoveEvent = C.onClientMoveEvent
-	uiCallbacks.onClientMoveSubscriptionEvent = C.onClientMoveSubscriptionEvent
-	uiCallbacks.onClientMoveTimeoutEvent = C.onClientMoveTimeoutEvent
-	uiCallbacks.onTalkStatusChangeEvent = C.onTalkStatusChangeEvent
-	uiCallbacks.onTextMessageEvent = C.onTextMessageEvent
-
-	// Register callbacks with TeamSpeak 3 SDK
-	err := C.ts3client_registerClientUIFunctions(&uiCallbacks, nil)
-	if err != C.ERROR_ok {
-		return Error(err)
-	}
-
+	stopEventQueue()
+	callbacks.Store(&cb)
 	return nil
 }
 
+// fillCallbacks fills the callback table Initialize passes to the client lib. The events
+// the event queue handles go through its C functions, which call the exported functions
+// below unless batched delivery is on. The generated callbacks get queueing functions of their own.
+func fillCallbacks(funcs *C.struct_ClientUIFunctions) {
+	C.ts3sdk_eventQueueFillCallbacks(funcs)
+	fillExtraCallbacks(funcs)
+}
+
 //export onConnectStatusChangeEvent
 func onConnectStatusChangeEvent(serverConnectionHandlerID C.uint64, newStatus C.int, errorNumber C.uint) {
-	callbacksMutex.RLock()
-	defer callbacksMutex.RUnlock()
-
-	if callbacks.ConnectStatusChange != nil {
-		callbacks.ConnectStatusChange(
+	if ConnectStatus(newStatus) == StatusDisconnected {
+		failPendingRequests(ConnectionHandlerID(serverConnectionHandlerID), ErrorConnectionLost)
+	}
+	if cb := loadCallbacks(); cb.ConnectStatusChange != nil {
+		cb.ConnectStatusChange(
 			ConnectionHandlerID(serverConnectionHandlerID),
 			ConnectStatus(newStatus),
 			Error(errorNumber),
@@ -132,11 +136,8 @@ func onConnectStatusChangeEvent(serverConnectionHandlerID C.uint64, newStatus C.
 
 //export onServerProtocolVersionEvent
 func onServerProtocolVersionEvent(serverConnectionHandlerID C.uint64, protocolVersion C.int) {
-	callbacksMutex.RLock()
-	defer callbacksMutex.RUnlock()
-
-	if callbacks.ServerProtocolVersion != nil {
-		callbacks.ServerProtocolVersion(
+	if cb := loadCallbacks(); cb.ServerProtocolVersion != nil {
+		cb.ServerProtocolVersion(
 			ConnectionHandlerID(serverConnectionHandlerID),
 			int(protocolVersion),
 		)
@@ -145,11 +146,8 @@ func onServerProtocolVersionEvent(serverConnectionHandlerID C.uint64, protocolVe
 
 //export onNewChannelEvent
 func onNewChannelEvent(serverConnectionHandlerID C.uint64, channelID C.uint64, channelParentID C.uint64) {
-	callbacksMutex.RLock()
-	defer callbacksMutex.RUnlock()
-
-	if callbacks.NewChannel != nil {
-		callbacks.NewChannel(
+	if cb := loadCallbacks(); cb.NewChannel != nil {
+		cb.NewChannel(
 			ConnectionHandlerID(serverConnectionHandlerID),
 			ChannelID(channelID),
 			ChannelID(channelParentID),
@@ -159,61 +157,49 @@ func onNewChannelEvent(serverConnectionHandlerID C.uint64, channelID C.uint64, c
 
 //export onNewChannelCreatedEvent
 func onNewChannelCreatedEvent(serverConnectionHandlerID C.uint64, channelID C.uint64, channelParentID C.uint64, invokerID C.anyID, invokerName *C.char, invokerUniqueIdentifier *C.char) {
-	callbacksMutex.RLock()
-	defer callbacksMutex.RUnlock()
-
-	if callbacks.NewChannelCreated != nil {
-		callbacks.NewChannelCreated(
+	if cb := loadCallbacks(); cb.NewChannelCreated != nil {
+		cb.NewChannelCreated(
 			ConnectionHandlerID(serverConnectionHandlerID),
 			ChannelID(channelID),
 			ChannelID(channelParentID),
 			ClientID(invokerID),
-			C.GoString(invokerName),
-			C.GoString(invokerUniqueIdentifier),
+			internCString(invokerName),
+			internCString(invokerUniqueIdentifier),
 		)
 	}
 }
 
 //export onDelChannelEvent
 func onDelChannelEvent(serverConnectionHandlerID C.uint64, channelID C.uint64, invokerID C.anyID, invokerName *C.char, invokerUniqueIdentifier *C.char) {
-	callbacksMutex.RLock()
-	defer callbacksMutex.RUnlock()
-
-	if callbacks.DelChannel != nil {
-		callbacks.DelChannel(
+	if cb := loadCallbacks(); cb.DelChannel != nil {
+		cb.DelChannel(
 			ConnectionHandlerID(serverConnectionHandlerID),
 			ChannelID(channelID),
 			ClientID(invokerID),
-			C.GoString(invokerName),
-			C.GoString(invokerUniqueIdentifier),
+			internCString(invokerName),
+			internCString(invokerUniqueIdentifier),
 		)
 	}
 }
 
 //export onChannelMoveEvent
 func onChannelMoveEvent(serverConnectionHandlerID C.uint64, channelID C.uint64, newChannelParentID C.uint64, invokerID C.anyID, invokerName *C.char, invokerUniqueIdentifier *C.char) {
-	callbacksMutex.RLock()
-	defer callbacksMutex.RUnlock()
-
-	if callbacks.ChannelMove != nil {
-		callbacks.ChannelMove(
+	if cb := loadCallbacks(); cb.ChannelMove != nil {
+		cb.ChannelMove(
 			ConnectionHandlerID(serverConnectionHandlerID),
 			ChannelID(channelID),
 			ChannelID(newChannelParentID),
 			ClientID(invokerID),
-			C.GoString(invokerName),
-			C.GoString(invokerUniqueIdentifier),
+			internCString(invokerName),
+			internCString(invokerUniqueIdentifier),
 		)
 	}
 }
 
 //export onUpdateChannelEvent
 func onUpdateChannelEvent(serverConnectionHandlerID C.uint64, channelID C.uint64) {
-	callbacksMutex.RLock()
-	defer callbacksMutex.RUnlock()
-
-	if callbacks.UpdateChannel != nil {
-		callbacks.UpdateChannel(
+	if cb := loadCallbacks(); cb.UpdateChannel != nil {
+		cb.UpdateChannel(
 			ConnectionHandlerID(serverConnectionHandlerID),
 			ChannelID(channelID),
 		)
@@ -222,43 +208,34 @@ func onUpdateChannelEvent(serverConnectionHandlerID C.uint64, channelID C.uint64
 
 //export onUpdateChannelEditedEvent
 func onUpdateChannelEditedEvent(serverConnectionHandlerID C.uint64, channelID C.uint64, invokerID C.anyID, invokerName *C.char, invokerUniqueIdentifier *C.char) {
-	callbacksMutex.RLock()
-	defer callbacksMutex.RUnlock()
-
-	if callbacks.UpdateChannelEdited != nil {
-		callbacks.UpdateChannelEdited(
+	if cb := loadCallbacks(); cb.UpdateChannelEdited != nil {
+		cb.UpdateChannelEdited(
 			ConnectionHandlerID(serverConnectionHandlerID),
 			ChannelID(channelID),
 			ClientID(invokerID),
-			C.GoString(invokerName),
-			C.GoString(invokerUniqueIdentifier),
+			internCString(invokerName),
+			internCString(invokerUniqueIdentifier),
 		)
 	}
 }
 
 //export onUpdateClientEvent
 func onUpdateClientEvent(serverConnectionHandlerID C.uint64, clientID C.anyID, invokerID C.anyID, invokerName *C.char, invokerUniqueIdentifier *C.char) {
-	callbacksMutex.RLock()
-	defer callbacksMutex.RUnlock()
-
-	if callbacks.UpdateClient != nil {
-		callbacks.UpdateClient(
+	if cb := loadCallbacks(); cb.UpdateClient != nil {
+		cb.UpdateClient(
 			ConnectionHandlerID(serverConnectionHandlerID),
 			ClientID(clientID),
 			ClientID(invokerID),
-			C.GoString(invokerName),
-			C.GoString(invokerUniqueIdentifier),
+			internCString(invokerName),
+			internCString(invokerUniqueIdentifier),
 		)
 	}
 }
 
 //export onClientMoveEvent
 func onClientMoveEvent(serverConnectionHandlerID C.uint64, clientID C.anyID, oldChannelID C.uint64, newChannelID C.uint64, visibility C.int, moveMessage *C.char) {
-	callbacksMutex.RLock()
-	defer callbacksMutex.RUnlock()
-
-	if callbacks.ClientMove != nil {
-		callbacks.ClientMove(
+	if cb := loadCallbacks(); cb.ClientMove != nil {
+		cb.ClientMove(
 			ConnectionHandlerID(serverConnectionHandlerID),
 			ClientID(clientID),
 			ChannelID(oldChannelID),
@@ -271,11 +248,8 @@ func onClientMoveEvent(serverConnectionHandlerID C.uint64, clientID C.anyID, old
 
 //export onClientMoveSubscriptionEvent
 func onClientMoveSubscriptionEvent(serverConnectionHandlerID C.uint64, clientID C.anyID, oldChannelID C.uint64, newChannelID C.uint64, visibility C.int) {
-	callbacksMutex.RLock()
-	defer callbacksMutex.RUnlock()
-
-	if callbacks.ClientMoveSubscription != nil {
-		callbacks.ClientMoveSubscription(
+	if cb := loadCallbacks(); cb.ClientMoveSubscription != nil {
+		cb.ClientMoveSubscription(
 			ConnectionHandlerID(serverConnectionHandlerID),
 			ClientID(clientID),
 			ChannelID(oldChannelID),
@@ -287,11 +261,8 @@ func onClientMoveSubscriptionEvent(serverConnectionHandlerID C.uint64, clientID
 
 //export onClientMoveTimeoutEvent
 func onClientMoveTimeoutEvent(serverConnectionHandlerID C.uint64, clientID C.anyID, oldChannelID C.uint64, newChannelID C.uint64, visibility C.int, timeoutMessage *C.char) {
-	callbacksMutex.RLock()
-	defer callbacksMutex.RUnlock()
-
-	if callbacks.ClientMoveTimeout != nil {
-		callbacks.ClientMoveTimeout(
+	if cb := loadCallbacks(); cb.ClientMoveTimeout != nil {
+		cb.ClientMoveTimeout(
 			ConnectionHandlerID(serverConnectionHandlerID),
 			ClientID(clientID),
 			ChannelID(oldChannelID),
@@ -304,11 +275,8 @@ func onClientMoveTimeoutEvent(serverConnectionHandlerID C.uint64, clientID C.any
 
 //export onTalkStatusChangeEvent
 func onTalkStatusChangeEvent(serverConnectionHandlerID C.uint64, status C.int, isReceivedWhisper C.int, clientID C.anyID) {
-	callbacksMutex.RLock()
-	defer callbacksMutex.RUnlock()
-
-	if callbacks.TalkStatusChange != nil {
-		callbacks.TalkStatusChange(
+	if cb := loadCallbacks(); cb.TalkStatusChange != nil {
+		cb.TalkStatusChange(
 			ConnectionHandlerID(serverConnectionHandlerID),
 			int(status),
 			int(isReceivedWhisper),
@@ -318,19 +286,32 @@ func onTalkStatusChangeEvent(serverConnectionHandlerID C.uint64, status C.int, i
 }
 
 //export onTextMessageEvent
-func onTextMessageEvent(serverConnectionHandlerID C.uint64, targetMode C.anyID, toID C.uint64, fromID C.anyID, fromName *C.char, fromUniqueIdentifier *C.char, message *C.char) {
-	callbacksMutex.RLock()
-	defer callbacksMutex.RUnlock()
-
-	if callbacks.TextMessage != nil {
-		callbacks.TextMessage(
+func onTextMessageEvent(serverConnectionHandlerID C.uint64, targetMode C.anyID, toID C.anyID, fromID C.anyID, fromName *C.char, fromUniqueIdentifier *C.char, message *C.char) {
+	if cb := loadCallbacks(); cb.TextMessage != nil {
+		cb.TextMessage(
 			ConnectionHandlerID(serverConnectionHandlerID),
 			int(targetMode),
 			uint64(toID),
 			ClientID(fromID),
-			C.GoString(fromName),
-			C.GoString(fromUniqueIdentifier),
+			internCString(fromName),
+			internCString(fromUniqueIdentifier),
 			C.GoString(message),
 		)
 	}
 }
+
+//export onServerErrorEvent
+func onServerErrorEvent(serverConnectionHandlerID C.uint64, errorMessage *C.char, errorNumber C.uint, returnCode *C.char, extraMessage *C.char) {
+	if returnCode != nil {
+		completeRequest(unsafe.Slice((*byte)(unsafe.Pointer(returnCode)), C.strlen(returnCode)), Error(errorNumber))
+	}
+	if cb := loadCallbacks(); cb.ServerError != nil {
+		cb.ServerError(
+			ConnectionHandlerID(serverConnectionHandlerID),
+			C.GoString(errorMessage),
+			Error(errorNumber),
+			C.GoString(returnCode),
+			C.GoString(extraMessage),
+		)
+	}
+}
@@ -0,0 +1,122 @@
+/*
+ * Collects the commonly needed properties of every visible client in C, so
+ * Go crosses the cgo boundary once per snapshot instead of several times per
+ * client, and never has to free individual SDK strings.
+ */
+
+#include "clientsnapshot.h"
+
+#include <teamspeak/clientlib.h>
+#include <teamspeak/public_errors.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/* Rounds n up so the array following it stays aligned */
+static size_t align8(size_t n) {
+    return (n + 7) & ~(size_t)7;
+}
+
+unsigned int ts3sdk_getClientSnapshot(uint64 serverConnectionHandlerID, struct ts3sdk_clientSnapshot* out) {
+    anyID* clientList;
+    char** names;
+    unsigned int count = 0;
+    unsigned int valid = 0;
+    unsigned int error;
+    size_t namesSize = 0;
+    size_t offset;
+    char* block;
+    unsigned int i;
+
+    memset(out, 0, sizeof(*out));
+
+    if ((error = ts3client_getClientList(serverConnectionHandlerID, &clientList)) != ERROR_ok)
+        return error;
+
+    while (clientList[count] != 0)
+        ++count;
+
+    /* nicknames first, their total size is needed for the allocation */
+    names = (char**)calloc(count ? count : 1, sizeof(char*));
+    if (names == NULL) {
+        ts3client_freeMemory(clientList);
+        return ERROR_out_of_memory;
+    }
+    for (i = 0; i < count; ++i) {
+        if (ts3client_getClientVariableAsString(serverConnectionHandlerID, clientList[i], CLIENT_NICKNAME, &names[i]) == ERROR_ok)
+            namesSize += strlen(names[i]);
+        else
+            names[i] = NULL;
+    }
+
+    offset = 0;
+    offset += align8(count * sizeof(uint64));           /* channelIDs */
+    offset += align8(count * sizeof(int)) * 3;          /* talkStatus, inputMuted, outputMuted */
+    offset += align8(count * sizeof(unsigned int)) * 2; /* nicknameOffset, nicknameLen */
+    offset += align8(count * sizeof(anyID));            /* clientIDs */
+    block = (char*)malloc(offset + namesSize + 1);
+    if (block == NULL) {
+        error = ERROR_out_of_memory;
+        goto cleanup;
+    }
+
+    offset = 0;
+    out->channelIDs = (uint64*)(block + offset);
+    offset += align8(count * sizeof(uint64));
+    out->talkStatus = (int*)(block + offset);
+    offset += align8(count * sizeof(int));
+    out->inputMuted = (int*)(block + offset);
+    offset += align8(count * sizeof(int));
+    out->outputMuted = (int*)(block + offset);
+    offset += align8(count * sizeof(int));
+    out->nicknameOffset = (unsigned int*)(block + offset);
+    offset += align8(count * sizeof(unsigned int));
+    out->nicknameLen = (unsigned int*)(block + offset);
+    offset += align8(count * sizeof(unsigned int));
+    out->clientIDs = (anyID*)(block + offset);
+    offset += align8(count * sizeof(anyID));
+    out->nicknames = block + offset;
+
+    offset = 0;
+    for (i = 0; i < count; ++i) {
+        anyID clientID = clientList[i];
+        size_t len;
+
+        /* skip clients that left between listing and querying */
+        if (names[i] == NULL || ts3client_getChannelOfClient(serverConnectionHandlerID, clientID, &out->channelIDs[valid]) != ERROR_ok)
+            continue;
+
+        if (ts3client_getClientVariableAsInt(serverConnectionHandlerID, clientID, CLIENT_FLAG_TALKING, &out->talkStatus[valid]) != ERROR_ok)
+            out->talkStatus[valid] = STATUS_NOT_TALKING;
+        if (ts3client_getClientVariableAsInt(serverConnectionHandlerID, clientID, CLIENT_INPUT_MUTED, &out->inputMuted[valid]) != ERROR_ok)
+            out->inputMuted[valid] = MUTEINPUT_NONE;
+        if (ts3client_getClientVariableAsInt(serverConnectionHandlerID, clientID, CLIENT_OUTPUT_MUTED, &out->outputMuted[valid]) != ERROR_ok)
+            out->outputMuted[valid] = MUTEOUTPUT_NONE;
+
+        len = strlen(names[i]);
+        memcpy(out->nicknames + offset, names[i], len);
+        out->nicknameOffset[valid] = (unsigned int)offset;
+        out->nicknameLen[valid] = (unsigned int)len;
+        out->clientIDs[valid] = clientID;
+        offset += len;
+        ++valid;
+    }
+    out->count = valid;
+    out->nicknamesSize = (unsigned int)offset;
+    error = ERROR_ok;
+
+cleanup:
+    for (i = 0; i < count; ++i) {
+        if (names[i] != NULL)
+            ts3client_freeMemory(names[i]);
+    }
+    free(names);
+    ts3client_freeMemory(clientList);
+    return error;
+}
+
+void ts3sdk_freeClientSnapshot(struct ts3sdk_clientSnapshot* snapshot) {
+    /* channelIDs is the start of the block */
+    free(snapshot->channelIDs);
+    memset(snapshot, 0, sizeof(*snapshot));
+}
@@ -0,0 +1,91 @@
+// Package ts3sdk provides Go bindings for the TeamSpeak 3 Client SDK.
+package ts3sdk
+
+/*
+#include <stdlib.h>
+#include <teamspeak/clientlib.h>
+#include <teamspeak/public_definitions.h>
+#include <teamspeak/public_errors.h>
+#include "clientsnapshot.h"
+*/
+import "C"
+import (
+	"unsafe"
+)
+
+// ClientSnapshot holds the properties of all visible clients of a connection, one slice per property.
+// Index i of every slice describes the same client.
+type ClientSnapshot struct {
+	ClientIDs   []ClientID
+	ChannelIDs  []ChannelID
+	TalkStatus  []int // TalkStatus enum values
+	InputMuted  []bool
+	OutputMuted []bool
+	Nicknames   []string
+}
+
+// Len returns the number of clients in the snapshot
+func (s *ClientSnapshot) Len() int {
+	return len(s.ClientIDs)
+}
+
+// GetClientSnapshot returns channel, talk status, mute flags and nickname of every visible client.
+// The properties are collected on the C side, so this costs one cgo call regardless of the number of clients.
+func GetClientSnapshot(serverConnectionHandlerID ConnectionHandlerID) (*ClientSnapshot, error) {
+	s := &ClientSnapshot{}
+	if err := s.Update(serverConnectionHandlerID); err != nil {
+		return nil, err
+	}
+	return s, nil
+}
+
+// Update refreshes the snapshot in place, reusing its slices
+func (s *ClientSnapshot) Update(serverConnectionHandlerID ConnectionHandlerID) error {
+	var cs C.struct_ts3sdk_clientSnapshot
+	err := C.ts3sdk_getClientSnapshot(C.uint64(serverConnectionHandlerID), &cs)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	defer C.ts3sdk_freeClientSnapshot(&cs)
+
+	n := int(cs.count)
+	s.ClientIDs = resize(s.ClientIDs, n)
+	s.ChannelIDs = resize(s.ChannelIDs, n)
+	s.TalkStatus = resize(s.TalkStatus, n)
+	s.InputMuted = resize(s.InputMuted, n)
+	s.OutputMuted = resize(s.OutputMuted, n)
+	s.Nicknames = resize(s.Nicknames, n)
+	if n == 0 {
+		return nil
+	}
+
+	clientIDs := unsafe.Slice(cs.clientIDs, n)
+	channelIDs := unsafe.Slice(cs.channelIDs, n)
+	talkStatus := unsafe.Slice(cs.talkStatus, n)
+	inputMuted := unsafe.Slice(cs.inputMuted, n)
+	outputMuted := unsafe.Slice(cs.outputMuted, n)
+	nicknameOffset := unsafe.Slice(cs.nicknameOffset, n)
+	nicknameLen := unsafe.Slice(cs.nicknameLen, n)
+
+	// one allocation for all nicknames, each nickname is a substring of it
+	nicknames := C.GoStringN(cs.nicknames, C.int(cs.nicknamesSize))
+
+	for i := 0; i < n; i++ {
+		s.ClientIDs[i] = ClientID(clientIDs[i])
+		s.ChannelIDs[i] = ChannelID(channelIDs[i])
+		s.TalkStatus[i] = int(talkStatus[i])
+		s.InputMuted[i] = inputMuted[i] != C.MUTEINPUT_NONE
+		s.OutputMuted[i] = outputMuted[i] != C.MUTEOUTPUT_NONE
+		offset := int(nicknameOffset[i])
+		s.Nicknames[i] = nicknames[offset : offset+int(nicknameLen[i])]
+	}
+	return nil
+}
+
+// resize returns a slice of length n, reusing s if it is large enough
+func resize[T any](s []T, n int) []T {
+	if cap(s) < n {
+		return make([]T, n)
+	}
+	return s[:n]
+}
@@ -0,0 +1,31 @@
+#ifndef TS3SDK_CLIENTSNAPSHOT_H
+#define TS3SDK_CLIENTSNAPSHOT_H
+
+#include <teamspeak/public_definitions.h>
+
+/*
+ * Properties of all visible clients of a connection, one array per property.
+ * All arrays and the nickname bytes live in a single allocation that is
+ * released with ts3sdk_freeClientSnapshot.
+ *
+ * nicknames - nicknames packed back to back without terminators,
+ *             nickname i is nicknameLen[i] bytes at nicknameOffset[i]
+ */
+struct ts3sdk_clientSnapshot {
+    unsigned int count;
+    anyID* clientIDs;
+    uint64* channelIDs;
+    int* talkStatus;
+    int* inputMuted;
+    int* outputMuted;
+    unsigned int* nicknameOffset;
+    unsigned int* nicknameLen;
+    char* nicknames;
+    unsigned int nicknamesSize;
+};
+
+/* Fills out with one call into the client lib per property and client. Returns an error code. */
+unsigned int ts3sdk_getClientSnapshot(uint64 serverConnectionHandlerID, struct ts3sdk_clientSnapshot* out);
+void ts3sdk_freeClientSnapshot(struct ts3sdk_clientSnapshot* snapshot);
+
+#endif
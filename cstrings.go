@@ -0,0 +1,83 @@
+// Package ts3sdk provides Go bindings for the TeamSpeak 3 Client SDK.
+package ts3sdk
+
+/*
+#include <stdlib.h>
+*/
+import "C"
+import (
+	"unsafe"
+)
+
+// String arguments of a binding are packed into one reusable C buffer instead of a
+// C.CString/C.free pair each. Buffers are kept on a small free list, so a call whose
+// strings fit the buffer it gets doesn't call malloc at all.
+const (
+	cArenaMaxStrings = 8
+	cArenaMinSize    = 256
+	cArenaMaxPooled  = 64 * 1024 // larger buffers are freed instead of reused
+	cArenaFreeList   = 32
+)
+
+type cArena struct {
+	buf     unsafe.Pointer
+	size    int
+	offsets [cArenaMaxStrings]int
+}
+
+var cArenas = make(chan *cArena, cArenaFreeList)
+
+// getCArena returns an arena holding copies of strs as NUL terminated C strings.
+// Release it with putCArena once the C call returned.
+func getCArena(strs ...string) *cArena {
+	if len(strs) > cArenaMaxStrings {
+		panic("ts3sdk: too many string arguments")
+	}
+
+	var a *cArena
+	select {
+	case a = <-cArenas:
+	default:
+		a = &cArena{}
+	}
+
+	total := 0
+	for _, s := range strs {
+		total += len(s) + 1
+	}
+	if total > a.size {
+		size := max(a.size, cArenaMinSize)
+		for size < total {
+			size *= 2
+		}
+		C.free(a.buf)
+		a.buf = C.malloc(C.size_t(size))
+		a.size = size
+	}
+
+	dst := unsafe.Slice((*byte)(a.buf), a.size)
+	offset := 0
+	for i, s := range strs {
+		a.offsets[i] = offset
+		offset += copy(dst[offset:], s)
+		dst[offset] = 0
+		offset++
+	}
+	return a
+}
+
+// str returns the i-th string passed to getCArena
+func (a *cArena) str(i int) *C.char {
+	return (*C.char)(unsafe.Add(a.buf, a.offsets[i]))
+}
+
+func putCArena(a *cArena) {
+	if a.size <= cArenaMaxPooled {
+		select {
+		case cArenas <- a:
+			return
+		default:
+		}
+	}
+	C.free(a.buf)
+}
@@ -0,0 +1,247 @@
+// Package ts3sdk provides Go bindings for the TeamSpeak 3 Client SDK.
+package ts3sdk
+
+/*
+#include <stdlib.h>
+#include <teamspeak/clientlib.h>
+#include <teamspeak/public_definitions.h>
+#include <teamspeak/public_errors.h>
+*/
+import "C"
+import (
+	"context"
+	"sync/atomic"
+	"time"
+	"unsafe"
+)
+
+// Custom devices exchange audio with the client lib in 20 ms frames at 48 kHz,
+// the rate and period the client lib works with internally.
+const (
+	CustomDeviceFrequency    = 48000
+	CustomDeviceFramePeriod  = 20 * time.Millisecond
+	CustomDeviceFrameSamples = CustomDeviceFrequency / 50 // samples per channel in one frame
+
+	// customDeviceMaxCatchUp is the most periods Pump catches up at once. A pump further behind,
+	// e.g. after the process was suspended, drops the backlog and restarts from now.
+	customDeviceMaxCatchUp = 5
+)
+
+// CustomDevice is a registered custom sound device.
+//
+// The frame buffers are allocated once in C memory and handed out as []int16
+// views, so exchanging a frame with the client lib neither copies nor allocates.
+// A CustomDevice is not safe for concurrent use; use one goroutine (e.g. Pump) per device.
+type CustomDevice struct {
+	id               *C.char
+	captureChannels  int
+	playbackChannels int
+	capture          []int16
+	playback         []int16
+
+	// Pump counters
+	framesCaptured atomic.Uint64
+	framesPlayed   atomic.Uint64
+	framesNoData   atomic.Uint64
+	periodsMissed  atomic.Uint64
+	periodsSkipped atomic.Uint64
+}
+
+// CustomDeviceStats holds counters of a custom device pump
+type CustomDeviceStats struct {
+	FramesCaptured uint64 // frames passed to the client lib
+	FramesPlayed   uint64 // frames received from the client lib
+	FramesNoData   uint64 // periods in which the client lib had nothing to play
+	PeriodsMissed  uint64 // periods that had to be caught up because the pump was late
+	PeriodsSkipped uint64 // periods dropped because the pump was too far behind to catch up
+}
+
+// RegisterCustomDevice registers a custom sound device with the given channel counts at 48 kHz
+func RegisterCustomDevice(deviceID, displayName string, captureChannels, playbackChannels int) (*CustomDevice, error) {
+	cDeviceID := C.CString(deviceID)
+
+	cDisplayName := C.CString(displayName)
+	defer C.free(unsafe.Pointer(cDisplayName))
+
+	err := C.ts3client_registerCustomDevice(
+		cDeviceID,
+		cDisplayName,
+		C.int(CustomDeviceFrequency),
+		C.int(captureChannels),
+		C.int(CustomDeviceFrequency),
+		C.int(playbackChannels),
+	)
+	if err != C.ERROR_ok {
+		C.free(unsafe.Pointer(cDeviceID))
+		return nil, Error(err)
+	}
+
+	d := &CustomDevice{
+		id:               cDeviceID,
+		captureChannels:  captureChannels,
+		playbackChannels: playbackChannels,
+	}
+	var ok bool
+	d.capture, ok = allocFrame(captureChannels)
+	if ok {
+		d.playback, ok = allocFrame(playbackChannels)
+	}
+	if !ok {
+		d.Unregister()
+		return nil, ErrorOutOfMemory
+	}
+	return d, nil
+}
+
+// allocFrame allocates a zeroed frame buffer in C memory, nil without channels.
+// It returns false if the allocation failed.
+func allocFrame(channels int) ([]int16, bool) {
+	if channels <= 0 {
+		return nil, true
+	}
+	n := CustomDeviceFrameSamples * channels
+	p := C.calloc(C.size_t(n), C.size_t(unsafe.Sizeof(C.short(0))))
+	if p == nil {
+		return nil, false
+	}
+	return unsafe.Slice((*int16)(p), n), true
+}
+
+func freeFrame(frame []int16) {
+	if frame != nil {
+		C.free(unsafe.Pointer(&frame[0]))
+	}
+}
+
+// Unregister removes the custom device and releases its buffers. Frame views become invalid,
+// later calls on the device return ErrorSoundUnknownDevice.
+func (d *CustomDevice) Unregister() error {
+	if d.id == nil {
+		return ErrorSoundUnknownDevice
+	}
+	err := C.ts3client_unregisterCustomDevice(d.id)
+	freeFrame(d.capture)
+	freeFrame(d.playback)
+	C.free(unsafe.Pointer(d.id))
+	d.capture, d.playback, d.id = nil, nil, nil
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// CaptureFrame returns the capture frame buffer, interleaved, CustomDeviceFrameSamples per channel.
+// Fill it and call ProcessCapture.
+func (d *CustomDevice) CaptureFrame() []int16 {
+	return d.capture
+}
+
+// ProcessCapture passes the capture frame buffer to the client lib. It fails with
+// ErrorParameterInvalid if the device has no capture channels.
+func (d *CustomDevice) ProcessCapture() error {
+	if d.id == nil {
+		return ErrorSoundUnknownDevice
+	}
+	if d.capture == nil {
+		return ErrorParameterInvalid
+	}
+	err := C.ts3client_processCustomCaptureData(d.id, (*C.short)(unsafe.Pointer(&d.capture[0])), C.int(CustomDeviceFrameSamples))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// AcquirePlayback fetches one frame of playback data into the playback frame buffer and returns it.
+// The returned slice is nil if the client lib has nothing to play. It fails with
+// ErrorParameterInvalid if the device has no playback channels.
+func (d *CustomDevice) AcquirePlayback() ([]int16, error) {
+	if d.id == nil {
+		return nil, ErrorSoundUnknownDevice
+	}
+	if d.playback == nil {
+		return nil, ErrorParameterInvalid
+	}
+	err := C.ts3client_acquireCustomPlaybackData(d.id, (*C.short)(unsafe.Pointer(&d.playback[0])), C.int(CustomDeviceFrameSamples))
+	if err == C.ERROR_sound_no_data {
+		return nil, nil // not an error, play silence
+	}
+	if err != C.ERROR_ok {
+		return nil, Error(err)
+	}
+	return d.playback, nil
+}
+
+// Pump exchanges one frame every 20 ms until ctx is done or an error occurs.
+//
+// capture is called with the capture frame buffer to fill, returning false skips sending this period.
+// playback is called with each frame received from the client lib.
+// Either may be nil. Neither may retain the slice beyond the call.
+// Periods are scheduled against absolute deadlines, so processing time does not accumulate as drift;
+// if the pump falls behind, up to 5 missed periods are caught up immediately. Further behind, the
+// backlog is dropped and the schedule restarts from now, instead of bursting audio at the client lib.
+func (d *CustomDevice) Pump(ctx context.Context, capture func(frame []int16) bool, playback func(frame []int16)) error {
+	if d.id == nil {
+		return ErrorSoundUnknownDevice
+	}
+	timer := time.NewTimer(CustomDeviceFramePeriod)
+	defer timer.Stop()
+
+	deadline := time.Now()
+	for {
+		if capture != nil && d.capture != nil && capture(d.capture) {
+			if err := d.ProcessCapture(); err != nil {
+				return err
+			}
+			d.framesCaptured.Add(1)
+		}
+
+		if d.playback != nil {
+			frame, err := d.AcquirePlayback()
+			if err != nil {
+				return err
+			}
+			if frame == nil {
+				d.framesNoData.Add(1)
+			} else {
+				d.framesPlayed.Add(1)
+				if playback != nil {
+					playback(frame)
+				}
+			}
+		}
+
+		deadline = deadline.Add(CustomDeviceFramePeriod)
+		wait := time.Until(deadline)
+		if behind := -wait / CustomDeviceFramePeriod; behind >= customDeviceMaxCatchUp {
+			// run one period now and schedule the next from here
+			d.periodsSkipped.Add(uint64(behind))
+			deadline = time.Now()
+			wait = 0
+		}
+		if wait <= 0 {
+			d.periodsMissed.Add(1)
+			if err := ctx.Err(); err != nil {
+				return err
+			}
+			continue
+		}
+		timer.Reset(wait)
+		select {
+		case <-ctx.Done():
+			return ctx.Err()
+		case <-timer.C:
+		}
+	}
+}
+
+// Stats returns the counters of the device pump
+func (d *CustomDevice) Stats() CustomDeviceStats {
+	return CustomDeviceStats{
+		FramesCaptured: d.framesCaptured.Load(),
+		FramesPlayed:   d.framesPlayed.Load(),
+		FramesNoData:   d.framesNoData.Load(),
+		PeriodsMissed:  d.periodsMissed.Load(),
+		PeriodsSkipped: d.periodsSkipped.Load(),
+	}
+}
@@ -0,0 +1,134 @@
+//go:build ts3stub
+
+package ts3sdk
+
+import (
+	"context"
+	"testing"
+	"time"
+
+	"github.com/Piekario/ts3sdk/internal/ts3stub"
+)
+
+func TestCustomDeviceUnregistered(t *testing.T) {
+	d, err := RegisterCustomDevice("test", "Test", 1, 0)
+	if err != nil {
+		t.Fatal(err)
+	}
+	if _, err := d.AcquirePlayback(); err != ErrorParameterInvalid {
+		t.Errorf("AcquirePlayback without playback channels returned %v", err)
+	}
+	if err := d.Unregister(); err != nil {
+		t.Fatal(err)
+	}
+
+	if err := d.ProcessCapture(); err != ErrorSoundUnknownDevice {
+		t.Errorf("ProcessCapture after Unregister returned %v", err)
+	}
+	if _, err := d.AcquirePlayback(); err != ErrorSoundUnknownDevice {
+		t.Errorf("AcquirePlayback after Unregister returned %v", err)
+	}
+	if err := d.Pump(context.Background(), nil, nil); err != ErrorSoundUnknownDevice {
+		t.Errorf("Pump after Unregister returned %v", err)
+	}
+	if err := d.Unregister(); err != ErrorSoundUnknownDevice {
+		t.Errorf("second Unregister returned %v", err)
+	}
+}
+
+// A pump stalled for many periods drops the backlog instead of bursting it
+func TestCustomDevicePumpCatchUp(t *testing.T) {
+	d, err := RegisterCustomDevice("test", "Test", 1, 1)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer d.Unregister()
+
+	ctx, cancel := context.WithTimeout(context.Background(), 500*time.Millisecond)
+	defer cancel()
+	stalled := false
+	d.Pump(ctx, func(frame []int16) bool {
+		if !stalled {
+			stalled = true
+			time.Sleep(300 * time.Millisecond)
+		}
+		return true
+	}, nil)
+
+	// 15 periods were missed while stalled, 5 may be caught up
+	s := d.Stats()
+	if s.PeriodsSkipped < 10 {
+		t.Errorf("%d periods skipped after a 300 ms stall", s.PeriodsSkipped)
+	}
+	if s.FramesCaptured > 20 {
+		t.Errorf("%d frames captured in 500 ms", s.FramesCaptured)
+	}
+}
+
+var customDeviceChannels = []struct {
+	name     string
+	channels int
+}{
+	{"mono", 1},
+	{"stereo", 2},
+}
+
+// Per frame cost of handing a capture frame to the client lib, without copies or allocations
+func BenchmarkCustomDeviceProcessCapture(b *testing.B) {
+	for _, c := range customDeviceChannels {
+		b.Run(c.name, func(b *testing.B) {
+			d, err := RegisterCustomDevice("bench", "Bench", c.channels, 0)
+			if err != nil {
+				b.Fatal(err)
+			}
+			defer d.Unregister()
+
+			frame := d.CaptureFrame()
+			b.SetBytes(int64(len(frame) * 2))
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				frame[0] = int16(i)
+				if err := d.ProcessCapture(); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+	}
+}
+
+// Per frame cost of fetching a playback frame from the client lib, with and without data to play
+func BenchmarkCustomDeviceAcquirePlayback(b *testing.B) {
+	for _, c := range customDeviceChannels {
+		for _, data := range []bool{true, false} {
+			name := c.name
+			if !data {
+				name += "/NoData"
+			}
+			b.Run(name, func(b *testing.B) {
+				d, err := RegisterCustomDevice("bench", "Bench", 0, c.channels)
+				if err != nil {
+					b.Fatal(err)
+				}
+				defer d.Unregister()
+				ts3stub.PlaybackData(data)
+				defer ts3stub.PlaybackData(false)
+
+				if data {
+					b.SetBytes(int64(CustomDeviceFrameSamples * c.channels * 2))
+				}
+				b.ReportAllocs()
+				b.ResetTimer()
+				for i := 0; i < b.N; i++ {
+					frame, err := d.AcquirePlayback()
+					if err != nil {
+						b.Fatal(err)
+					}
+					if data && len(frame) != CustomDeviceFrameSamples*c.channels {
+						b.Fatalf("frame of %d samples", len(frame))
+					}
+				}
+			})
+		}
+	}
+}
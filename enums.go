@@ -114,23 +114,55 @@ const (
 	ReasonClientdisconnectServerShutdown = int(C.REASON_CLIENTDISCONNECT_SERVER_SHUTDOWN)
 )
 
+// ChannelProperties is the C enum ChannelProperties, the flags of the channel variables
+type ChannelProperties int
+
 // ChannelProperties enum values
 const (
-	ChannelName               = int(C.CHANNEL_NAME)
-	ChannelTopic              = int(C.CHANNEL_TOPIC)
-	ChannelDescription        = int(C.CHANNEL_DESCRIPTION)
-	ChannelPassword           = int(C.CHANNEL_PASSWORD)
-	ChannelCodec              = int(C.CHANNEL_CODEC)
-	ChannelCodecQuality       = int(C.CHANNEL_CODEC_QUALITY)
-	ChannelMaxclients         = int(C.CHANNEL_MAXCLIENTS)
-	ChannelMaxfamilyclients   = int(C.CHANNEL_MAXFAMILYCLIENTS)
-	ChannelOrder              = int(C.CHANNEL_ORDER)
-	ChannelFlagPermanent      = int(C.CHANNEL_FLAG_PERMANENT)
-	ChannelFlagSemiPermanent  = int(C.CHANNEL_FLAG_SEMI_PERMANENT)
-	ChannelFlagDefault        = int(C.CHANNEL_FLAG_DEFAULT)
-	ChannelFlagPassword       = int(C.CHANNEL_FLAG_PASSWORD)
-	ChannelCodecLatencyFactor = int(C.CHANNEL_CODEC_LATENCY_FACTOR)
-	ChannelCodecIsUnencrypted = int(C.CHANNEL_CODEC_IS_UNENCRYPTED)
-	ChannelSecuritySalt       = int(C.CHANNEL_SECURITY_SALT)
-	ChannelDeleteDelay        = int(C.CHANNEL_DELETE_DELAY)
+	ChannelName               = ChannelProperties(C.CHANNEL_NAME)
+	ChannelTopic              = ChannelProperties(C.CHANNEL_TOPIC)
+	ChannelDescription        = ChannelProperties(C.CHANNEL_DESCRIPTION)
+	ChannelPassword           = ChannelProperties(C.CHANNEL_PASSWORD)
+	ChannelCodec              = ChannelProperties(C.CHANNEL_CODEC)
+	ChannelCodecQuality       = ChannelProperties(C.CHANNEL_CODEC_QUALITY)
+	ChannelMaxclients         = ChannelProperties(C.CHANNEL_MAXCLIENTS)
+	ChannelMaxfamilyclients   = ChannelProperties(C.CHANNEL_MAXFAMILYCLIENTS)
+	ChannelOrder              = ChannelProperties(C.CHANNEL_ORDER)
+	ChannelFlagPermanent      = ChannelProperties(C.CHANNEL_FLAG_PERMANENT)
+	ChannelFlagSemiPermanent  = ChannelProperties(C.CHANNEL_FLAG_SEMI_PERMANENT)
+	ChannelFlagDefault        = ChannelProperties(C.CHANNEL_FLAG_DEFAULT)
+	ChannelFlagPassword       = ChannelProperties(C.CHANNEL_FLAG_PASSWORD)
+	ChannelCodecLatencyFactor = ChannelProperties(C.CHANNEL_CODEC_LATENCY_FACTOR)
+	ChannelCodecIsUnencrypted = ChannelProperties(C.CHANNEL_CODEC_IS_UNENCRYPTED)
+	ChannelSecuritySalt       = ChannelProperties(C.CHANNEL_SECURITY_SALT)
+	ChannelDeleteDelay        = ChannelProperties(C.CHANNEL_DELETE_DELAY)
+)
+
+// ClientProperties is the C enum ClientProperties, the flags of the client variables
+type ClientProperties int
+
+// ClientProperties enum values
+const (
+	ClientUniqueIdentifier       = ClientProperties(C.CLIENT_UNIQUE_IDENTIFIER)
+	ClientNickname               = ClientProperties(C.CLIENT_NICKNAME)
+	ClientVersion                = ClientProperties(C.CLIENT_VERSION)
+	ClientPlatform               = ClientProperties(C.CLIENT_PLATFORM)
+	ClientFlagTalking            = ClientProperties(C.CLIENT_FLAG_TALKING)
+	ClientInputMuted             = ClientProperties(C.CLIENT_INPUT_MUTED)
+	ClientOutputMuted            = ClientProperties(C.CLIENT_OUTPUT_MUTED)
+	ClientOutputonlyMuted        = ClientProperties(C.CLIENT_OUTPUTONLY_MUTED)
+	ClientInputHardware          = ClientProperties(C.CLIENT_INPUT_HARDWARE)
+	ClientOutputHardware         = ClientProperties(C.CLIENT_OUTPUT_HARDWARE)
+	ClientInputDeactivated       = ClientProperties(C.CLIENT_INPUT_DEACTIVATED)
+	ClientIdleTime               = ClientProperties(C.CLIENT_IDLE_TIME)
+	ClientDefaultChannel         = ClientProperties(C.CLIENT_DEFAULT_CHANNEL)
+	ClientDefaultChannelPassword = ClientProperties(C.CLIENT_DEFAULT_CHANNEL_PASSWORD)
+	ClientServerPassword         = ClientProperties(C.CLIENT_SERVER_PASSWORD)
+	ClientMetaData               = ClientProperties(C.CLIENT_META_DATA)
+	ClientIsMuted                = ClientProperties(C.CLIENT_IS_MUTED)
+	ClientIsRecording            = ClientProperties(C.CLIENT_IS_RECORDING)
+	ClientVolumeModificator      = ClientProperties(C.CLIENT_VOLUME_MODIFICATOR)
+	ClientVersionSign            = ClientProperties(C.CLIENT_VERSION_SIGN)
+	ClientSecurityHash           = ClientProperties(C.CLIENT_SECURITY_HASH)
+	ClientEncryptionCiphers      = ClientProperties(C.CLIENT_ENCRYPTION_CIPHERS)
 )
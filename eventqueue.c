@@ -0,0 +1,647 @@
+/*
+ * Bounded multi-producer/single-consumer ring the SDK callbacks write into.
+ *
+ * The SDK invokes callbacks from its own threads. Instead of crossing into Go
+ * for every event, the queueing callbacks below record the event into the
+ * ring and return; a Go goroutine drains the ring in batches.
+ * (Sequence-number ring as described by Dmitry Vyukov.)
+ *
+ * The callbacks are registered once and stay registered, so the ring is
+ * allocated on first use and never freed. A gate decides whether a callback
+ * records into it or calls Go directly; closing the gate waits for the
+ * callbacks still writing, so after ts3sdk_eventQueueStop nothing touches
+ * the ring until the next start and the consumer can drain it completely.
+ *
+ * Only events the bindings depend on themselves, connection status changes
+ * and server errors, are never dropped: while the ring is full they are kept
+ * on an unbounded list beside it and delivered in their place in the stream.
+ * An idle consumer parks instead of polling, the next publish wakes it.
+ */
+
+#include "eventqueue.h"
+#include "_cgo_export.h"
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <sched.h>
+#endif
+
+#ifdef _WIN32
+static void yieldThread(void) {
+    SwitchToThread();
+}
+#else
+static void yieldThread(void) {
+    sched_yield();
+}
+#endif
+
+struct ts3sdk_event_cell {
+    atomic_size_t sequence;
+    struct ts3sdk_event event;
+};
+
+/* Set by the first ts3sdk_eventQueueInit before the gate opens, never freed or changed after */
+static struct ts3sdk_event_cell* cells = NULL;
+static size_t mask = 0;
+
+static atomic_size_t enqueuePos;
+static size_t dequeuePos = 0;
+static atomic_ullong dropped;
+static atomic_ullong overflowed;
+
+/* A control event recorded while the ring was full, due once the consumer reaches pos */
+struct ts3sdk_event_overflow {
+    struct ts3sdk_event_overflow* next;
+    size_t pos;
+    struct ts3sdk_event event;
+};
+
+/* Producers push onto overflowHead, the consumer takes the whole list into its own FIFO */
+static _Atomic(struct ts3sdk_event_overflow*) overflowHead;
+static struct ts3sdk_event_overflow* overflowFirst = NULL;
+static struct ts3sdk_event_overflow* overflowLast = NULL;
+
+/* Set by the consumer before it sleeps, the first publish after that wakes it */
+static atomic_int parked;
+
+/* The gate: callbacks only touch the ring while enabled, producers counts those inside */
+static atomic_int enabled;
+static atomic_int producers;
+
+int ts3sdk_eventQueueInit(unsigned int capacity) {
+    size_t size = 2;
+    size_t i;
+
+    if (cells != NULL)
+        return 1;
+
+    while (size < capacity)
+        size <<= 1;
+
+    cells = (struct ts3sdk_event_cell*)malloc(size * sizeof(struct ts3sdk_event_cell));
+    if (cells == NULL)
+        return 0;
+
+    for (i = 0; i < size; ++i)
+        atomic_init(&cells[i].sequence, i);
+
+    mask = size - 1;
+    return 1;
+}
+
+void ts3sdk_eventQueueStart(void) {
+    atomic_store(&enabled, 1);
+}
+
+void ts3sdk_eventQueueStop(void) {
+    atomic_store(&enabled, 0);
+    /* a callback either saw the gate closed or is counted, see enterQueue */
+    while (atomic_load(&producers) != 0)
+        yieldThread();
+}
+
+/* Whether the callback may record into the ring, it has to leave it again if so */
+static int enterQueue(void) {
+    atomic_fetch_add(&producers, 1);
+    if (atomic_load(&enabled))
+        return 1;
+    atomic_fetch_sub(&producers, 1);
+    return 0;
+}
+
+static void leaveQueue(void) {
+    atomic_fetch_sub_explicit(&producers, 1, memory_order_release);
+}
+
+/* Reserves a cell. Returns NULL if the ring is full, *pos is the position it would have had then. */
+static struct ts3sdk_event_cell* tryReserve(size_t* pos) {
+    struct ts3sdk_event_cell* cell;
+    size_t seq;
+    ptrdiff_t diff;
+
+    *pos = atomic_load_explicit(&enqueuePos, memory_order_relaxed);
+    for (;;) {
+        cell = &cells[*pos & mask];
+        seq = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        diff = (ptrdiff_t)seq - (ptrdiff_t)*pos;
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&enqueuePos, pos, *pos + 1, memory_order_relaxed, memory_order_relaxed))
+                return cell;
+        } else if (diff < 0) {
+            return NULL;
+        } else {
+            *pos = atomic_load_explicit(&enqueuePos, memory_order_relaxed);
+        }
+    }
+}
+
+/* Reserves a cell. Returns NULL, counts a drop and leaves the queue if the ring is full. */
+static struct ts3sdk_event_cell* reserve(size_t* pos) {
+    struct ts3sdk_event_cell* cell;
+
+    if ((cell = tryReserve(pos)) == NULL) {
+        atomic_fetch_add_explicit(&dropped, 1, memory_order_relaxed);
+        leaveQueue();
+    }
+    return cell;
+}
+
+/* Wakes the consumer if it parked, see ts3sdk_eventQueuePark */
+static void wake(void) {
+    if (atomic_load(&parked) && atomic_exchange(&parked, 0))
+        eventQueueWake();
+}
+
+/* Hands the event to the consumer and leaves the queue */
+static void publish(struct ts3sdk_event_cell* cell, size_t pos) {
+    /* sequentially consistent, so either this publish sees parked or the parking consumer sees the event */
+    atomic_store(&cell->sequence, pos + 1);
+    leaveQueue();
+    wake();
+}
+
+/*
+ * Where a control event goes: a cell of the ring or, while the ring is full, an
+ * overflow node due at the position the event would have had.
+ */
+struct ts3sdk_control_slot {
+    struct ts3sdk_event_cell* cell;
+    struct ts3sdk_event_overflow* node;
+    size_t pos;
+};
+
+/* Reserves a slot for a control event. Returns NULL and leaves the queue only if the overflow node can't be allocated. */
+static struct ts3sdk_event* reserveControl(struct ts3sdk_control_slot* slot) {
+    if ((slot->cell = tryReserve(&slot->pos)) != NULL)
+        return &slot->cell->event;
+
+    slot->node = (struct ts3sdk_event_overflow*)malloc(sizeof(struct ts3sdk_event_overflow));
+    if (slot->node == NULL) {
+        leaveQueue();
+        return NULL;
+    }
+    slot->node->pos = slot->pos;
+    return &slot->node->event;
+}
+
+static void publishControl(struct ts3sdk_control_slot* slot) {
+    struct ts3sdk_event_overflow* head;
+
+    if (slot->cell != NULL) {
+        publish(slot->cell, slot->pos);
+        return;
+    }
+
+    head = atomic_load_explicit(&overflowHead, memory_order_relaxed);
+    do {
+        slot->node->next = head;
+    } while (!atomic_compare_exchange_weak(&overflowHead, &head, slot->node));
+    atomic_fetch_add_explicit(&overflowed, 1, memory_order_relaxed);
+    leaveQueue();
+    wake();
+}
+
+static struct ts3sdk_event* begin(struct ts3sdk_event* event, int kind, uint64 serverConnectionHandlerID) {
+    event->kind = kind;
+    event->value = 0;
+    event->flag = 0;
+    event->errorNumber = 0;
+    event->serverConnectionHandlerID = serverConnectionHandlerID;
+    event->channelID = 0;
+    event->otherChannelID = 0;
+    event->extra[0] = event->extra[1] = 0;
+    event->clientID = 0;
+    event->invokerID = 0;
+    event->stringLen[0] = event->stringLen[1] = event->stringLen[2] = 0;
+    event->heap = NULL;
+    return event;
+}
+
+/* Packs up to TS3SDK_EVENT_MAX_STRINGS strings into the event, NULL strings are stored as empty */
+static void setStrings(struct ts3sdk_event* event, const char* s0, const char* s1, const char* s2) {
+    const char* strings[TS3SDK_EVENT_MAX_STRINGS] = { s0, s1, s2 };
+    size_t total = 0;
+    size_t len;
+    char* dst;
+    int i;
+
+    for (i = 0; i < TS3SDK_EVENT_MAX_STRINGS; ++i) {
+        len = strings[i] ? strlen(strings[i]) : 0;
+        if (len > 0xFFFF)
+            len = 0xFFFF;
+        event->stringLen[i] = (unsigned short)len;
+        total += len;
+    }
+
+    dst = event->text;
+    if (total > TS3SDK_EVENT_TEXT_SIZE) {
+        event->heap = (char*)malloc(total);
+        if (event->heap == NULL) {
+            event->stringLen[0] = event->stringLen[1] = event->stringLen[2] = 0;
+            return;
+        }
+        dst = event->heap;
+    }
+
+    for (i = 0; i < TS3SDK_EVENT_MAX_STRINGS; ++i) {
+        memcpy(dst, strings[i], event->stringLen[i]);
+        dst += event->stringLen[i];
+    }
+}
+
+/* Never dropped, a lost status change would leave the requests of a lost connection pending */
+static void queueConnectStatusChangeEvent(uint64 serverConnectionHandlerID, int newStatus, unsigned int errorNumber) {
+    struct ts3sdk_control_slot slot;
+    struct ts3sdk_event* event;
+
+    /* out of memory for the overflow too: deliver directly rather than lose it */
+    if (!enterQueue() || (event = reserveControl(&slot)) == NULL) {
+        onConnectStatusChangeEvent(serverConnectionHandlerID, newStatus, errorNumber);
+        return;
+    }
+    event = begin(event, TS3SDK_EVENT_CONNECT_STATUS_CHANGE, serverConnectionHandlerID);
+    event->value = newStatus;
+    event->errorNumber = errorNumber;
+    publishControl(&slot);
+}
+
+static void queueServerProtocolVersionEvent(uint64 serverConnectionHandlerID, int protocolVersion) {
+    struct ts3sdk_event_cell* cell;
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!enterQueue()) {
+        onServerProtocolVersionEvent(serverConnectionHandlerID, protocolVersion);
+        return;
+    }
+    if ((cell = reserve(&pos)) == NULL)
+        return;
+    event = begin(&cell->event, TS3SDK_EVENT_SERVER_PROTOCOL_VERSION, serverConnectionHandlerID);
+    event->value = protocolVersion;
+    publish(cell, pos);
+}
+
+static void queueNewChannelEvent(uint64 serverConnectionHandlerID, uint64 channelID, uint64 channelParentID) {
+    struct ts3sdk_event_cell* cell;
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!enterQueue()) {
+        onNewChannelEvent(serverConnectionHandlerID, channelID, channelParentID);
+        return;
+    }
+    if ((cell = reserve(&pos)) == NULL)
+        return;
+    event = begin(&cell->event, TS3SDK_EVENT_NEW_CHANNEL, serverConnectionHandlerID);
+    event->channelID = channelID;
+    event->otherChannelID = channelParentID;
+    publish(cell, pos);
+}
+
+static void queueNewChannelCreatedEvent(uint64 serverConnectionHandlerID, uint64 channelID, uint64 channelParentID, anyID invokerID, const char* invokerName, const char* invokerUniqueIdentifier) {
+    struct ts3sdk_event_cell* cell;
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!enterQueue()) {
+        onNewChannelCreatedEvent(serverConnectionHandlerID, channelID, channelParentID, invokerID, (char*)invokerName, (char*)invokerUniqueIdentifier);
+        return;
+    }
+    if ((cell = reserve(&pos)) == NULL)
+        return;
+    event = begin(&cell->event, TS3SDK_EVENT_NEW_CHANNEL_CREATED, serverConnectionHandlerID);
+    event->channelID = channelID;
+    event->otherChannelID = channelParentID;
+    event->invokerID = invokerID;
+    setStrings(event, invokerName, invokerUniqueIdentifier, NULL);
+    publish(cell, pos);
+}
+
+static void queueDelChannelEvent(uint64 serverConnectionHandlerID, uint64 channelID, anyID invokerID, const char* invokerName, const char* invokerUniqueIdentifier) {
+    struct ts3sdk_event_cell* cell;
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!enterQueue()) {
+        onDelChannelEvent(serverConnectionHandlerID, channelID, invokerID, (char*)invokerName, (char*)invokerUniqueIdentifier);
+        return;
+    }
+    if ((cell = reserve(&pos)) == NULL)
+        return;
+    event = begin(&cell->event, TS3SDK_EVENT_DEL_CHANNEL, serverConnectionHandlerID);
+    event->channelID = channelID;
+    event->invokerID = invokerID;
+    setStrings(event, invokerName, invokerUniqueIdentifier, NULL);
+    publish(cell, pos);
+}
+
+static void queueChannelMoveEvent(uint64 serverConnectionHandlerID, uint64 channelID, uint64 newChannelParentID, anyID invokerID, const char* invokerName, const char* invokerUniqueIdentifier) {
+    struct ts3sdk_event_cell* cell;
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!enterQueue()) {
+        onChannelMoveEvent(serverConnectionHandlerID, channelID, newChannelParentID, invokerID, (char*)invokerName, (char*)invokerUniqueIdentifier);
+        return;
+    }
+    if ((cell = reserve(&pos)) == NULL)
+        return;
+    event = begin(&cell->event, TS3SDK_EVENT_CHANNEL_MOVE, serverConnectionHandlerID);
+    event->channelID = channelID;
+    event->otherChannelID = newChannelParentID;
+    event->invokerID = invokerID;
+    setStrings(event, invokerName, invokerUniqueIdentifier, NULL);
+    publish(cell, pos);
+}
+
+static void queueUpdateChannelEvent(uint64 serverConnectionHandlerID, uint64 channelID) {
+    struct ts3sdk_event_cell* cell;
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!enterQueue()) {
+        onUpdateChannelEvent(serverConnectionHandlerID, channelID);
+        return;
+    }
+    if ((cell = reserve(&pos)) == NULL)
+        return;
+    event = begin(&cell->event, TS3SDK_EVENT_UPDATE_CHANNEL, serverConnectionHandlerID);
+    event->channelID = channelID;
+    publish(cell, pos);
+}
+
+static void queueUpdateChannelEditedEvent(uint64 serverConnectionHandlerID, uint64 channelID, anyID invokerID, const char* invokerName, const char* invokerUniqueIdentifier) {
+    struct ts3sdk_event_cell* cell;
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!enterQueue()) {
+        onUpdateChannelEditedEvent(serverConnectionHandlerID, channelID, invokerID, (char*)invokerName, (char*)invokerUniqueIdentifier);
+        return;
+    }
+    if ((cell = reserve(&pos)) == NULL)
+        return;
+    event = begin(&cell->event, TS3SDK_EVENT_UPDATE_CHANNEL_EDITED, serverConnectionHandlerID);
+    event->channelID = channelID;
+    event->invokerID = invokerID;
+    setStrings(event, invokerName, invokerUniqueIdentifier, NULL);
+    publish(cell, pos);
+}
+
+static void queueUpdateClientEvent(uint64 serverConnectionHandlerID, anyID clientID, anyID invokerID, const char* invokerName, const char* invokerUniqueIdentifier) {
+    struct ts3sdk_event_cell* cell;
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!enterQueue()) {
+        onUpdateClientEvent(serverConnectionHandlerID, clientID, invokerID, (char*)invokerName, (char*)invokerUniqueIdentifier);
+        return;
+    }
+    if ((cell = reserve(&pos)) == NULL)
+        return;
+    event = begin(&cell->event, TS3SDK_EVENT_UPDATE_CLIENT, serverConnectionHandlerID);
+    event->clientID = clientID;
+    event->invokerID = invokerID;
+    setStrings(event, invokerName, invokerUniqueIdentifier, NULL);
+    publish(cell, pos);
+}
+
+static void queueClientMoveEvent(uint64 serverConnectionHandlerID, anyID clientID, uint64 oldChannelID, uint64 newChannelID, int visibility, const char* moveMessage) {
+    struct ts3sdk_event_cell* cell;
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!enterQueue()) {
+        onClientMoveEvent(serverConnectionHandlerID, clientID, oldChannelID, newChannelID, visibility, (char*)moveMessage);
+        return;
+    }
+    if ((cell = reserve(&pos)) == NULL)
+        return;
+    event = begin(&cell->event, TS3SDK_EVENT_CLIENT_MOVE, serverConnectionHandlerID);
+    event->clientID = clientID;
+    event->channelID = oldChannelID;
+    event->otherChannelID = newChannelID;
+    event->value = visibility;
+    setStrings(event, moveMessage, NULL, NULL);
+    publish(cell, pos);
+}
+
+static void queueClientMoveSubscriptionEvent(uint64 serverConnectionHandlerID, anyID clientID, uint64 oldChannelID, uint64 newChannelID, int visibility) {
+    struct ts3sdk_event_cell* cell;
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!enterQueue()) {
+        onClientMoveSubscriptionEvent(serverConnectionHandlerID, clientID, oldChannelID, newChannelID, visibility);
+        return;
+    }
+    if ((cell = reserve(&pos)) == NULL)
+        return;
+    event = begin(&cell->event, TS3SDK_EVENT_CLIENT_MOVE_SUBSCRIPTION, serverConnectionHandlerID);
+    event->clientID = clientID;
+    event->channelID = oldChannelID;
+    event->otherChannelID = newChannelID;
+    event->value = visibility;
+    publish(cell, pos);
+}
+
+static void queueClientMoveTimeoutEvent(uint64 serverConnectionHandlerID, anyID clientID, uint64 oldChannelID, uint64 newChannelID, int visibility, const char* timeoutMessage) {
+    struct ts3sdk_event_cell* cell;
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!enterQueue()) {
+        onClientMoveTimeoutEvent(serverConnectionHandlerID, clientID, oldChannelID, newChannelID, visibility, (char*)timeoutMessage);
+        return;
+    }
+    if ((cell = reserve(&pos)) == NULL)
+        return;
+    event = begin(&cell->event, TS3SDK_EVENT_CLIENT_MOVE_TIMEOUT, serverConnectionHandlerID);
+    event->clientID = clientID;
+    event->channelID = oldChannelID;
+    event->otherChannelID = newChannelID;
+    event->value = visibility;
+    setStrings(event, timeoutMessage, NULL, NULL);
+    publish(cell, pos);
+}
+
+static void queueTalkStatusChangeEvent(uint64 serverConnectionHandlerID, int status, int isReceivedWhisper, anyID clientID) {
+    struct ts3sdk_event_cell* cell;
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!enterQueue()) {
+        onTalkStatusChangeEvent(serverConnectionHandlerID, status, isReceivedWhisper, clientID);
+        return;
+    }
+    if ((cell = reserve(&pos)) == NULL)
+        return;
+    event = begin(&cell->event, TS3SDK_EVENT_TALK_STATUS_CHANGE, serverConnectionHandlerID);
+    event->value = status;
+    event->flag = isReceivedWhisper;
+    event->clientID = clientID;
+    publish(cell, pos);
+}
+
+static void queueTextMessageEvent(uint64 serverConnectionHandlerID, anyID targetMode, anyID toID, anyID fromID, const char* fromName, const char* fromUniqueIdentifier, const char* message) {
+    struct ts3sdk_event_cell* cell;
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!enterQueue()) {
+        onTextMessageEvent(serverConnectionHandlerID, targetMode, toID, fromID, (char*)fromName, (char*)fromUniqueIdentifier, (char*)message);
+        return;
+    }
+    if ((cell = reserve(&pos)) == NULL)
+        return;
+    event = begin(&cell->event, TS3SDK_EVENT_TEXT_MESSAGE, serverConnectionHandlerID);
+    event->value = targetMode;
+    event->channelID = toID;
+    event->invokerID = fromID;
+    setStrings(event, fromName, fromUniqueIdentifier, message);
+    publish(cell, pos);
+}
+
+/* Never dropped, a lost server error would leave its request waiting for the timeout */
+static void queueServerErrorEvent(uint64 serverConnectionHandlerID, const char* errorMessage, unsigned int error, const char* returnCode, const char* extraMessage) {
+    struct ts3sdk_control_slot slot;
+    struct ts3sdk_event* event;
+
+    if (!enterQueue() || (event = reserveControl(&slot)) == NULL) {
+        onServerErrorEvent(serverConnectionHandlerID, (char*)errorMessage, error, (char*)returnCode, (char*)extraMessage);
+        return;
+    }
+    event = begin(event, TS3SDK_EVENT_SERVER_ERROR, serverConnectionHandlerID);
+    event->errorNumber = error;
+    setStrings(event, errorMessage, returnCode, extraMessage);
+    publishControl(&slot);
+}
+
+int ts3sdk_eventQueueEnter(void) {
+    return enterQueue();
+}
+
+struct ts3sdk_event* ts3sdk_eventQueueReserve(int kind, uint64 serverConnectionHandlerID, size_t* pos) {
+    struct ts3sdk_event_cell* cell;
+
+    if ((cell = reserve(pos)) == NULL)
+        return NULL;
+    return begin(&cell->event, kind, serverConnectionHandlerID);
+}
+
+void ts3sdk_eventQueueSetStrings(struct ts3sdk_event* event, const char* s0, const char* s1, const char* s2) {
+    setStrings(event, s0, s1, s2);
+}
+
+void ts3sdk_eventQueuePublish(size_t pos) {
+    publish(&cells[pos & mask], pos);
+}
+
+void ts3sdk_eventQueueFillCallbacks(struct ClientUIFunctions* funcs) {
+    funcs->onConnectStatusChangeEvent    = queueConnectStatusChangeEvent;
+    funcs->onServerProtocolVersionEvent  = queueServerProtocolVersionEvent;
+    funcs->onNewChannelEvent             = queueNewChannelEvent;
+    funcs->onNewChannelCreatedEvent      = queueNewChannelCreatedEvent;
+    funcs->onDelChannelEvent             = queueDelChannelEvent;
+    funcs->onChannelMoveEvent            = queueChannelMoveEvent;
+    funcs->onUpdateChannelEvent          = queueUpdateChannelEvent;
+    funcs->onUpdateChannelEditedEvent    = queueUpdateChannelEditedEvent;
+    funcs->onUpdateClientEvent           = queueUpdateClientEvent;
+    funcs->onClientMoveEvent             = queueClientMoveEvent;
+    funcs->onClientMoveSubscriptionEvent = queueClientMoveSubscriptionEvent;
+    funcs->onClientMoveTimeoutEvent      = queueClientMoveTimeoutEvent;
+    funcs->onTalkStatusChangeEvent       = queueTalkStatusChangeEvent;
+    funcs->onTextMessageEvent            = queueTextMessageEvent;
+    funcs->onServerErrorEvent            = queueServerErrorEvent;
+}
+
+/* Appends the nodes pushed since the last call to the consumer's FIFO, in the order they were pushed */
+static void takeOverflow(void) {
+    struct ts3sdk_event_overflow* node = atomic_exchange(&overflowHead, NULL);
+    struct ts3sdk_event_overflow* first = NULL;
+    struct ts3sdk_event_overflow* last = node;
+    struct ts3sdk_event_overflow* next;
+
+    for (; node != NULL; node = next) {
+        next = node->next;
+        node->next = first;
+        first = node;
+    }
+    if (first == NULL)
+        return;
+    if (overflowLast != NULL)
+        overflowLast->next = first;
+    else
+        overflowFirst = first;
+    overflowLast = last;
+}
+
+unsigned int ts3sdk_eventQueuePop(struct ts3sdk_event* out, unsigned int max) {
+    struct ts3sdk_event_cell* cell;
+    struct ts3sdk_event_overflow* node;
+    unsigned int count = 0;
+
+    if (cells == NULL)
+        return 0;
+
+    if (atomic_load_explicit(&overflowHead, memory_order_relaxed) != NULL)
+        takeOverflow();
+
+    while (count < max) {
+        /* an overflow node is due once the events queued before it are popped */
+        node = overflowFirst;
+        if (node != NULL && (ptrdiff_t)(node->pos - dequeuePos) <= 0) {
+            out[count++] = node->event;
+            if ((overflowFirst = node->next) == NULL)
+                overflowLast = NULL;
+            free(node);
+            continue;
+        }
+
+        cell = &cells[dequeuePos & mask];
+        if (atomic_load(&cell->sequence) != dequeuePos + 1)
+            break;
+
+        /* only copy the used part of the inline text */
+        memcpy(&out[count], &cell->event, offsetof(struct ts3sdk_event, text));
+        if (cell->event.heap == NULL)
+            memcpy(out[count].text, cell->event.text, (size_t)cell->event.stringLen[0] + cell->event.stringLen[1] + cell->event.stringLen[2]);
+
+        atomic_store_explicit(&cell->sequence, dequeuePos + mask + 1, memory_order_release);
+        ++dequeuePos;
+        ++count;
+    }
+    return count;
+}
+
+int ts3sdk_eventQueuePark(void) {
+    atomic_store(&parked, 1);
+    /* sequentially consistent like publish: a producer that missed parked published before this check */
+    if (atomic_load(&cells[dequeuePos & mask].sequence) != dequeuePos + 1 && overflowFirst == NULL && atomic_load(&overflowHead) == NULL)
+        return 1;
+    atomic_store(&parked, 0);
+    return 0;
+}
+
+void ts3sdk_eventQueueRelease(struct ts3sdk_event* events, unsigned int count) {
+    unsigned int i;
+
+    for (i = 0; i < count; ++i) {
+        free(events[i].heap);
+        events[i].heap = NULL;
+    }
+}
+
+unsigned long long ts3sdk_eventQueueDropped(void) {
+    return atomic_load_explicit(&dropped, memory_order_relaxed);
+}
+
+unsigned long long ts3sdk_eventQueueOverflowed(void) {
+    return atomic_load_explicit(&overflowed, memory_order_relaxed);
+}
@@ -0,0 +1,292 @@
+// Package ts3sdk provides Go bindings for the TeamSpeak 3 Client SDK.
+package ts3sdk
+
+/*
+#include <stdlib.h>
+#include <teamspeak/clientlib.h>
+#include <teamspeak/public_definitions.h>
+#include <teamspeak/public_errors.h>
+#include "eventqueue.h"
+*/
+import "C"
+import (
+	"sync/atomic"
+	"time"
+	"unsafe"
+)
+
+// EventQueueOptions configures batched event delivery
+type EventQueueOptions struct {
+	// Capacity is the number of events the C-side ring can hold, rounded up to a power of two.
+	// The ring is allocated by the first SetClientCallbacksBatched and kept, later capacities are ignored.
+	Capacity int
+	// BatchSize is the maximum number of events taken from the ring per cgo call
+	BatchSize int
+	// IdleInterval is how long the delivery goroutine waits for more events once the ring ran
+	// empty after a batch. If none arrived it parks until the next event wakes it.
+	IdleInterval time.Duration
+}
+
+// DefaultEventQueueOptions are used for zero fields of EventQueueOptions
+var DefaultEventQueueOptions = EventQueueOptions{
+	Capacity:     8192,
+	BatchSize:    256,
+	IdleInterval: time.Millisecond,
+}
+
+// EventQueueStats holds counters of the batched event delivery
+type EventQueueStats struct {
+	Delivered  uint64 // events handed to callbacks
+	Batches    uint64 // non-empty drains of the ring
+	Dropped    uint64 // events lost because the ring was full
+	Overflowed uint64 // status changes and server errors kept beside the full ring, never dropped
+}
+
+// State of the running event queue, guarded by callbacksMutex
+var (
+	eventQueueStop chan struct{}
+	eventQueueDone chan struct{}
+
+	eventQueueDelivered atomic.Uint64
+	eventQueueBatches   atomic.Uint64
+)
+
+// eventQueueWakeup wakes the parked delivery goroutine, see eventQueueWake
+var eventQueueWakeup = make(chan struct{}, 1)
+
+// SetClientCallbacksBatched sets the callback functions for TeamSpeak 3 events and delivers
+// them in batches. The SDK callbacks only record events into a C-side ring, a single
+// goroutine drains it and calls cb, so callbacks are never invoked concurrently.
+// The few ExtraCallbacks whose arguments don't fit a queued event are called directly on
+// the client lib threads, see ExtraCallbacks.
+func SetClientCallbacksBatched(cb Callbacks, opts EventQueueOptions) error {
+	callbacksMutex.Lock()
+	defer callbacksMutex.Unlock()
+
+	if opts.Capacity <= 0 {
+		opts.Capacity = DefaultEventQueueOptions.Capacity
+	}
+	if opts.BatchSize <= 0 {
+		opts.BatchSize = DefaultEventQueueOptions.BatchSize
+	}
+	if opts.IdleInterval <= 0 {
+		opts.IdleInterval = DefaultEventQueueOptions.IdleInterval
+	}
+
+	stopEventQueue()
+	callbacks.Store(&cb)
+
+	if C.ts3sdk_eventQueueInit(C.uint(opts.Capacity)) == 0 {
+		return ErrorOutOfMemory
+	}
+
+	eventQueueStop = make(chan struct{})
+	eventQueueDone = make(chan struct{})
+	go drainEventQueue(opts, eventQueueStop, eventQueueDone)
+	C.ts3sdk_eventQueueStart()
+
+	return nil
+}
+
+// StopEventQueue stops batched event delivery. Events still queued are delivered before it
+// returns, later events are delivered directly to the same callbacks. Events arriving while
+// it drains the queue may overtake queued ones.
+func StopEventQueue() {
+	callbacksMutex.Lock()
+	defer callbacksMutex.Unlock()
+
+	stopEventQueue()
+}
+
+// GetEventQueueStats returns the counters of the batched event delivery
+func GetEventQueueStats() EventQueueStats {
+	return EventQueueStats{
+		Delivered:  eventQueueDelivered.Load(),
+		Batches:    eventQueueBatches.Load(),
+		Dropped:    uint64(C.ts3sdk_eventQueueDropped()),
+		Overflowed: uint64(C.ts3sdk_eventQueueOverflowed()),
+	}
+}
+
+// stopEventQueue closes the gate of the ring and stops the delivery goroutine once it drained
+// the ring, callbacksMutex must be held. The ring is kept for the next start.
+func stopEventQueue() {
+	if eventQueueStop == nil {
+		return
+	}
+	C.ts3sdk_eventQueueStop() // no callback writes to the ring after this
+	close(eventQueueStop)
+	<-eventQueueDone
+	eventQueueStop, eventQueueDone = nil, nil
+}
+
+func drainEventQueue(opts EventQueueOptions, stop <-chan struct{}, done chan<- struct{}) {
+	defer close(done)
+
+	batch := make([]C.struct_ts3sdk_event, opts.BatchSize)
+	idle := time.NewTimer(opts.IdleInterval)
+	defer idle.Stop()
+
+	pop := func() int {
+		return int(C.ts3sdk_eventQueuePop(&batch[0], C.uint(len(batch))))
+	}
+	// deliver whatever arrived until stop, then quit
+	finish := func() {
+		for n := pop(); n > 0; n = pop() {
+			deliverEvents(batch[:n])
+		}
+	}
+
+	// poll while events keep arriving, park once they stopped
+	active := false
+	for {
+		if n := pop(); n > 0 {
+			deliverEvents(batch[:n])
+			active = true
+			continue
+		}
+		if active {
+			active = false
+			idle.Reset(opts.IdleInterval)
+			select {
+			case <-stop:
+				finish()
+				return
+			case <-idle.C:
+			}
+			continue
+		}
+		if C.ts3sdk_eventQueuePark() == 0 {
+			continue
+		}
+		select {
+		case <-stop:
+			finish()
+			return
+		case <-eventQueueWakeup:
+		}
+	}
+}
+
+// eventQueueWake is called by the first publish after the delivery goroutine parked
+//
+//export eventQueueWake
+func eventQueueWake() {
+	select {
+	case eventQueueWakeup <- struct{}{}:
+	default:
+	}
+}
+
+// deliverEvents hands a batch to the callbacks snapshot taken once per batch
+func deliverEvents(batch []C.struct_ts3sdk_event) {
+	cb := loadCallbacks()
+	onHeap := false
+	for i := range batch {
+		ev := &batch[i]
+		dispatchEvent(cb, ev)
+		onHeap = onHeap || ev.heap != nil
+	}
+	if onHeap {
+		C.ts3sdk_eventQueueRelease(&batch[0], C.uint(len(batch)))
+	}
+	eventQueueDelivered.Add(uint64(len(batch)))
+	eventQueueBatches.Add(1)
+}
+
+// eventStrings returns views of the packed strings of an event, valid until the batch is released
+func eventStrings(ev *C.struct_ts3sdk_event) (s [C.TS3SDK_EVENT_MAX_STRINGS][]byte) {
+	base := unsafe.Pointer(&ev.text[0])
+	if ev.heap != nil {
+		base = unsafe.Pointer(ev.heap)
+	}
+	offset := 0
+	for i := range s {
+		n := int(ev.stringLen[i])
+		s[i] = unsafe.Slice((*byte)(unsafe.Add(base, offset)), n)
+		offset += n
+	}
+	return s
+}
+
+func dispatchEvent(cb *Callbacks, ev *C.struct_ts3sdk_event) {
+	connectionID := ConnectionHandlerID(ev.serverConnectionHandlerID)
+
+	switch ev.kind {
+	case C.TS3SDK_EVENT_CONNECT_STATUS_CHANGE:
+		if ConnectStatus(ev.value) == StatusDisconnected {
+			failPendingRequests(connectionID, ErrorConnectionLost)
+		}
+		if cb.ConnectStatusChange != nil {
+			cb.ConnectStatusChange(connectionID, ConnectStatus(ev.value), Error(ev.errorNumber))
+		}
+	case C.TS3SDK_EVENT_SERVER_PROTOCOL_VERSION:
+		if cb.ServerProtocolVersion != nil {
+			cb.ServerProtocolVersion(connectionID, int(ev.value))
+		}
+	case C.TS3SDK_EVENT_NEW_CHANNEL:
+		if cb.NewChannel != nil {
+			cb.NewChannel(connectionID, ChannelID(ev.channelID), ChannelID(ev.otherChannelID))
+		}
+	case C.TS3SDK_EVENT_NEW_CHANNEL_CREATED:
+		if cb.NewChannelCreated != nil {
+			s := eventStrings(ev)
+			cb.NewChannelCreated(connectionID, ChannelID(ev.channelID), ChannelID(ev.otherChannelID), ClientID(ev.invokerID), internBytes(s[0]), internBytes(s[1]))
+		}
+	case C.TS3SDK_EVENT_DEL_CHANNEL:
+		if cb.DelChannel != nil {
+			s := eventStrings(ev)
+			cb.DelChannel(connectionID, ChannelID(ev.channelID), ClientID(ev.invokerID), internBytes(s[0]), internBytes(s[1]))
+		}
+	case C.TS3SDK_EVENT_CHANNEL_MOVE:
+		if cb.ChannelMove != nil {
+			s := eventStrings(ev)
+			cb.ChannelMove(connectionID, ChannelID(ev.channelID), ChannelID(ev.otherChannelID), ClientID(ev.invokerID), internBytes(s[0]), internBytes(s[1]))
+		}
+	case C.TS3SDK_EVENT_UPDATE_CHANNEL:
+		if cb.UpdateChannel != nil {
+			cb.UpdateChannel(connectionID, ChannelID(ev.channelID))
+		}
+	case C.TS3SDK_EVENT_UPDATE_CHANNEL_EDITED:
+		if cb.UpdateChannelEdited != nil {
+			s := eventStrings(ev)
+			cb.UpdateChannelEdited(connectionID, ChannelID(ev.channelID), ClientID(ev.invokerID), internBytes(s[0]), internBytes(s[1]))
+		}
+	case C.TS3SDK_EVENT_UPDATE_CLIENT:
+		if cb.UpdateClient != nil {
+			s := eventStrings(ev)
+			cb.UpdateClient(connectionID, ClientID(ev.clientID), ClientID(ev.invokerID), internBytes(s[0]), internBytes(s[1]))
+		}
+	case C.TS3SDK_EVENT_CLIENT_MOVE:
+		if cb.ClientMove != nil {
+			s := eventStrings(ev)
+			cb.ClientMove(connectionID, ClientID(ev.clientID), ChannelID(ev.channelID), ChannelID(ev.otherChannelID), int(ev.value), string(s[0]))
+		}
+	case C.TS3SDK_EVENT_CLIENT_MOVE_SUBSCRIPTION:
+		if cb.ClientMoveSubscription != nil {
+			cb.ClientMoveSubscription(connectionID, ClientID(ev.clientID), ChannelID(ev.channelID), ChannelID(ev.otherChannelID), int(ev.value))
+		}
+	case C.TS3SDK_EVENT_CLIENT_MOVE_TIMEOUT:
+		if cb.ClientMoveTimeout != nil {
+			s := eventStrings(ev)
+			cb.ClientMoveTimeout(connectionID, ClientID(ev.clientID), ChannelID(ev.channelID), ChannelID(ev.otherChannelID), int(ev.value), string(s[0]))
+		}
+	case C.TS3SDK_EVENT_TALK_STATUS_CHANGE:
+		if cb.TalkStatusChange != nil {
+			cb.TalkStatusChange(connectionID, int(ev.value), int(ev.flag), ClientID(ev.clientID))
+		}
+	case C.TS3SDK_EVENT_TEXT_MESSAGE:
+		if cb.TextMessage != nil {
+			s := eventStrings(ev)
+			cb.TextMessage(connectionID, int(ev.value), uint64(ev.channelID), ClientID(ev.invokerID), internBytes(s[0]), internBytes(s[1]), string(s[2]))
+		}
+	case C.TS3SDK_EVENT_SERVER_ERROR:
+		s := eventStrings(ev)
+		completeRequest(s[1], Error(ev.errorNumber))
+		if cb.ServerError != nil {
+			cb.ServerError(connectionID, string(s[0]), Error(ev.errorNumber), string(s[1]), string(s[2]))
+		}
+	default:
+		dispatchExtraEvent(cb, ev)
+	}
+}
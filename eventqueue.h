@@ -0,0 +1,94 @@
+#ifndef TS3SDK_EVENTQUEUE_H
+#define TS3SDK_EVENTQUEUE_H
+
+#include <stddef.h>
+#include <teamspeak/clientlib.h>
+#include <teamspeak/public_definitions.h>
+
+/* Size of the inline string storage of a queued event. Strings that don't fit are moved to the heap. */
+#define TS3SDK_EVENT_TEXT_SIZE 256
+#define TS3SDK_EVENT_MAX_STRINGS 3
+
+enum ts3sdk_event_kind {
+    TS3SDK_EVENT_NONE = 0,
+    TS3SDK_EVENT_CONNECT_STATUS_CHANGE,
+    TS3SDK_EVENT_SERVER_PROTOCOL_VERSION,
+    TS3SDK_EVENT_NEW_CHANNEL,
+    TS3SDK_EVENT_NEW_CHANNEL_CREATED,
+    TS3SDK_EVENT_DEL_CHANNEL,
+    TS3SDK_EVENT_CHANNEL_MOVE,
+    TS3SDK_EVENT_UPDATE_CHANNEL,
+    TS3SDK_EVENT_UPDATE_CHANNEL_EDITED,
+    TS3SDK_EVENT_UPDATE_CLIENT,
+    TS3SDK_EVENT_CLIENT_MOVE,
+    TS3SDK_EVENT_CLIENT_MOVE_SUBSCRIPTION,
+    TS3SDK_EVENT_CLIENT_MOVE_TIMEOUT,
+    TS3SDK_EVENT_TALK_STATUS_CHANGE,
+    TS3SDK_EVENT_TEXT_MESSAGE,
+    TS3SDK_EVENT_SERVER_ERROR,
+    TS3SDK_EVENT_EXTRA /* first kind of the generated events, see eventqueue_gen.h */
+};
+
+/*
+ * A single SDK event as recorded by the queueing callbacks.
+ *
+ * channelID      - channelID, oldChannelID or toID depending on the event
+ * otherChannelID - channelParentID, newChannelParentID or newChannelID
+ * extra          - further uint64 arguments of generated events
+ * value          - newStatus, protocolVersion, visibility, talk status or targetMode
+ * flag           - isReceivedWhisper
+ * errorNumber    - errorNumber or error
+ * strings        - up to TS3SDK_EVENT_MAX_STRINGS strings packed back to back (no terminators)
+ *                  into text, or into heap if they don't fit. heap must be released with
+ *                  ts3sdk_eventQueueRelease.
+ */
+struct ts3sdk_event {
+    int kind;
+    int value;
+    int flag;
+    unsigned int errorNumber;
+    uint64 serverConnectionHandlerID;
+    uint64 channelID;
+    uint64 otherChannelID;
+    uint64 extra[2];
+    anyID clientID;
+    anyID invokerID;
+    unsigned short stringLen[TS3SDK_EVENT_MAX_STRINGS];
+    char* heap;
+    char text[TS3SDK_EVENT_TEXT_SIZE];
+};
+
+/* Allocates the ring on the first call, later calls keep it. capacity is rounded up to a power of two. Returns 0 on failure. */
+int ts3sdk_eventQueueInit(unsigned int capacity);
+
+/* Opens the gate, the callbacks record events into the ring from now on */
+void ts3sdk_eventQueueStart(void);
+/* Closes the gate and waits until no callback writes to the ring anymore. Later events go to Go directly,
+   the events in the ring stay there until popped. */
+void ts3sdk_eventQueueStop(void);
+
+/* Points the callbacks handled by the queue at functions that record the events into the ring
+   while the gate is open and call the exported Go functions otherwise */
+void ts3sdk_eventQueueFillCallbacks(struct ClientUIFunctions* funcs);
+
+/* For the queueing callbacks generated into eventqueue_gen.c, used like the hand-written ones:
+   if ts3sdk_eventQueueEnter fails call Go directly, else reserve an event (NULL if the ring is full),
+   fill it in and publish it. */
+int ts3sdk_eventQueueEnter(void);
+struct ts3sdk_event* ts3sdk_eventQueueReserve(int kind, uint64 serverConnectionHandlerID, size_t* pos);
+void ts3sdk_eventQueueSetStrings(struct ts3sdk_event* event, const char* s0, const char* s1, const char* s2);
+void ts3sdk_eventQueuePublish(size_t pos);
+
+/* Single consumer: moves up to max events into out, returns the number of events moved */
+unsigned int ts3sdk_eventQueuePop(struct ts3sdk_event* out, unsigned int max);
+void ts3sdk_eventQueueRelease(struct ts3sdk_event* events, unsigned int count);
+
+/* Single consumer, after a pop came back empty: returns 1 if the queue is still empty, the next
+   publish then calls the exported eventQueueWake once. Returns 0 if events arrived meanwhile. */
+int ts3sdk_eventQueuePark(void);
+
+unsigned long long ts3sdk_eventQueueDropped(void);
+/* Control events kept beside the full ring instead of dropped */
+unsigned long long ts3sdk_eventQueueOverflowed(void);
+
+#endif
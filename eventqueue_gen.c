@@ -0,0 +1,428 @@
+/* Code generated by ts3gen from clientlib.h. DO NOT EDIT. */
+
+/*
+ * Queueing callbacks of the generated events, recording into the ring of eventqueue.c
+ * while its gate is open and calling the exported Go functions otherwise.
+ */
+
+#include "eventqueue_gen.h"
+#include "_cgo_export.h"
+
+static void queueClientMoveMovedEvent(uint64 serverConnectionHandlerID, anyID clientID, uint64 oldChannelID, uint64 newChannelID, int visibility, anyID moverID, const char* moverName, const char* moverUniqueIdentifier, const char* moveMessage) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onClientMoveMovedEvent(serverConnectionHandlerID, clientID, oldChannelID, newChannelID, visibility, moverID, (char*)moverName, (char*)moverUniqueIdentifier, (char*)moveMessage);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_CLIENT_MOVE_MOVED, serverConnectionHandlerID, &pos)) == NULL)
+        return;
+    event->clientID = clientID;
+    event->channelID = oldChannelID;
+    event->otherChannelID = newChannelID;
+    event->value = visibility;
+    event->invokerID = moverID;
+    ts3sdk_eventQueueSetStrings(event, moverName, moverUniqueIdentifier, moveMessage);
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queueClientKickFromChannelEvent(uint64 serverConnectionHandlerID, anyID clientID, uint64 oldChannelID, uint64 newChannelID, int visibility, anyID kickerID, const char* kickerName, const char* kickerUniqueIdentifier, const char* kickMessage) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onClientKickFromChannelEvent(serverConnectionHandlerID, clientID, oldChannelID, newChannelID, visibility, kickerID, (char*)kickerName, (char*)kickerUniqueIdentifier, (char*)kickMessage);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_CLIENT_KICK_FROM_CHANNEL, serverConnectionHandlerID, &pos)) == NULL)
+        return;
+    event->clientID = clientID;
+    event->channelID = oldChannelID;
+    event->otherChannelID = newChannelID;
+    event->value = visibility;
+    event->invokerID = kickerID;
+    ts3sdk_eventQueueSetStrings(event, kickerName, kickerUniqueIdentifier, kickMessage);
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queueClientKickFromServerEvent(uint64 serverConnectionHandlerID, anyID clientID, uint64 oldChannelID, uint64 newChannelID, int visibility, anyID kickerID, const char* kickerName, const char* kickerUniqueIdentifier, const char* kickMessage) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onClientKickFromServerEvent(serverConnectionHandlerID, clientID, oldChannelID, newChannelID, visibility, kickerID, (char*)kickerName, (char*)kickerUniqueIdentifier, (char*)kickMessage);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_CLIENT_KICK_FROM_SERVER, serverConnectionHandlerID, &pos)) == NULL)
+        return;
+    event->clientID = clientID;
+    event->channelID = oldChannelID;
+    event->otherChannelID = newChannelID;
+    event->value = visibility;
+    event->invokerID = kickerID;
+    ts3sdk_eventQueueSetStrings(event, kickerName, kickerUniqueIdentifier, kickMessage);
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queueClientIDsEvent(uint64 serverConnectionHandlerID, const char* uniqueClientIdentifier, anyID clientID, const char* clientName) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onClientIDsEvent(serverConnectionHandlerID, (char*)uniqueClientIdentifier, clientID, (char*)clientName);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_CLIENT_IDS, serverConnectionHandlerID, &pos)) == NULL)
+        return;
+    event->clientID = clientID;
+    ts3sdk_eventQueueSetStrings(event, uniqueClientIdentifier, clientName, NULL);
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queueClientIDsFinishedEvent(uint64 serverConnectionHandlerID) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onClientIDsFinishedEvent(serverConnectionHandlerID);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_CLIENT_IDS_FINISHED, serverConnectionHandlerID, &pos)) == NULL)
+        return;
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queueServerEditedEvent(uint64 serverConnectionHandlerID, anyID editerID, const char* editerName, const char* editerUniqueIdentifier) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onServerEditedEvent(serverConnectionHandlerID, editerID, (char*)editerName, (char*)editerUniqueIdentifier);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_SERVER_EDITED, serverConnectionHandlerID, &pos)) == NULL)
+        return;
+    event->clientID = editerID;
+    ts3sdk_eventQueueSetStrings(event, editerName, editerUniqueIdentifier, NULL);
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queueServerUpdatedEvent(uint64 serverConnectionHandlerID) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onServerUpdatedEvent(serverConnectionHandlerID);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_SERVER_UPDATED, serverConnectionHandlerID, &pos)) == NULL)
+        return;
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queueServerStopEvent(uint64 serverConnectionHandlerID, const char* shutdownMessage) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onServerStopEvent(serverConnectionHandlerID, (char*)shutdownMessage);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_SERVER_STOP, serverConnectionHandlerID, &pos)) == NULL)
+        return;
+    ts3sdk_eventQueueSetStrings(event, shutdownMessage, NULL, NULL);
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queueIgnoredWhisperEvent(uint64 serverConnectionHandlerID, anyID clientID) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onIgnoredWhisperEvent(serverConnectionHandlerID, clientID);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_IGNORED_WHISPER, serverConnectionHandlerID, &pos)) == NULL)
+        return;
+    event->clientID = clientID;
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queueConnectionInfoEvent(uint64 serverConnectionHandlerID, anyID clientID) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onConnectionInfoEvent(serverConnectionHandlerID, clientID);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_CONNECTION_INFO, serverConnectionHandlerID, &pos)) == NULL)
+        return;
+    event->clientID = clientID;
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queueServerConnectionInfoEvent(uint64 serverConnectionHandlerID) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onServerConnectionInfoEvent(serverConnectionHandlerID);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_SERVER_CONNECTION_INFO, serverConnectionHandlerID, &pos)) == NULL)
+        return;
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queueChannelSubscribeEvent(uint64 serverConnectionHandlerID, uint64 channelID) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onChannelSubscribeEvent(serverConnectionHandlerID, channelID);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_CHANNEL_SUBSCRIBE, serverConnectionHandlerID, &pos)) == NULL)
+        return;
+    event->channelID = channelID;
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queueChannelSubscribeFinishedEvent(uint64 serverConnectionHandlerID) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onChannelSubscribeFinishedEvent(serverConnectionHandlerID);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_CHANNEL_SUBSCRIBE_FINISHED, serverConnectionHandlerID, &pos)) == NULL)
+        return;
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queueChannelUnsubscribeEvent(uint64 serverConnectionHandlerID, uint64 channelID) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onChannelUnsubscribeEvent(serverConnectionHandlerID, channelID);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_CHANNEL_UNSUBSCRIBE, serverConnectionHandlerID, &pos)) == NULL)
+        return;
+    event->channelID = channelID;
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queueChannelUnsubscribeFinishedEvent(uint64 serverConnectionHandlerID) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onChannelUnsubscribeFinishedEvent(serverConnectionHandlerID);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_CHANNEL_UNSUBSCRIBE_FINISHED, serverConnectionHandlerID, &pos)) == NULL)
+        return;
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queueChannelDescriptionUpdateEvent(uint64 serverConnectionHandlerID, uint64 channelID) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onChannelDescriptionUpdateEvent(serverConnectionHandlerID, channelID);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_CHANNEL_DESCRIPTION_UPDATE, serverConnectionHandlerID, &pos)) == NULL)
+        return;
+    event->channelID = channelID;
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queueChannelPasswordChangedEvent(uint64 serverConnectionHandlerID, uint64 channelID) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onChannelPasswordChangedEvent(serverConnectionHandlerID, channelID);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_CHANNEL_PASSWORD_CHANGED, serverConnectionHandlerID, &pos)) == NULL)
+        return;
+    event->channelID = channelID;
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queuePlaybackShutdownCompleteEvent(uint64 serverConnectionHandlerID) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onPlaybackShutdownCompleteEvent(serverConnectionHandlerID);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_PLAYBACK_SHUTDOWN_COMPLETE, serverConnectionHandlerID, &pos)) == NULL)
+        return;
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queueSoundDeviceListChangedEvent(const char* modeID, int playOrCap) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onSoundDeviceListChangedEvent((char*)modeID, playOrCap);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_SOUND_DEVICE_LIST_CHANGED, 0, &pos)) == NULL)
+        return;
+    event->value = playOrCap;
+    ts3sdk_eventQueueSetStrings(event, modeID, NULL, NULL);
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queueProvisioningSlotRequestResultEvent(unsigned int error, uint64 requestHandle, const char* connectionKey) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onProvisioningSlotRequestResultEvent(error, requestHandle, (char*)connectionKey);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_PROVISIONING_SLOT_REQUEST_RESULT, 0, &pos)) == NULL)
+        return;
+    event->errorNumber = error;
+    event->channelID = requestHandle;
+    ts3sdk_eventQueueSetStrings(event, connectionKey, NULL, NULL);
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queueFileTransferStatusEvent(anyID transferID, unsigned int status, const char* statusMessage, uint64 remotefileSize, uint64 serverConnectionHandlerID) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onFileTransferStatusEvent(transferID, status, (char*)statusMessage, remotefileSize, serverConnectionHandlerID);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_FILE_TRANSFER_STATUS, serverConnectionHandlerID, &pos)) == NULL)
+        return;
+    event->clientID = transferID;
+    event->errorNumber = status;
+    event->channelID = remotefileSize;
+    ts3sdk_eventQueueSetStrings(event, statusMessage, NULL, NULL);
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queueFileListEvent(uint64 serverConnectionHandlerID, uint64 channelID, const char* path, const char* name, uint64 size, uint64 datetime, int type, uint64 incompletesize, const char* returnCode) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onFileListEvent(serverConnectionHandlerID, channelID, (char*)path, (char*)name, size, datetime, type, incompletesize, (char*)returnCode);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_FILE_LIST, serverConnectionHandlerID, &pos)) == NULL)
+        return;
+    event->channelID = channelID;
+    event->otherChannelID = size;
+    event->extra[0] = datetime;
+    event->value = type;
+    event->extra[1] = incompletesize;
+    ts3sdk_eventQueueSetStrings(event, path, name, returnCode);
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queueFileListFinishedEvent(uint64 serverConnectionHandlerID, uint64 channelID, const char* path) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onFileListFinishedEvent(serverConnectionHandlerID, channelID, (char*)path);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_FILE_LIST_FINISHED, serverConnectionHandlerID, &pos)) == NULL)
+        return;
+    event->channelID = channelID;
+    ts3sdk_eventQueueSetStrings(event, path, NULL, NULL);
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queueFileInfoEvent(uint64 serverConnectionHandlerID, uint64 channelID, const char* name, uint64 size, uint64 datetime) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onFileInfoEvent(serverConnectionHandlerID, channelID, (char*)name, size, datetime);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_FILE_INFO, serverConnectionHandlerID, &pos)) == NULL)
+        return;
+    event->channelID = channelID;
+    event->otherChannelID = size;
+    event->extra[0] = datetime;
+    ts3sdk_eventQueueSetStrings(event, name, NULL, NULL);
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queueChatLoginTokenEvent(uint64 serverConnectionHandlerID, const char* token) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onChatLoginTokenEvent(serverConnectionHandlerID, (char*)token);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_CHAT_LOGIN_TOKEN, serverConnectionHandlerID, &pos)) == NULL)
+        return;
+    ts3sdk_eventQueueSetStrings(event, token, NULL, NULL);
+    ts3sdk_eventQueuePublish(pos);
+}
+
+static void queueAuthenticationTokenEvent(uint64 serverConnectionHandlerID, const char* token) {
+    struct ts3sdk_event* event;
+    size_t pos;
+
+    if (!ts3sdk_eventQueueEnter()) {
+        onAuthenticationTokenEvent(serverConnectionHandlerID, (char*)token);
+        return;
+    }
+    if ((event = ts3sdk_eventQueueReserve(TS3SDK_EVENT_AUTHENTICATION_TOKEN, serverConnectionHandlerID, &pos)) == NULL)
+        return;
+    ts3sdk_eventQueueSetStrings(event, token, NULL, NULL);
+    ts3sdk_eventQueuePublish(pos);
+}
+
+void ts3sdk_eventQueueFillExtraCallbacks(struct ClientUIFunctions* funcs) {
+    funcs->onClientMoveMovedEvent = queueClientMoveMovedEvent;
+    funcs->onClientKickFromChannelEvent = queueClientKickFromChannelEvent;
+    funcs->onClientKickFromServerEvent = queueClientKickFromServerEvent;
+    funcs->onClientIDsEvent = queueClientIDsEvent;
+    funcs->onClientIDsFinishedEvent = queueClientIDsFinishedEvent;
+    funcs->onServerEditedEvent = queueServerEditedEvent;
+    funcs->onServerUpdatedEvent = queueServerUpdatedEvent;
+    funcs->onServerStopEvent = queueServerStopEvent;
+    funcs->onIgnoredWhisperEvent = queueIgnoredWhisperEvent;
+    funcs->onConnectionInfoEvent = queueConnectionInfoEvent;
+    funcs->onServerConnectionInfoEvent = queueServerConnectionInfoEvent;
+    funcs->onChannelSubscribeEvent = queueChannelSubscribeEvent;
+    funcs->onChannelSubscribeFinishedEvent = queueChannelSubscribeFinishedEvent;
+    funcs->onChannelUnsubscribeEvent = queueChannelUnsubscribeEvent;
+    funcs->onChannelUnsubscribeFinishedEvent = queueChannelUnsubscribeFinishedEvent;
+    funcs->onChannelDescriptionUpdateEvent = queueChannelDescriptionUpdateEvent;
+    funcs->onChannelPasswordChangedEvent = queueChannelPasswordChangedEvent;
+    funcs->onPlaybackShutdownCompleteEvent = queuePlaybackShutdownCompleteEvent;
+    funcs->onSoundDeviceListChangedEvent = queueSoundDeviceListChangedEvent;
+    funcs->onProvisioningSlotRequestResultEvent = queueProvisioningSlotRequestResultEvent;
+    funcs->onFileTransferStatusEvent = queueFileTransferStatusEvent;
+    funcs->onFileListEvent = queueFileListEvent;
+    funcs->onFileListFinishedEvent = queueFileListFinishedEvent;
+    funcs->onFileInfoEvent = queueFileInfoEvent;
+    funcs->onChatLoginTokenEvent = queueChatLoginTokenEvent;
+    funcs->onAuthenticationTokenEvent = queueAuthenticationTokenEvent;
+}
@@ -0,0 +1,41 @@
+/* Code generated by ts3gen from clientlib.h. DO NOT EDIT. */
+
+#ifndef TS3SDK_EVENTQUEUE_GEN_H
+#define TS3SDK_EVENTQUEUE_GEN_H
+
+#include "eventqueue.h"
+
+/* Kinds of the queued events of the generated callbacks */
+enum ts3sdk_extra_event_kind {
+    TS3SDK_EVENT_CLIENT_MOVE_MOVED = TS3SDK_EVENT_EXTRA,
+    TS3SDK_EVENT_CLIENT_KICK_FROM_CHANNEL,
+    TS3SDK_EVENT_CLIENT_KICK_FROM_SERVER,
+    TS3SDK_EVENT_CLIENT_IDS,
+    TS3SDK_EVENT_CLIENT_IDS_FINISHED,
+    TS3SDK_EVENT_SERVER_EDITED,
+    TS3SDK_EVENT_SERVER_UPDATED,
+    TS3SDK_EVENT_SERVER_STOP,
+    TS3SDK_EVENT_IGNORED_WHISPER,
+    TS3SDK_EVENT_CONNECTION_INFO,
+    TS3SDK_EVENT_SERVER_CONNECTION_INFO,
+    TS3SDK_EVENT_CHANNEL_SUBSCRIBE,
+    TS3SDK_EVENT_CHANNEL_SUBSCRIBE_FINISHED,
+    TS3SDK_EVENT_CHANNEL_UNSUBSCRIBE,
+    TS3SDK_EVENT_CHANNEL_UNSUBSCRIBE_FINISHED,
+    TS3SDK_EVENT_CHANNEL_DESCRIPTION_UPDATE,
+    TS3SDK_EVENT_CHANNEL_PASSWORD_CHANGED,
+    TS3SDK_EVENT_PLAYBACK_SHUTDOWN_COMPLETE,
+    TS3SDK_EVENT_SOUND_DEVICE_LIST_CHANGED,
+    TS3SDK_EVENT_PROVISIONING_SLOT_REQUEST_RESULT,
+    TS3SDK_EVENT_FILE_TRANSFER_STATUS,
+    TS3SDK_EVENT_FILE_LIST,
+    TS3SDK_EVENT_FILE_LIST_FINISHED,
+    TS3SDK_EVENT_FILE_INFO,
+    TS3SDK_EVENT_CHAT_LOGIN_TOKEN,
+    TS3SDK_EVENT_AUTHENTICATION_TOKEN,
+};
+
+/* Points the generated callbacks that can be queued at their queueing functions */
+void ts3sdk_eventQueueFillExtraCallbacks(struct ClientUIFunctions* funcs);
+
+#endif
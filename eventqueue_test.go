@@ -0,0 +1,249 @@
+//go:build ts3stub
+
+package ts3sdk
+
+import (
+	"sync"
+	"sync/atomic"
+	"testing"
+	"time"
+
+	"github.com/Piekario/ts3sdk/internal/ts3stub"
+)
+
+// The ring is allocated by the first start, so all tests use the same options
+var testQueueOptions = EventQueueOptions{Capacity: 1 << 16}
+
+// countingCallbacks counts the events ts3stub.Fire raises
+func countingCallbacks(delivered *atomic.Int64) Callbacks {
+	return Callbacks{
+		ClientMove: func(ConnectionHandlerID, ClientID, ChannelID, ChannelID, int, string) {
+			delivered.Add(1)
+		},
+		UpdateClient: func(ConnectionHandlerID, ClientID, ClientID, string, string) {
+			delivered.Add(1)
+		},
+		TalkStatusChange: func(ConnectionHandlerID, int, int, ClientID) {
+			delivered.Add(1)
+		},
+	}
+}
+
+func TestEventQueueStop(t *testing.T) {
+	var delivered atomic.Int64
+	defer SetClientCallbacks(Callbacks{})
+
+	for round := 0; round < 3; round++ {
+		delivered.Store(0)
+		dropped := GetEventQueueStats().Dropped
+		if err := SetClientCallbacksBatched(countingCallbacks(&delivered), testQueueOptions); err != nil {
+			t.Fatal(err)
+		}
+		ts3stub.Fire(ts3stub.ClientMove, 1, 10000)
+		StopEventQueue()
+		if n := delivered.Load() + int64(GetEventQueueStats().Dropped-dropped); n != 10000 {
+			t.Fatalf("round %d: %d of 10000 queued events delivered or dropped after StopEventQueue", round, n)
+		}
+
+		ts3stub.Fire(ts3stub.UpdateClient, 1, 100)
+		if n := delivered.Load() + int64(GetEventQueueStats().Dropped-dropped); n != 10100 {
+			t.Fatalf("round %d: %d of 100 events delivered directly after StopEventQueue", round, n-10000)
+		}
+	}
+}
+
+// Every event is delivered or counted as dropped while the queue is started and stopped
+// under a stream of events
+func TestEventQueueRestartUnderLoad(t *testing.T) {
+	var delivered atomic.Int64
+	defer SetClientCallbacks(Callbacks{})
+	dropped := GetEventQueueStats().Dropped
+
+	var wg sync.WaitGroup
+	stop := make(chan struct{})
+	var fired atomic.Int64
+	for i := 0; i < 4; i++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			for {
+				select {
+				case <-stop:
+					return
+				default:
+				}
+				ts3stub.Fire(ts3stub.TalkStatusChange, 1, 1000)
+				fired.Add(1000)
+			}
+		}()
+	}
+
+	for i := 0; i < 50; i++ {
+		var err error
+		if i%2 == 0 {
+			err = SetClientCallbacksBatched(countingCallbacks(&delivered), testQueueOptions)
+		} else {
+			err = SetClientCallbacks(countingCallbacks(&delivered))
+		}
+		if err != nil {
+			t.Fatal(err)
+		}
+		time.Sleep(time.Millisecond)
+	}
+	close(stop)
+	wg.Wait()
+	StopEventQueue()
+
+	if n := delivered.Load() + int64(GetEventQueueStats().Dropped-dropped); n != fired.Load() {
+		t.Fatalf("%d of %d events delivered or dropped", n, fired.Load())
+	}
+}
+
+// A status change raised while the ring is full is kept beside it instead of dropped and
+// delivered after the events queued before it
+func TestEventQueueFullKeepsStatusChange(t *testing.T) {
+	var moves, statusAt atomic.Int64
+	defer SetClientCallbacks(Callbacks{})
+
+	release := make(chan struct{})
+	statusAt.Store(-1)
+	cb := Callbacks{
+		ClientMove: func(ConnectionHandlerID, ClientID, ChannelID, ChannelID, int, string) {
+			if moves.Add(1) == 1 {
+				<-release // stall the consumer until the ring is full
+			}
+		},
+		ConnectStatusChange: func(conn ConnectionHandlerID, status ConnectStatus, err Error) {
+			if conn == 3 && status == StatusDisconnected && err == ErrorConnectionLost {
+				statusAt.Store(moves.Load())
+			}
+		},
+	}
+	if err := SetClientCallbacksBatched(cb, testQueueOptions); err != nil {
+		t.Fatal(err)
+	}
+	before := GetEventQueueStats()
+
+	// the consumer holds at most one batch, so this fills the ring whenever it stalls
+	fired := testQueueOptions.Capacity + 1000
+	ts3stub.Fire(ts3stub.ClientMove, 3, fired)
+	ts3stub.Fire(ts3stub.ConnectionLost, 3, 1)
+	after := GetEventQueueStats()
+	close(release)
+	StopEventQueue()
+
+	if after.Dropped == before.Dropped {
+		t.Fatal("the ring never ran full")
+	}
+	if n := after.Overflowed - before.Overflowed; n != 1 {
+		t.Errorf("%d of 1 status changes kept beside the full ring", n)
+	}
+	if n := moves.Load() + int64(after.Dropped-before.Dropped); n != int64(fired) {
+		t.Errorf("%d of %d moves delivered or dropped", n, fired)
+	}
+	if at := statusAt.Load(); at != moves.Load() {
+		t.Errorf("status change delivered after %d of the %d moves queued before it", at, moves.Load())
+	}
+}
+
+// A parked consumer is woken by the next event
+func TestEventQueueWakeup(t *testing.T) {
+	var delivered atomic.Int64
+	defer SetClientCallbacks(Callbacks{})
+
+	if err := SetClientCallbacksBatched(countingCallbacks(&delivered), testQueueOptions); err != nil {
+		t.Fatal(err)
+	}
+	defer StopEventQueue()
+
+	for i := int64(1); i <= 3; i++ {
+		time.Sleep(20 * time.Millisecond) // long past the idle interval, the consumer parked
+		ts3stub.Fire(ts3stub.TalkStatusChange, 1, 1)
+		deadline := time.Now().Add(5 * time.Second)
+		for delivered.Load() < i {
+			if time.Now().After(deadline) {
+				t.Fatalf("event %d not delivered to the parked consumer", i)
+			}
+			time.Sleep(100 * time.Microsecond)
+		}
+	}
+}
+
+// Events raised on a C thread, delivered per event through cgo or in batches through the ring.
+// Batched numbers include the time until the events were delivered.
+func BenchmarkEventDelivery(b *testing.B) {
+	var delivered atomic.Int64
+	defer SetClientCallbacks(Callbacks{})
+
+	events := []struct {
+		name  string
+		event ts3stub.Event
+	}{
+		{"ClientMove", ts3stub.ClientMove},
+		{"UpdateClient", ts3stub.UpdateClient},
+		{"TalkStatusChange", ts3stub.TalkStatusChange},
+	}
+	for _, e := range events {
+		b.Run("Direct/"+e.name, func(b *testing.B) {
+			if err := SetClientCallbacks(countingCallbacks(&delivered)); err != nil {
+				b.Fatal(err)
+			}
+			delivered.Store(0)
+			b.ReportAllocs()
+			b.ResetTimer()
+			ts3stub.Fire(e.event, 1, b.N)
+		})
+		b.Run("Batched/"+e.name, func(b *testing.B) {
+			if err := SetClientCallbacksBatched(countingCallbacks(&delivered), testQueueOptions); err != nil {
+				b.Fatal(err)
+			}
+			defer StopEventQueue()
+			delivered.Store(0)
+			dropped := GetEventQueueStats().Dropped
+			b.ReportAllocs()
+			b.ResetTimer()
+			// in chunks of a quarter of the ring, so the events are delivered rather than dropped
+			for fired := 0; fired < b.N; {
+				chunk := min(b.N-fired, testQueueOptions.Capacity/4)
+				ts3stub.Fire(e.event, 1, chunk)
+				fired += chunk
+				for delivered.Load()+int64(GetEventQueueStats().Dropped-dropped) < int64(fired) {
+					time.Sleep(10 * time.Microsecond)
+				}
+			}
+			b.StopTimer()
+			b.ReportMetric(float64(GetEventQueueStats().Dropped-dropped)/float64(b.N), "dropped/op")
+		})
+	}
+}
+
+// The generated callbacks are queued like the hand-written ones
+func TestEventQueueExtraCallbacks(t *testing.T) {
+	var delivered atomic.Int64
+	var message atomic.Value
+	defer SetClientCallbacks(Callbacks{})
+
+	cb := Callbacks{}
+	cb.ClientKickFromServer = func(conn ConnectionHandlerID, clientID ClientID, oldChannelID, newChannelID ChannelID, visibility int, kickerID ClientID, kickerName, kickerUniqueIdentifier, kickMessage string) {
+		if conn == 7 && oldChannelID == 1 && visibility == LeaveVisibility && kickerName == "ServerAdmin" {
+			delivered.Add(1)
+		}
+		message.Store(kickMessage)
+	}
+	if err := SetClientCallbacksBatched(cb, testQueueOptions); err != nil {
+		t.Fatal(err)
+	}
+	before := GetEventQueueStats().Delivered
+	ts3stub.Fire(ts3stub.ClientKickFromServer, 7, 100)
+	StopEventQueue()
+
+	if n := GetEventQueueStats().Delivered - before; n != 100 {
+		t.Errorf("%d of 100 generated events went through the queue", n)
+	}
+	if n := delivered.Load(); n != 100 {
+		t.Errorf("%d of 100 generated events delivered with their arguments", n)
+	}
+	if m := message.Load(); m != "kicked" {
+		t.Errorf("kick message %q", m)
+	}
+}
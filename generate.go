@@ -0,0 +1,7 @@
+package ts3sdk
+
+// ts3client_gen.go binds the functions, callbacks and enums of the SDK headers
+// that have no hand-written binding, eventqueue_gen.c and eventqueue_gen.h queue
+// the generated callbacks, internal/ts3stub/clientlib_gen.c stubs every function
+// of clientlib.h for the tests. Regenerate them after updating the SDK.
+//go:generate go run ./internal/ts3gen -include ts_sdk_3.3.1/include -out ts3client_gen.go -queue eventqueue_gen.c -stub internal/ts3stub/clientlib_gen.c
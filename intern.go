@@ -0,0 +1,113 @@
+// Package ts3sdk provides Go bindings for the TeamSpeak 3 Client SDK.
+package ts3sdk
+
+/*
+#include <stdlib.h>
+*/
+import "C"
+import (
+	"hash/maphash"
+	"sync/atomic"
+	"unsafe"
+)
+
+// Invoker names and unique identifiers repeat across events. They are
+// looked up by their bytes in a bounded table, so a hit returns the shared
+// Go string without allocating.
+//
+// A string hashes to a pair of slots and a miss replaces one of them, a free
+// one if there is one. Slots are atomic pointers and count their own hits, so
+// lookups from any number of SDK threads take no lock and don't share a counter.
+const (
+	internSlots     = 4096 // power of two
+	internMaxLength = 256  // longer strings are copied, not interned
+)
+
+// InternStats holds counters of the event string intern table
+type InternStats struct {
+	Hits    uint64
+	Misses  uint64
+	Entries int
+}
+
+type internSlot struct {
+	s    atomic.Pointer[string]
+	hits atomic.Uint64
+}
+
+var interned struct {
+	seed    maphash.Seed
+	slots   [internSlots]internSlot
+	entries atomic.Int64
+	misses  atomic.Uint64
+}
+
+func init() {
+	interned.seed = maphash.MakeSeed()
+}
+
+// internBytes returns a shared string equal to b
+func internBytes(b []byte) string {
+	if len(b) == 0 {
+		return ""
+	}
+	if len(b) > internMaxLength {
+		return string(b)
+	}
+
+	h := maphash.Bytes(interned.seed, b)
+	pair := interned.slots[h&(internSlots-2):][:2]
+	var old [2]*string
+	for i := range pair {
+		old[i] = pair[i].s.Load()
+		// the compiler doesn't allocate for string(b) in a comparison
+		if old[i] != nil && *old[i] == string(b) {
+			pair[i].hits.Add(1)
+			return *old[i]
+		}
+	}
+
+	interned.misses.Add(1)
+	victim := int(h>>32) & 1
+	if old[0] == nil || old[1] == nil {
+		victim = 1
+		if old[0] == nil {
+			victim = 0
+		}
+	}
+	s := string(b)
+	if pair[victim].s.CompareAndSwap(old[victim], &s) && old[victim] == nil {
+		interned.entries.Add(1)
+	}
+	return s
+}
+
+// internCString returns a shared string equal to the C string p
+func internCString(p *C.char) string {
+	if p == nil {
+		return ""
+	}
+	// find the terminator on the Go side, C.strlen would be another cgo call
+	base := unsafe.Pointer(p)
+	n := 0
+	for n <= internMaxLength && *(*byte)(unsafe.Add(base, n)) != 0 {
+		n++
+	}
+	if n > internMaxLength {
+		return C.GoString(p)
+	}
+	return internBytes(unsafe.Slice((*byte)(base), n))
+}
+
+// GetInternStats returns the counters of the event string intern table
+func GetInternStats() InternStats {
+	var hits uint64
+	for i := range interned.slots {
+		hits += interned.slots[i].hits.Load()
+	}
+	return InternStats{
+		Hits:    hits,
+		Misses:  interned.misses.Load(),
+		Entries: int(interned.entries.Load()),
+	}
+}
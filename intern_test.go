@@ -0,0 +1,72 @@
+//go:build ts3stub
+
+package ts3sdk
+
+import (
+	"fmt"
+	"testing"
+)
+
+func TestInternBytes(t *testing.T) {
+	name := []byte("ServerAdmin")
+	first := internBytes(name)
+	if first != "ServerAdmin" {
+		t.Fatalf("internBytes returned %q", first)
+	}
+
+	// a hit returns the shared string without allocating
+	if allocs := testing.AllocsPerRun(1000, func() { internBytes(name) }); allocs != 0 {
+		t.Errorf("a hit allocates %v times", allocs)
+	}
+	name[0] = 's'
+	if s := internBytes(name); s != "serverAdmin" || first != "ServerAdmin" {
+		t.Errorf("changed bytes interned as %q, the first string became %q", s, first)
+	}
+}
+
+// Names as they come with events: a few hundred clients, looked up over and over
+func benchNames(n int) [][]byte {
+	names := make([][]byte, n)
+	for i := range names {
+		names[i] = []byte(fmt.Sprintf("Client %d", i))
+	}
+	return names
+}
+
+func BenchmarkIntern(b *testing.B) {
+	names := benchNames(512)
+	for _, name := range names {
+		internBytes(name)
+	}
+
+	b.Run("Copy", func(b *testing.B) {
+		b.ReportAllocs()
+		var s string
+		for i := 0; i < b.N; i++ {
+			s = string(names[i%len(names)])
+		}
+		_ = s
+	})
+	b.Run("Hit", func(b *testing.B) {
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			internBytes(names[i%len(names)])
+		}
+	})
+	b.Run("HitParallel", func(b *testing.B) {
+		b.ReportAllocs()
+		b.RunParallel(func(pb *testing.PB) {
+			for i := 0; pb.Next(); i++ {
+				internBytes(names[i%len(names)])
+			}
+		})
+	})
+	b.Run("Miss", func(b *testing.B) {
+		misses := benchNames(2 * internSlots)
+		b.ReportAllocs()
+		b.ResetTimer()
+		for i := 0; i < b.N; i++ {
+			internBytes(misses[i%len(misses)])
+		}
+	})
+}
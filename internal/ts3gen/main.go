@@ -0,0 +1,1050 @@
+// Command ts3gen generates Go bindings for the parts of clientlib.h and
+// public_definitions.h that have no hand-written binding in package ts3sdk.
+//
+// It emits a function for every ts3client_* function whose parameters it can
+// marshal, an Async variant for functions taking a return code, the missing
+// ClientUIFunctions callbacks and the enum constants, typed by their enum.
+// Identifiers already declared by hand-written files of the package are
+// skipped, so hand-written bindings always win.
+//
+// The callbacks also get queueing C functions and event kinds for the event
+// queue (-queue, eventqueue_gen.c and eventqueue_gen.h), a dispatch for the
+// batched delivery and a routing for ConnectionPool.
+//
+// With -stub it also writes a C stub of every function of clientlib.h, which the
+// tests and benchmarks link instead of the SDK binaries (see internal/ts3stub).
+//
+// Usage (from the package directory, see go:generate in generate.go):
+//
+//	go run ./internal/ts3gen -include ts_sdk_3.3.1/include -out ts3client_gen.go -queue eventqueue_gen.c -stub internal/ts3stub/clientlib_gen.c
+package main
+
+import (
+	"bytes"
+	"flag"
+	"fmt"
+	"go/ast"
+	"go/format"
+	"go/parser"
+	"go/token"
+	"log"
+	"os"
+	"path/filepath"
+	"regexp"
+	"strings"
+)
+
+// C functions bound by hand under a different name, or not meant to be called directly
+var excluded = map[string]bool{
+	"ts3client_freeMemory":                      true,
+	"ts3client_initClientLib":                   true, // Initialize
+	"ts3client_destroyClientLib":                true, // Shutdown
+	"ts3client_spawnNewServerConnectionHandler": true, // CreateServerConnectionHandler
+	"ts3client_getErrorMessage":                 true, // Error.Error
+	"ts3client_registerCustomDevice":            true, // RegisterCustomDevice
+	"ts3client_unregisterCustomDevice":          true, // CustomDevice.Unregister
+	"ts3client_processCustomCaptureData":        true, // CustomDevice.ProcessCapture
+	"ts3client_acquireCustomPlaybackData":       true, // CustomDevice.AcquirePlayback
+}
+
+// C functions the stub implements by hand on top of the excluded ones, see internal/ts3stub
+var stubbed = map[string]bool{
+	"ts3client_getClientList":             true,
+	"ts3client_getChannelOfClient":        true,
+	"ts3client_getClientVariableAsString": true,
+	"ts3client_startConnection":           true,
+}
+
+// Names of out parameters, other non-const pointers are input arrays
+var outParams = map[string]bool{
+	"result":        true,
+	"isDefault":     true,
+	"waveHandle":    true,
+	"limit":         true,
+	"requestHandle": true,
+}
+
+// Property enums the flag parameter of the variable getters and setters takes, by function name prefix
+var flagEnums = []struct{ prefix, enum string }{
+	{"ts3client_getServerConnectionVariable", "ConnectionProperties"},
+	{"ts3client_getConnectionVariable", "ConnectionProperties"},
+	{"ts3client_getClientSelfVariable", "ClientProperties"},
+	{"ts3client_setClientSelfVariable", "ClientProperties"},
+	{"ts3client_getClientVariable", "ClientProperties"},
+	{"ts3client_getChannelVariable", "ChannelProperties"},
+	{"ts3client_setChannelVariable", "ChannelProperties"},
+	{"ts3client_getServerVariable", "VirtualServerProperties"},
+}
+
+// Go types of the C enums, filled by enums before the functions and callbacks are generated
+var enumTypes = make(map[string]string)
+
+var goKeywords = map[string]bool{
+	"type": true, "func": true, "map": true, "range": true, "select": true, "chan": true, "go": true, "default": true,
+}
+
+func main() {
+	include := flag.String("include", "ts_sdk_3.3.1/include", "SDK include directory")
+	out := flag.String("out", "ts3client_gen.go", "output file")
+	queue := flag.String("queue", "eventqueue_gen.c", "C output file of the queueing callbacks, the header is written next to it")
+	stub := flag.String("stub", "", "C stub output file, none if empty")
+	flag.Parse()
+
+	clientlib := readFile(filepath.Join(*include, "teamspeak", "clientlib.h"))
+	definitions := readFile(filepath.Join(*include, "teamspeak", "public_definitions.h"))
+
+	declared, types, callbackFields := handWritten(".", *out)
+	queueHeader := strings.TrimSuffix(*queue, ".c") + ".h"
+
+	g := &generator{declared: declared, types: types, queueHeader: filepath.Base(queueHeader)}
+	g.header()
+	// the enums claim their names first, the functions need their types
+	enums := g.enums(definitions)
+	g.functions(clientlib)
+	g.callbacks(clientlib, callbackFields)
+	g.buf.Write(enums)
+
+	src, err := format.Source(g.buf.Bytes())
+	if err != nil {
+		os.WriteFile(*out, g.buf.Bytes(), 0o644)
+		log.Fatalf("formatting %s: %v", *out, err)
+	}
+	if err := os.WriteFile(*out, src, 0o644); err != nil {
+		log.Fatal(err)
+	}
+	for _, s := range g.skipped {
+		log.Printf("skipped %s", s)
+	}
+	if err := os.WriteFile(*queue, g.queueC.Bytes(), 0o644); err != nil {
+		log.Fatal(err)
+	}
+	if err := os.WriteFile(queueHeader, g.queueH.Bytes(), 0o644); err != nil {
+		log.Fatal(err)
+	}
+
+	if *stub != "" {
+		if err := os.WriteFile(*stub, stubSource(clientlib), 0o644); err != nil {
+			log.Fatal(err)
+		}
+	}
+}
+
+func readFile(path string) string {
+	b, err := os.ReadFile(path)
+	if err != nil {
+		log.Fatal(err)
+	}
+	return strings.ReplaceAll(string(b), "\r\n", "\n")
+}
+
+// handWritten returns the top level identifiers of the package's Go files except out,
+// the types among them and the field names of the Callbacks struct
+func handWritten(dir, out string) (map[string]bool, map[string]bool, map[string]bool) {
+	fset := token.NewFileSet()
+	pkgs, err := parser.ParseDir(fset, dir, func(fi os.FileInfo) bool {
+		return fi.Name() != filepath.Base(out) && !strings.HasSuffix(fi.Name(), "_test.go")
+	}, 0)
+	if err != nil {
+		log.Fatal(err)
+	}
+
+	declared := make(map[string]bool)
+	types := make(map[string]bool)
+	fields := make(map[string]bool)
+	for _, pkg := range pkgs {
+		for _, file := range pkg.Files {
+			for _, decl := range file.Decls {
+				switch d := decl.(type) {
+				case *ast.FuncDecl:
+					if d.Recv == nil {
+						declared[d.Name.Name] = true
+					}
+				case *ast.GenDecl:
+					for _, spec := range d.Specs {
+						switch s := spec.(type) {
+						case *ast.TypeSpec:
+							declared[s.Name.Name] = true
+							types[s.Name.Name] = true
+							if st, ok := s.Type.(*ast.StructType); ok && s.Name.Name == "Callbacks" {
+								for _, f := range st.Fields.List {
+									for _, n := range f.Names {
+										fields[n.Name] = true
+									}
+								}
+							}
+						case *ast.ValueSpec:
+							for _, n := range s.Names {
+								declared[n.Name] = true
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+	return declared, types, fields
+}
+
+type generator struct {
+	buf         bytes.Buffer
+	queueC      bytes.Buffer
+	queueH      bytes.Buffer
+	queueHeader string
+	declared    map[string]bool
+	types       map[string]bool // hand-written types
+	skipped     []string
+}
+
+func (g *generator) printf(format string, args ...any) {
+	fmt.Fprintf(&g.buf, format, args...)
+}
+
+// claim reports whether name is free and reserves it
+func (g *generator) claim(name string) bool {
+	if g.declared[name] {
+		return false
+	}
+	g.declared[name] = true
+	return true
+}
+
+func (g *generator) header() {
+	g.printf("// Code generated by ts3gen from clientlib.h and public_definitions.h. DO NOT EDIT.\n\n")
+	g.printf("package ts3sdk\n\n")
+}
+
+var (
+	commentRe  = regexp.MustCompile(`(?s)/\*.*?\*/|//[^\n]*`)
+	functionRe = regexp.MustCompile(`(?s)EXPORTDLL\s+unsigned\s+int\s+(ts3client_\w+)\s*\(([^)]*)\)\s*;`)
+	callbackRe = regexp.MustCompile(`(?s)void\s*\(\s*\*\s*(\w+)\s*\)\s*\(([^)]*)\)\s*;`)
+	briefRe    = regexp.MustCompile(`(?s)/\*\*((?:[^*]|\*[^/])*)\*/\s*$`)
+)
+
+// brief returns the @brief text of the doc comment ending right before offset
+func brief(src string, offset int) string {
+	m := briefRe.FindStringSubmatch(src[:offset])
+	if m == nil {
+		return ""
+	}
+	var words []string
+	started := false
+	for _, line := range strings.Split(m[1], "\n") {
+		line = strings.TrimSpace(strings.TrimLeft(strings.TrimSpace(line), "*"))
+		if !started {
+			if i := strings.Index(line, "@brief"); i >= 0 {
+				started = true
+				line = strings.TrimSpace(line[i+len("@brief"):])
+			} else {
+				continue
+			}
+		} else if line == "" || strings.HasPrefix(line, "@") {
+			break
+		}
+		if line != "" {
+			words = append(words, strings.Fields(line)...)
+		}
+	}
+	text := strings.TrimSuffix(strings.Join(words, " "), ".")
+	if text == "" {
+		return ""
+	}
+	return strings.ToUpper(text[:1]) + text[1:]
+}
+
+type param struct {
+	cType string
+	name  string
+}
+
+func parseParams(list string) []param {
+	list = strings.Join(strings.Fields(list), " ")
+	if list == "" || list == "void" {
+		return nil
+	}
+	var params []param
+	for _, p := range strings.Split(list, ",") {
+		p = strings.TrimSpace(p)
+		i := strings.LastIndexFunc(p, func(r rune) bool { return r == ' ' || r == '*' })
+		cType := strings.ReplaceAll(strings.TrimSpace(p[:i+1]), " *", "*")
+		params = append(params, param{cType: cType, name: p[i+1:]})
+	}
+	return params
+}
+
+func exported(cName string) string {
+	return strings.ToUpper(cName[:1]) + cName[1:]
+}
+
+func goName(name string) string {
+	if goKeywords[name] {
+		return name + "_"
+	}
+	return name
+}
+
+// scalarType returns the Go type and the C conversion of a scalar input parameter
+func scalarType(cType, name string) (goType, cConv string, ok bool) {
+	lower := strings.ToLower(name)
+	switch {
+	case cType == "uint64" && name == "serverConnectionHandlerID":
+		return "ConnectionHandlerID", "C.uint64", true
+	case cType == "uint64" && (strings.Contains(lower, "channelid") || strings.Contains(lower, "channelparentid")):
+		return "ChannelID", "C.uint64", true
+	case cType == "uint64":
+		return "uint64", "C.uint64", true
+	case cType == "anyID" && strings.Contains(lower, "transferid"):
+		return "uint16", "C.anyID", true
+	case cType == "anyID":
+		return "ClientID", "C.anyID", true
+	case cType == "int":
+		return "int", "C.int", true
+	case cType == "unsigned int":
+		return "uint32", "C.uint", true
+	case cType == "unsigned short":
+		return "uint16", "C.ushort", true
+	case cType == "float":
+		return "float32", "C.float", true
+	case cType == "double":
+		return "float64", "C.double", true
+	case cType == "size_t":
+		return "int", "C.size_t", true
+	case strings.HasPrefix(cType, "enum "):
+		enum := strings.TrimPrefix(cType, "enum ")
+		if goType := enumTypes[enum]; goType != "" {
+			return goType, "C.enum_" + enum, true
+		}
+		return "int", "C.enum_" + enum, true
+	}
+	return "", "", false
+}
+
+type binding struct {
+	cName      string
+	name       string
+	doc        string
+	params     []string // Go parameter list
+	results    []string // Go result types, without error
+	strings    []string // Go names of string arguments, packed into one arena
+	prep       []string // statements before the call
+	args       []string // C call arguments, "%RC" marks the return code
+	post       []string // statements after a successful call
+	returns    []string // returned values, without error
+	returnCode bool
+}
+
+func (g *generator) functions(src string) {
+	var bindings []*binding
+	for _, m := range functionRe.FindAllStringSubmatchIndex(src, -1) {
+		cName := src[m[2]:m[3]]
+		if excluded[cName] {
+			continue
+		}
+		b, reason := newBinding(cName, parseParams(commentRe.ReplaceAllString(src[m[4]:m[5]], "")))
+		if b == nil {
+			g.skipped = append(g.skipped, cName+": "+reason)
+			continue
+		}
+		b.doc = brief(src, m[0])
+		bindings = append(bindings, b)
+	}
+
+	for _, b := range bindings {
+		if g.claim(b.name) {
+			g.function(b, false)
+		}
+		if b.returnCode && g.claim(b.name+"Async") {
+			g.function(b, true)
+		}
+	}
+}
+
+func newBinding(cName string, params []param) (*binding, string) {
+	b := &binding{cName: cName, name: exported(strings.TrimPrefix(cName, "ts3client_"))}
+	hasOut := false
+
+	for _, p := range params {
+		name := goName(p.name)
+		if p.cType == "const char*" && p.name == "returnCode" {
+			b.returnCode = true
+			b.args = append(b.args, "%RC")
+			continue
+		}
+		if goType := flagType(cName, p); goType != "" {
+			b.params = append(b.params, name+" "+goType)
+			b.args = append(b.args, "C.size_t("+name+")")
+			continue
+		}
+		if goType, conv, ok := scalarType(p.cType, p.name); ok {
+			b.params = append(b.params, name+" "+goType)
+			b.args = append(b.args, conv+"("+name+")")
+			continue
+		}
+
+		out := outParams[p.name] && !strings.HasPrefix(p.cType, "const ")
+		switch {
+		case p.cType == "const char*":
+			b.params = append(b.params, name+" string")
+			b.args = append(b.args, fmt.Sprintf("%%S%d", len(b.strings)))
+			b.strings = append(b.strings, name)
+
+		case !out && (p.cType == "const anyID*" || p.cType == "anyID*"):
+			b.params = append(b.params, name+" []ClientID")
+			b.prep = append(b.prep, arrayPrep(name, "C.anyID")...)
+			b.args = append(b.args, "&c"+exported(name)+"[0]")
+
+		case !out && p.cType == "const uint64*":
+			goType := "uint64"
+			if strings.Contains(strings.ToLower(p.name), "channel") {
+				goType = "ChannelID"
+			}
+			b.params = append(b.params, name+" []"+goType)
+			b.prep = append(b.prep, arrayPrep(name, "C.uint64")...)
+			b.args = append(b.args, "&c"+exported(name)+"[0]")
+
+		case out:
+			hasOut = true
+			v := "c" + exported(name)
+			b.args = append(b.args, "&"+v)
+			switch p.cType {
+			case "char**":
+				b.prep = append(b.prep, "var "+v+" *C.char")
+				b.post = append(b.post, "defer C.ts3client_freeMemory(unsafe.Pointer("+v+"))")
+				b.results = append(b.results, "string")
+				b.returns = append(b.returns, "C.GoString("+v+")")
+			case "int*", "uint64*", "anyID*", "float*", "double*":
+				cType := map[string]string{"int*": "C.int", "uint64*": "C.uint64", "anyID*": "C.anyID", "float*": "C.float", "double*": "C.double"}[p.cType]
+				goType := map[string]string{"int*": "int", "uint64*": "uint64", "anyID*": "ClientID", "float*": "float32", "double*": "float64"}[p.cType]
+				b.prep = append(b.prep, "var "+v+" "+cType)
+				b.results = append(b.results, goType)
+				b.returns = append(b.returns, goType+"("+v+")")
+			case "anyID**":
+				b.prep = append(b.prep, "var "+v+" *C.anyID")
+				b.post = append(b.post, "defer C.ts3client_freeMemory(unsafe.Pointer("+v+"))")
+				b.results = append(b.results, "[]ClientID")
+				b.returns = append(b.returns, "clientIDsFromArray("+v+")")
+			case "uint64**":
+				goType := "uint64"
+				switch {
+				case strings.Contains(cName, "ServerConnectionHandler"):
+					goType = "ConnectionHandlerID"
+				case strings.Contains(cName, "Channel"):
+					goType = "ChannelID"
+				}
+				b.prep = append(b.prep, "var "+v+" *C.uint64")
+				b.post = append(b.post,
+					"defer C.ts3client_freeMemory(unsafe.Pointer("+v+"))",
+					"var "+name+" []"+goType,
+					"for p := "+v+"; *p != 0; p = (*C.uint64)(unsafe.Add(unsafe.Pointer(p), unsafe.Sizeof(*p))) {",
+					name+" = append("+name+", "+goType+"(*p))",
+					"}")
+				b.results = append(b.results, "[]"+goType)
+				b.returns = append(b.returns, name)
+			default:
+				return nil, "unsupported out parameter " + p.cType + " " + p.name
+			}
+
+		default:
+			return nil, "unsupported parameter " + p.cType + " " + p.name
+		}
+	}
+
+	if hasOut && b.returnCode {
+		return nil, "out parameter combined with return code"
+	}
+	if len(b.strings) > 7 {
+		return nil, "too many string parameters"
+	}
+	return b, ""
+}
+
+// flagType returns the Go type of the property enum a flag parameter takes, "" if unknown
+func flagType(cName string, p param) string {
+	if p.cType != "size_t" || p.name != "flag" {
+		return ""
+	}
+	for _, f := range flagEnums {
+		if strings.HasPrefix(cName, f.prefix) {
+			return enumTypes[f.enum]
+		}
+	}
+	return ""
+}
+
+func arrayPrep(name, cType string) []string {
+	v := "c" + exported(name)
+	return []string{
+		v + " := make([]" + cType + ", len(" + name + ")+1)",
+		"for i, id := range " + name + " {",
+		v + "[i] = " + cType + "(id)",
+		"}",
+	}
+}
+
+func (g *generator) function(b *binding, async bool) {
+	name := b.name
+	if async {
+		name += "Async"
+	}
+	if b.doc != "" {
+		g.printf("// %s binds %s\n//\n// %s\n", name, b.cName, b.doc)
+	} else {
+		g.printf("// %s binds %s\n", name, b.cName)
+	}
+
+	params := b.params
+	results := append(append([]string{}, b.results...), "error")
+	if async {
+		params = append([]string{"ctx context.Context"}, params...)
+		results = []string{"*Request", "error"}
+	}
+	g.printf("func %s(%s) ", name, strings.Join(params, ", "))
+	if len(results) == 1 {
+		g.printf("%s {\n", results[0])
+	} else {
+		g.printf("(%s) {\n", strings.Join(results, ", "))
+	}
+
+	strs := append([]string{}, b.strings...)
+	returnCode := "nil"
+	if async {
+		strs = append(strs, "returnCode")
+		returnCode = fmt.Sprintf("a.str(%d)", len(strs)-1)
+	}
+	args := make([]string, len(b.args))
+	for i, arg := range b.args {
+		switch {
+		case arg == "%RC":
+			arg = returnCode
+		case strings.HasPrefix(arg, "%S"):
+			arg = "a.str(" + arg[2:] + ")"
+		}
+		args[i] = arg
+	}
+	call := fmt.Sprintf("C.%s(%s)", b.cName, strings.Join(args, ", "))
+
+	for _, s := range b.prep {
+		g.printf("%s\n", s)
+	}
+	if len(b.prep) > 0 {
+		g.printf("\n")
+	}
+
+	if async {
+		serverConnectionHandlerID := "0"
+		for _, p := range b.params {
+			if strings.HasPrefix(p, "serverConnectionHandlerID ") {
+				serverConnectionHandlerID = "serverConnectionHandlerID"
+			}
+		}
+		g.printf("return sendRequest(ctx, %s, func(returnCode string) C.uint {\n", serverConnectionHandlerID)
+		g.printf("a := getCArena(%s)\ndefer putCArena(a)\n\nreturn %s\n})\n}\n\n", strings.Join(strs, ", "), call)
+		return
+	}
+
+	if len(strs) > 0 {
+		g.printf("a := getCArena(%s)\ndefer putCArena(a)\n\n", strings.Join(strs, ", "))
+	}
+	zero := make([]string, 0, len(b.results)+1)
+	for _, r := range b.results {
+		zero = append(zero, zeroValue(r))
+	}
+	g.printf("err := %s\nif err != C.ERROR_ok {\nreturn %s\n}\n", call, strings.Join(append(zero, "Error(err)"), ", "))
+	for _, s := range b.post {
+		g.printf("%s\n", s)
+	}
+	g.printf("return %s\n}\n\n", strings.Join(append(append([]string{}, b.returns...), "nil"), ", "))
+}
+
+func zeroValue(goType string) string {
+	switch {
+	case goType == "string":
+		return `""`
+	case strings.HasPrefix(goType, "[]"):
+		return "nil"
+	}
+	return "0"
+}
+
+type callback struct {
+	cName  string
+	name   string
+	doc    string
+	params []param
+	fields []string // event fields of the params if queued
+	queued bool
+}
+
+func (g *generator) callbacks(src string, existing map[string]bool) {
+	start := strings.Index(src, "struct ClientUIFunctions {")
+	end := strings.Index(src[start:], "}; //END OF ClientUIFunctions")
+	if start < 0 || end < 0 {
+		log.Fatal("struct ClientUIFunctions not found")
+	}
+	body := src[start : start+end]
+
+	var cbs []callback
+	for _, m := range callbackRe.FindAllStringSubmatchIndex(body, -1) {
+		cName := body[m[2]:m[3]]
+		name := strings.TrimSuffix(strings.TrimPrefix(cName, "on"), "Event")
+		if existing[name] {
+			continue
+		}
+		params := parseParams(commentRe.ReplaceAllString(body[m[4]:m[5]], ""))
+		supported := true
+		for _, p := range params {
+			if _, ok := callbackParamType(p); !ok {
+				supported = false
+				g.skipped = append(g.skipped, cName+": unsupported parameter "+p.cType+" "+p.name)
+				break
+			}
+		}
+		if !supported || !g.claim(name) || !g.claim(name+"Callback") {
+			continue
+		}
+		cb := callback{cName: cName, name: name, doc: brief(body, m[0]), params: params}
+		cb.fields, cb.queued = eventFields(params)
+		cbs = append(cbs, cb)
+	}
+
+	// callback types
+	g.printf("// Callback types generated from ClientUIFunctions\ntype (\n")
+	for _, cb := range cbs {
+		doc := cb.doc
+		if strings.HasPrefix(doc, "Called ") {
+			doc = "is c" + doc[1:]
+		} else {
+			doc = "is called for " + cb.cName
+		}
+		g.printf("// %sCallback %s\n%sCallback func(%s)\n\n", cb.name, doc, cb.name, strings.Join(cb.goParams(), ", "))
+	}
+	g.printf(")\n\n")
+
+	var direct []string
+	for _, cb := range cbs {
+		if !cb.queued {
+			direct = append(direct, cb.name)
+		}
+	}
+	g.printf("// ExtraCallbacks holds the generated callbacks. It is embedded in Callbacks.\n")
+	if len(direct) > 0 {
+		g.printf("// With SetClientCallbacksBatched their events are queued like the others, except for\n")
+		g.printf("// %s, whose arguments don't fit a queued event and which\n", strings.Join(direct, ", "))
+		g.printf("// are always called directly on the client lib threads.\n")
+	} else {
+		g.printf("// With SetClientCallbacksBatched their events are queued like the others.\n")
+	}
+	g.printf("type ExtraCallbacks struct {\n")
+	for _, cb := range cbs {
+		g.printf("%s %sCallback\n", cb.name, cb.name)
+	}
+	g.printf("}\n\n")
+
+	g.printf("// fillExtraCallbacks points the generated callbacks at their queueing C functions, or at\n")
+	g.printf("// their exported Go functions if they aren't queued\n")
+	g.printf("func fillExtraCallbacks(funcs *C.struct_ClientUIFunctions) {\n")
+	g.printf("C.ts3sdk_eventQueueFillExtraCallbacks(funcs)\n")
+	for _, cb := range cbs {
+		if !cb.queued {
+			g.printf("funcs.%s = (*[0]byte)(C.%s)\n", cb.cName, cb.cName)
+		}
+	}
+	g.printf("}\n\n")
+
+	for _, cb := range cbs {
+		var params, args []string
+		for _, p := range cb.params {
+			name := goName(p.name)
+			params = append(params, name+" "+cgoType(p.cType))
+			args = append(args, callbackArg(p, name))
+		}
+		g.printf("//export %s\nfunc %s(%s) {\n", cb.cName, cb.cName, strings.Join(params, ", "))
+		g.printf("if cb := loadCallbacks(); cb.%s != nil {\ncb.%s(\n", cb.name, cb.name)
+		for _, a := range args {
+			g.printf("%s,\n", a)
+		}
+		g.printf(")\n}\n}\n\n")
+	}
+
+	g.dispatch(cbs)
+	g.routing(cbs)
+	g.queue(cbs)
+
+	// the preamble has to declare the exported functions to take their address
+	var decls []string
+	for _, cb := range cbs {
+		if cb.queued {
+			continue
+		}
+		var cParams []string
+		for _, p := range cb.params {
+			cParams = append(cParams, strings.TrimPrefix(p.cType, "const "))
+		}
+		if len(cParams) == 0 {
+			cParams = []string{"void"}
+		}
+		decls = append(decls, fmt.Sprintf("extern void %s(%s);", cb.cName, strings.Join(cParams, ", ")))
+	}
+	g.preamble(decls)
+}
+
+func (cb *callback) goParams() []string {
+	var params []string
+	for _, p := range cb.params {
+		goType, _ := callbackParamType(p)
+		params = append(params, goName(p.name)+" "+goType)
+	}
+	return params
+}
+
+// kind returns the event kind constant of a callback, TS3SDK_EVENT_CLIENT_MOVE_MOVED for ClientMoveMoved
+func (cb *callback) kind() string {
+	var b strings.Builder
+	prev := rune(0)
+	for _, r := range cb.name {
+		if r >= 'A' && r <= 'Z' && prev >= 'a' && prev <= 'z' {
+			b.WriteByte('_')
+		}
+		b.WriteRune(r)
+		prev = r
+	}
+	return "TS3SDK_EVENT_" + strings.ToUpper(b.String())
+}
+
+// Fields of struct ts3sdk_event (eventqueue.h) the arguments of a queued callback are stored
+// in, by C type and in order. Strings are packed, "%N" is the Nth string.
+var eventFieldsByType = map[string][]string{
+	"uint64":       {"channelID", "otherChannelID", "extra[0]", "extra[1]"},
+	"anyID":        {"clientID", "invokerID"},
+	"int":          {"value", "flag"},
+	"unsigned int": {"errorNumber"},
+	"const char*":  {"%0", "%1", "%2"},
+}
+
+// eventFields assigns the parameters of a callback to fields of a queued event, ok is false
+// if they don't fit
+func eventFields(params []param) (fields []string, ok bool) {
+	used := make(map[string]int)
+	for _, p := range params {
+		if p.cType == "uint64" && p.name == "serverConnectionHandlerID" {
+			fields = append(fields, "serverConnectionHandlerID")
+			continue
+		}
+		free := eventFieldsByType[p.cType]
+		if used[p.cType] >= len(free) {
+			return nil, false
+		}
+		fields = append(fields, free[used[p.cType]])
+		used[p.cType]++
+	}
+	return fields, true
+}
+
+// dispatch emits the batched delivery of the queued callbacks
+func (g *generator) dispatch(cbs []callback) {
+	g.printf("// dispatchExtraEvent hands a queued event of a generated callback to cb\n")
+	g.printf("func dispatchExtraEvent(cb *Callbacks, ev *C.struct_ts3sdk_event) {\nswitch ev.kind {\n")
+	for _, cb := range cbs {
+		if !cb.queued {
+			continue
+		}
+		var args []string
+		hasStrings := false
+		for i, p := range cb.params {
+			field := cb.fields[i]
+			if strings.HasPrefix(field, "%") {
+				hasStrings = true
+				s := "s[" + field[1:] + "]"
+				if internedString(p) {
+					args = append(args, "internBytes("+s+")")
+				} else {
+					args = append(args, "string("+s+")")
+				}
+				continue
+			}
+			goType, _ := callbackParamType(p)
+			args = append(args, goType+"(ev."+field+")")
+		}
+		g.printf("case C.%s:\nif cb.%s != nil {\n", cb.kind(), cb.name)
+		if hasStrings {
+			g.printf("s := eventStrings(ev)\n")
+		}
+		g.printf("cb.%s(%s)\n}\n", cb.name, strings.Join(args, ", "))
+	}
+	g.printf("}\n}\n\n")
+}
+
+// routing emits the ConnectionPool routing of the generated callbacks
+func (g *generator) routing(cbs []callback) {
+	g.printf("// routeExtraCallbacks returns callbacks that hand the generated events to route, by the\n")
+	g.printf("// connection they belong to. Events without a connection go to connection 0.\n")
+	g.printf("func routeExtraCallbacks(cb ExtraCallbacks, route func(ConnectionHandlerID, func())) ExtraCallbacks {\n")
+	g.printf("var routed ExtraCallbacks\n")
+	for _, cb := range cbs {
+		connection := "0"
+		var args []string
+		for _, p := range cb.params {
+			if p.cType == "uint64" && p.name == "serverConnectionHandlerID" {
+				connection = goName(p.name)
+			}
+			args = append(args, goName(p.name))
+		}
+		g.printf("if cb.%s != nil {\nrouted.%s = func(%s) {\n", cb.name, cb.name, strings.Join(cb.goParams(), ", "))
+		g.printf("route(%s, func() { cb.%s(%s) })\n}\n}\n", connection, cb.name, strings.Join(args, ", "))
+	}
+	g.printf("return routed\n}\n\n")
+}
+
+// queue emits the event kinds and queueing C functions of the queued callbacks
+func (g *generator) queue(cbs []callback) {
+	h := &g.queueH
+	guard := "TS3SDK_" + strings.ToUpper(strings.NewReplacer(".", "_").Replace(g.queueHeader))
+	fmt.Fprintf(h, "/* Code generated by ts3gen from clientlib.h. DO NOT EDIT. */\n\n#ifndef %s\n#define %s\n\n#include \"eventqueue.h\"\n\n", guard, guard)
+	h.WriteString("/* Kinds of the queued events of the generated callbacks */\nenum ts3sdk_extra_event_kind {\n")
+	first := true
+	for _, cb := range cbs {
+		if !cb.queued {
+			continue
+		}
+		if first {
+			fmt.Fprintf(h, "    %s = TS3SDK_EVENT_EXTRA,\n", cb.kind())
+			first = false
+		} else {
+			fmt.Fprintf(h, "    %s,\n", cb.kind())
+		}
+	}
+	h.WriteString("};\n\n/* Points the generated callbacks that can be queued at their queueing functions */\n")
+	h.WriteString("void ts3sdk_eventQueueFillExtraCallbacks(struct ClientUIFunctions* funcs);\n\n#endif\n")
+
+	c := &g.queueC
+	fmt.Fprintf(c, "/* Code generated by ts3gen from clientlib.h. DO NOT EDIT. */\n\n")
+	c.WriteString("/*\n * Queueing callbacks of the generated events, recording into the ring of eventqueue.c\n")
+	c.WriteString(" * while its gate is open and calling the exported Go functions otherwise.\n */\n\n")
+	fmt.Fprintf(c, "#include \"%s\"\n#include \"_cgo_export.h\"\n", g.queueHeader)
+	for _, cb := range cbs {
+		if !cb.queued {
+			continue
+		}
+		var params, args []string
+		connection := "0"
+		strs := []string{"NULL", "NULL", "NULL"}
+		for i, p := range cb.params {
+			params = append(params, p.cType+" "+p.name)
+			if p.cType == "const char*" {
+				args = append(args, "(char*)"+p.name)
+				strs[cb.fields[i][1]-'0'] = p.name
+			} else {
+				args = append(args, p.name)
+			}
+			if cb.fields[i] == "serverConnectionHandlerID" {
+				connection = p.name
+			}
+		}
+		if len(params) == 0 {
+			params = []string{"void"}
+		}
+		fmt.Fprintf(c, "\nstatic void queue%s(%s) {\n", strings.TrimPrefix(cb.cName, "on"), strings.Join(params, ", "))
+		c.WriteString("    struct ts3sdk_event* event;\n    size_t pos;\n\n")
+		fmt.Fprintf(c, "    if (!ts3sdk_eventQueueEnter()) {\n        %s(%s);\n        return;\n    }\n", cb.cName, strings.Join(args, ", "))
+		fmt.Fprintf(c, "    if ((event = ts3sdk_eventQueueReserve(%s, %s, &pos)) == NULL)\n        return;\n", cb.kind(), connection)
+		for i, p := range cb.params {
+			if f := cb.fields[i]; f != "serverConnectionHandlerID" && !strings.HasPrefix(f, "%") {
+				fmt.Fprintf(c, "    event->%s = %s;\n", f, p.name)
+			}
+		}
+		if strs[0] != "NULL" {
+			fmt.Fprintf(c, "    ts3sdk_eventQueueSetStrings(event, %s);\n", strings.Join(strs, ", "))
+		}
+		c.WriteString("    ts3sdk_eventQueuePublish(pos);\n}\n")
+	}
+	c.WriteString("\nvoid ts3sdk_eventQueueFillExtraCallbacks(struct ClientUIFunctions* funcs) {\n")
+	for _, cb := range cbs {
+		if cb.queued {
+			fmt.Fprintf(c, "    funcs->%s = queue%s;\n", cb.cName, strings.TrimPrefix(cb.cName, "on"))
+		}
+	}
+	c.WriteString("}\n")
+}
+
+func callbackParamType(p param) (string, bool) {
+	lower := strings.ToLower(p.name)
+	switch p.cType {
+	case "const char*":
+		return "string", true
+	case "unsigned int":
+		if lower == "error" || lower == "errornumber" {
+			return "Error", true
+		}
+		return "uint32", true
+	case "uint64", "anyID", "int":
+		goType, _, ok := scalarType(p.cType, p.name)
+		return goType, ok
+	}
+	return "", false
+}
+
+func cgoType(cType string) string {
+	switch cType {
+	case "const char*":
+		return "*C.char"
+	case "unsigned int":
+		return "C.uint"
+	}
+	return "C." + cType
+}
+
+func callbackArg(p param, name string) string {
+	goType, _ := callbackParamType(p)
+	if goType != "string" {
+		return goType + "(" + name + ")"
+	}
+	if internedString(p) {
+		return "internCString(" + name + ")"
+	}
+	return "C.GoString(" + name + ")"
+}
+
+// internedString reports whether a string parameter repeats often enough to intern it,
+// names and unique identifiers
+func internedString(p param) bool {
+	lower := strings.ToLower(p.name)
+	return (strings.HasSuffix(lower, "name") && lower != "name") || strings.Contains(lower, "uniqueidentifier") || strings.Contains(lower, "uniqueclientidentifier")
+}
+
+// preamble inserts the cgo preamble and imports after the package clause
+func (g *generator) preamble(decls []string) {
+	var p bytes.Buffer
+	p.WriteString("/*\n#include <stdlib.h>\n#include <teamspeak/clientlib.h>\n#include <teamspeak/public_definitions.h>\n#include <teamspeak/public_errors.h>\n#include \"" + g.queueHeader + "\"\n\n")
+	for _, d := range decls {
+		p.WriteString(d + "\n")
+	}
+	p.WriteString("*/\nimport \"C\"\nimport (\n\"context\"\n\"unsafe\"\n)\n\n")
+
+	src := g.buf.Bytes()
+	i := bytes.Index(src, []byte("package ts3sdk\n\n")) + len("package ts3sdk\n\n")
+	out := append(append(append([]byte{}, src[:i]...), p.Bytes()...), src[i:]...)
+	g.buf.Reset()
+	g.buf.Write(out)
+}
+
+var enumRe = regexp.MustCompile(`(?s)\benum\s+(\w+)\s*\{([^}]*)\}`)
+
+// enums returns the constants of the enums whose members have no hand-written binding. Each
+// enum gets a Go type of its name, unless a hand-written identifier that isn't a type has it.
+func (g *generator) enums(src string) []byte {
+	src = commentRe.ReplaceAllString(src, "")
+	var names []string
+	bodies := make(map[string]string)
+	for _, m := range enumRe.FindAllStringSubmatch(src, -1) {
+		names = append(names, m[1])
+		bodies[m[1]] = m[2]
+	}
+
+	var out bytes.Buffer
+	for _, enum := range names {
+		var members []string
+		for _, line := range strings.Split(bodies[enum], "\n") {
+			line = strings.TrimSpace(line)
+			if strings.HasPrefix(line, "#") {
+				continue
+			}
+			for _, item := range strings.Split(line, ",") {
+				item = strings.TrimSpace(item)
+				if i := strings.Index(item, "="); i >= 0 {
+					item = strings.TrimSpace(item[:i])
+				}
+				if item == "" || strings.Contains(item, "DUMMY") || strings.HasSuffix(item, "ENDMARKER") {
+					continue
+				}
+				members = append(members, item)
+			}
+		}
+
+		var free []string
+		for _, m := range members {
+			if name := constName(m); g.claim(name) {
+				free = append(free, m)
+			}
+		}
+		typeName := strings.ReplaceAll(enum, "_", "")
+		switch {
+		case g.types[typeName]:
+			enumTypes[enum] = typeName
+		case len(free) > 0 && g.claim(typeName):
+			enumTypes[enum] = typeName
+			fmt.Fprintf(&out, "// %s is the C enum %s\ntype %s int\n\n", typeName, enum, typeName)
+		}
+		if len(free) == 0 {
+			continue
+		}
+
+		goType := enumTypes[enum]
+		if goType == "" {
+			goType = "int"
+		}
+		fmt.Fprintf(&out, "// %s enum values\nconst (\n", enum)
+		for _, m := range free {
+			fmt.Fprintf(&out, "%s = %s(C.%s)\n", constName(m), goType, m)
+		}
+		out.WriteString(")\n\n")
+	}
+	return out.Bytes()
+}
+
+// constName converts CLIENT_FLAG_TALKING to ClientFlagTalking
+func constName(c string) string {
+	var b strings.Builder
+	for _, word := range strings.Split(strings.ToLower(c), "_") {
+		if word != "" {
+			b.WriteString(strings.ToUpper(word[:1]) + word[1:])
+		}
+	}
+	return b.String()
+}
+
+// stubSource returns a C definition of every function of clientlib.h except the excluded and
+// stubbed ones, which the stub implements by hand. The definitions succeed without doing anything: out
+// parameters are zeroed, results returned as pointers are empty zeroed blocks the caller frees
+// with ts3client_freeMemory, and a return code is answered right away by ts3stub_answer.
+func stubSource(src string) []byte {
+	var b bytes.Buffer
+	b.WriteString("// Code generated by ts3gen from clientlib.h. DO NOT EDIT.\n\n//go:build ts3stub\n\n#include \"stub.h\"\n")
+	for _, m := range functionRe.FindAllStringSubmatch(src, -1) {
+		cName := m[1]
+		if excluded[cName] || stubbed[cName] {
+			continue
+		}
+		list := strings.Join(strings.Fields(commentRe.ReplaceAllString(m[2], "")), " ")
+		params := parseParams(list)
+		if list == "" {
+			list = "void"
+		}
+
+		fmt.Fprintf(&b, "\nunsigned int %s(%s) {\n", cName, list)
+		connection := "0"
+		returnCode := ""
+		for _, p := range params {
+			switch {
+			case p.name == "serverConnectionHandlerID":
+				connection = p.name
+			case p.cType == "const char*" && p.name == "returnCode":
+				returnCode = p.name
+			case strings.HasPrefix(p.cType, "const ") || !strings.HasSuffix(p.cType, "*") || p.cType == "void*":
+			case strings.HasSuffix(p.cType, "**"):
+				fmt.Fprintf(&b, "    if (%s != NULL)\n        *%s = ts3stub_empty();\n", p.name, p.name)
+			case outParams[p.name]:
+				fmt.Fprintf(&b, "    if (%s != NULL)\n        memset(%s, 0, sizeof(*%s));\n", p.name, p.name, p.name)
+			}
+		}
+		if returnCode != "" {
+			fmt.Fprintf(&b, "    return ts3stub_answer(%s, %s);\n}\n", connection, returnCode)
+		} else {
+			b.WriteString("    return ERROR_ok;\n}\n")
+		}
+	}
+	return b.Bytes()
+}
+
+func init() {
+	log.SetFlags(0)
+	log.SetPrefix("ts3gen: ")
+}
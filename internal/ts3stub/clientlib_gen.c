@@ -0,0 +1,701 @@
+// Code generated by ts3gen from clientlib.h. DO NOT EDIT.
+
+//go:build ts3stub
+
+#include "stub.h"
+
+unsigned int ts3client_getClientLibVersion(char** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getClientLibVersionNumber(uint64* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_destroyServerConnectionHandler(uint64 serverConnectionHandlerID) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_createIdentity(char** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_identityStringToUniqueIdentifier(const char* identityString, char** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getPlaybackDeviceList(const char* modeID, char**** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getCaptureDeviceList(const char* modeID, char**** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getPlaybackModeList(char*** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getCaptureModeList(char*** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getDefaultPlaybackDevice(const char* modeID, char*** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getDefaultCaptureDevice(const char* modeID, char*** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getDefaultPlayBackMode(char** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getDefaultCaptureMode(char** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_openPlaybackDevice(uint64 serverConnectionHandlerID, const char* modeID, const char* playbackDevice) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_openCaptureDevice(uint64 serverConnectionHandlerID, const char* modeID, const char* captureDevice) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getCurrentPlaybackDeviceName(uint64 serverConnectionHandlerID, char** result, int* isDefault) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    if (isDefault != NULL)
+        memset(isDefault, 0, sizeof(*isDefault));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getCurrentPlayBackMode(uint64 serverConnectionHandlerID, char** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getCurrentCaptureDeviceName(uint64 serverConnectionHandlerID, char** result, int* isDefault) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    if (isDefault != NULL)
+        memset(isDefault, 0, sizeof(*isDefault));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getCurrentCaptureMode(uint64 serverConnectionHandlerID, char** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_initiateGracefulPlaybackShutdown(uint64 serverConnectionHandlerID) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_closePlaybackDevice(uint64 serverConnectionHandlerID) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_closeCaptureDevice(uint64 serverConnectionHandlerID) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_activateCaptureDevice(uint64 serverConnectionHandlerID) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_playWaveFile(uint64 serverConnectionHandlerID, const char* path) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_playWaveFileHandle(uint64 serverConnectionHandlerID, const char* path, int loop, uint64* waveHandle) {
+    if (waveHandle != NULL)
+        memset(waveHandle, 0, sizeof(*waveHandle));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_pauseWaveFileHandle(uint64 serverConnectionHandlerID, uint64 waveHandle, int pause) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_closeWaveFileHandle(uint64 serverConnectionHandlerID, uint64 waveHandle) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_setLocalTestMode(uint64 serverConnectionHandlerID, int status) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_startVoiceRecording(uint64 serverConnectionHandlerID) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_stopVoiceRecording(uint64 serverConnectionHandlerID) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_allowWhispersFrom(uint64 serverConnectionHandlerID, anyID clID) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_removeFromAllowedWhispersFrom(uint64 serverConnectionHandlerID, anyID clID) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getWhisperReceiveWhitelist(uint64 serverConnectionHandlerID, anyID** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_isWhisperReceiveWhitelisted(uint64 serverConnectionHandlerID, anyID clientID, int* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_setWhisperReceiveWhitelist(uint64 serverConnectionHandlerID, anyID* clientIDs) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_systemset3DListenerAttributes(uint64 serverConnectionHandlerID, const TS3_VECTOR* position, const TS3_VECTOR* forward, const TS3_VECTOR* up) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_set3DWaveAttributes(uint64 serverConnectionHandlerID, uint64 waveHandle, const TS3_VECTOR* position) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_systemset3DSettings(uint64 serverConnectionHandlerID, float distanceFactor, float rolloffScale) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_channelset3DAttributes(uint64 serverConnectionHandlerID, anyID clientID, const TS3_VECTOR* position) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getPreProcessorInfoValueFloat(uint64 serverConnectionHandlerID, const char* ident, float* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getPreProcessorConfigValue(uint64 serverConnectionHandlerID, const char* ident, char** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_setPreProcessorConfigValue(uint64 serverConnectionHandlerID, const char* ident, const char* value) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_setKeyPressedDuringChunk(void) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getGlobalConfigValueAsInt(const char* ident, int* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_setGlobalConfigValue(const char* ident, const char* value) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getEncodeConfigValue(uint64 serverConnectionHandlerID, const char* ident, char** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getPlaybackConfigValueAsFloat(uint64 serverConnectionHandlerID, const char* ident, float* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_setPlaybackConfigValue(uint64 serverConnectionHandlerID, const char* ident, const char* value) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_setClientVolumeModifier(uint64 serverConnectionHandlerID, anyID clientID, float value) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_logMessage(const char* logMessage, enum LogLevel severity, const char* channel, uint64 logID) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_setLogVerbosity(enum LogLevel logVerbosity) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_startConnectionWithChannelID(uint64 serverConnectionHandlerID, const char* identity, const char* ip, unsigned int port, const char* nickname, uint64 defaultChannelId, const char* defaultChannelPassword, const char* serverPassword) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_stopConnection(uint64 serverConnectionHandlerID, const char* quitMessage) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_requestClientMove(uint64 serverConnectionHandlerID, const anyID* clientIDArray, uint64 newChannelID, const char* password, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestClientVariables(uint64 serverConnectionHandlerID, anyID clientID, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestClientKickFromChannel(uint64 serverConnectionHandlerID, const anyID* clientIDArray, const char* kickReason, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestClientKickFromServer(uint64 serverConnectionHandlerID, const anyID* clientIDArray, const char* kickReason, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestChannelDelete(uint64 serverConnectionHandlerID, uint64 channelID, int force, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestChannelMove(uint64 serverConnectionHandlerID, uint64 channelID, uint64 newChannelParentID, uint64 newChannelOrder, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestSendPrivateTextMsg(uint64 serverConnectionHandlerID, const char* message, anyID targetClientID, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestSendChannelTextMsg(uint64 serverConnectionHandlerID, const char* message, uint64 targetChannelID, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestSendServerTextMsg(uint64 serverConnectionHandlerID, const char* message, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestChat(uint64 serverConnectionHandlerID, const char* type, anyID targetClientID, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestConnectionInfo(uint64 serverConnectionHandlerID, anyID clientID, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestClientSetWhisperList(uint64 serverConnectionHandlerID, anyID clientID, const uint64* targetChannelIDArray, const anyID* targetClientIDArray, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestChannelSubscribe(uint64 serverConnectionHandlerID, const uint64* channelIDArray, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestChannelSubscribeAll(uint64 serverConnectionHandlerID, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestChannelUnsubscribe(uint64 serverConnectionHandlerID, const uint64* channelIDArray, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestChannelUnsubscribeAll(uint64 serverConnectionHandlerID, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestChannelDescription(uint64 serverConnectionHandlerID, uint64 channelID, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestMuteClients(uint64 serverConnectionHandlerID, const anyID* clientIDArray, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestUnmuteClients(uint64 serverConnectionHandlerID, const anyID* clientIDArray, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestClientIDs(uint64 serverConnectionHandlerID, const char* clientUniqueIdentifier, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestSlotsFromProvisioningServer(const char* ip, unsigned short port, const char* serverPassword, unsigned short slots, const char* identity, const char* region, uint64* requestHandle) {
+    if (requestHandle != NULL)
+        memset(requestHandle, 0, sizeof(*requestHandle));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_cancelRequestSlotsFromProvisioningServer(uint64 requestHandle) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_startConnectionWithProvisioningKey(uint64 serverConnectionHandlerID, const char* identity, const char* nickname, const char* connectionKey, const char* clientMetaData) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getClientID(uint64 serverConnectionHandlerID, anyID* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getConnectionStatus(uint64 serverConnectionHandlerID, int* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getConnectionVariableAsUInt64(uint64 serverConnectionHandlerID, anyID clientID, size_t flag, uint64* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getConnectionVariableAsDouble(uint64 serverConnectionHandlerID, anyID clientID, size_t flag, double* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getConnectionVariableAsString(uint64 serverConnectionHandlerID, anyID clientID, size_t flag, char** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_cleanUpConnectionInfo(uint64 serverConnectionHandlerID, anyID clientID) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_requestServerConnectionInfo(uint64 serverConnectionHandlerID, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_getServerConnectionVariableAsUInt64(uint64 serverConnectionHandlerID, size_t flag, uint64* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getServerConnectionVariableAsFloat(uint64 serverConnectionHandlerID, size_t flag, float* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getClientSelfVariableAsInt(uint64 serverConnectionHandlerID, size_t flag, int* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getClientSelfVariableAsString(uint64 serverConnectionHandlerID, size_t flag, char** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_setClientSelfVariableAsInt(uint64 serverConnectionHandlerID, size_t flag, int value) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_setClientSelfVariableAsString(uint64 serverConnectionHandlerID, size_t flag, const char* value) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_flushClientSelfUpdates(uint64 serverConnectionHandlerID, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_getClientVariableAsInt(uint64 serverConnectionHandlerID, anyID clientID, size_t flag, int* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getClientVariableAsUInt64(uint64 serverConnectionHandlerID, anyID clientID, size_t flag, uint64* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getChannelVariableAsInt(uint64 serverConnectionHandlerID, uint64 channelID, size_t flag, int* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getChannelVariableAsUInt64(uint64 serverConnectionHandlerID, uint64 channelID, size_t flag, uint64* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getChannelVariableAsString(uint64 serverConnectionHandlerID, uint64 channelID, size_t flag, char** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getChannelIDFromChannelNames(uint64 serverConnectionHandlerID, char** channelNameArray, uint64* result) {
+    if (channelNameArray != NULL)
+        *channelNameArray = ts3stub_empty();
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_setChannelVariableAsInt(uint64 serverConnectionHandlerID, uint64 channelID, size_t flag, int value) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_setChannelVariableAsUInt64(uint64 serverConnectionHandlerID, uint64 channelID, size_t flag, uint64 value) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_setChannelVariableAsString(uint64 serverConnectionHandlerID, uint64 channelID, size_t flag, const char* value) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_flushChannelUpdates(uint64 serverConnectionHandlerID, uint64 channelID, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_flushChannelCreation(uint64 serverConnectionHandlerID, uint64 channelParentID, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_getChannelList(uint64 serverConnectionHandlerID, uint64** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getChannelClientList(uint64 serverConnectionHandlerID, uint64 channelID, anyID** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getParentChannelOfChannel(uint64 serverConnectionHandlerID, uint64 channelID, uint64* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getChannelEmptySecs(uint64 serverConnectionHandlerID, uint64 channelID, int* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getServerConnectionHandlerList(uint64** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getServerVariableAsInt(uint64 serverConnectionHandlerID, size_t flag, int* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getServerVariableAsUInt64(uint64 serverConnectionHandlerID, size_t flag, uint64* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getServerVariableAsString(uint64 serverConnectionHandlerID, size_t flag, char** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_requestServerVariables(uint64 serverConnectionHandlerID, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_getTransferFileName(anyID transferID, char** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getTransferFilePath(anyID transferID, char** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getTransferFileRemotePath(anyID transferID, char** result) {
+    if (result != NULL)
+        *result = ts3stub_empty();
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getTransferFileSize(anyID transferID, uint64* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getTransferFileSizeDone(anyID transferID, uint64* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_isTransferSender(anyID transferID, int* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getTransferStatus(anyID transferID, int* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getCurrentTransferSpeed(anyID transferID, float* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getAverageTransferSpeed(anyID transferID, float* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getTransferRunTime(anyID transferID, uint64* result) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_sendFile(uint64 serverConnectionHandlerID, uint64 channelID, const char* channelPW, const char* file, int overwrite, int resume, const char* sourceDirectory, anyID* result, const char* returnCode) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestFile(uint64 serverConnectionHandlerID, uint64 channelID, const char* channelPW, const char* file, int overwrite, int resume, const char* destinationDirectory, anyID* result, const char* returnCode) {
+    if (result != NULL)
+        memset(result, 0, sizeof(*result));
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_haltTransfer(uint64 serverConnectionHandlerID, anyID transferID, int deleteUnfinishedFile, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestFileList(uint64 serverConnectionHandlerID, uint64 channelID, const char* channelPW, const char* path, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestFileInfo(uint64 serverConnectionHandlerID, uint64 channelID, const char* channelPW, const char* file, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestDeleteFile(uint64 serverConnectionHandlerID, uint64 channelID, const char* channelPW, const char** file, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestCreateDirectory(uint64 serverConnectionHandlerID, uint64 channelID, const char* channelPW, const char* directoryPath, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_requestRenameFile(uint64 serverConnectionHandlerID, uint64 fromChannelID, const char* fromChannelPW, uint64 toChannelID, const char* toChannelPW, const char* oldFile, const char* newFile, const char* returnCode) {
+    return ts3stub_answer(serverConnectionHandlerID, returnCode);
+}
+
+unsigned int ts3client_getInstanceSpeedLimitUp(uint64 *limit) {
+    if (limit != NULL)
+        memset(limit, 0, sizeof(*limit));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getInstanceSpeedLimitDown(uint64 *limit) {
+    if (limit != NULL)
+        memset(limit, 0, sizeof(*limit));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getServerConnectionHandlerSpeedLimitUp(uint64 serverConnectionHandlerID, uint64* limit) {
+    if (limit != NULL)
+        memset(limit, 0, sizeof(*limit));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getServerConnectionHandlerSpeedLimitDown(uint64 serverConnectionHandlerID, uint64* limit) {
+    if (limit != NULL)
+        memset(limit, 0, sizeof(*limit));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getTransferSpeedLimit(anyID transferID, uint64* limit) {
+    if (limit != NULL)
+        memset(limit, 0, sizeof(*limit));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_setInstanceSpeedLimitUp(uint64 newLimit) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_setInstanceSpeedLimitDown(uint64 newLimit) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_setServerConnectionHandlerSpeedLimitUp(uint64 serverConnectionHandlerID, uint64 newLimit) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_setServerConnectionHandlerSpeedLimitDown(uint64 serverConnectionHandlerID, uint64 newLimit) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_setTransferSpeedLimit(anyID transferID, uint64 newLimit) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getChatLoginToken(uint64 serverConnectionHandlerID) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getAuthenticationToken(uint64 serverConnectionHandlerID) {
+    return ERROR_ok;
+}
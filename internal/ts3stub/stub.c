@@ -0,0 +1,232 @@
+//go:build ts3stub
+
+/*
+ * The functions of the stub that do more than succeed: callback registration,
+ * memory, connection handler IDs, connection starts, error messages, custom
+ * devices and the client table. The rest is generated into clientlib_gen.c.
+ */
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <pthread.h>
+#endif
+#include <stdatomic.h>
+#include <stdio.h>
+
+#include "stub.h"
+
+static struct ClientUIFunctions funcs;
+static atomic_ullong nextServerConnectionHandlerID;
+static atomic_int dropAnswers;
+static atomic_int playbackData;
+static atomic_int establishOnStart;
+static atomic_uint failStarts;
+
+/* The clients of ts3stub_setClients, set while no other thread queries them */
+static uint64 clientsConnection;
+static unsigned int clientCount;
+static unsigned int clientChannels;
+
+void* ts3stub_empty(void) {
+    void* block = calloc(1, 64);
+
+    if (block == NULL)
+        abort();
+    return block;
+}
+
+unsigned int ts3stub_answer(uint64 serverConnectionHandlerID, const char* returnCode) {
+    if (returnCode != NULL && returnCode[0] != '\0' && funcs.onServerErrorEvent != NULL && !atomic_load(&dropAnswers))
+        funcs.onServerErrorEvent(serverConnectionHandlerID, "ok", ERROR_ok, returnCode, "");
+    return ERROR_ok;
+}
+
+void ts3stub_dropAnswers(int drop) {
+    atomic_store(&dropAnswers, drop);
+}
+
+unsigned int ts3client_freeMemory(void* pointer) {
+    free(pointer);
+    return ERROR_ok;
+}
+
+unsigned int ts3client_initClientLib(const struct ClientUIFunctions* functionPointers, const struct ClientUIFunctionsRare* functionRarePointers, int usedLogTypes, const char* logFileFolder, const char* resourcesFolder) {
+    if (functionPointers == NULL)
+        return ERROR_parameter_invalid;
+    funcs = *functionPointers;
+    return ERROR_ok;
+}
+
+unsigned int ts3client_destroyClientLib() {
+    memset(&funcs, 0, sizeof(funcs));
+    return ERROR_ok;
+}
+
+unsigned int ts3client_spawnNewServerConnectionHandler(int port, uint64* result) {
+    *result = atomic_fetch_add(&nextServerConnectionHandlerID, 1) + 1;
+    return ERROR_ok;
+}
+
+unsigned int ts3client_startConnection(uint64 serverConnectionHandlerID, const char* identity, const char* ip, unsigned int port, const char* nickname, const char** defaultChannelArray, const char* defaultChannelPassword, const char* serverPassword) {
+    unsigned int fails = atomic_load(&failStarts);
+
+    while (fails > 0 && !atomic_compare_exchange_weak(&failStarts, &fails, fails - 1))
+        ;
+    if (fails > 0)
+        return ERROR_failed_connection_initialisation;
+    if (atomic_load(&establishOnStart))
+        ts3stub_fire(TS3STUB_CONNECTION_ESTABLISHED, serverConnectionHandlerID, 1);
+    return ERROR_ok;
+}
+
+void ts3stub_establishOnStart(int established) {
+    atomic_store(&establishOnStart, established);
+}
+
+void ts3stub_failStarts(unsigned int count) {
+    atomic_store(&failStarts, count);
+}
+
+unsigned int ts3client_getErrorMessage(unsigned int errorCode, char** error) {
+    if ((*error = (char*)malloc(32)) == NULL)
+        return ERROR_out_of_memory;
+    snprintf(*error, 32, "stub error %u", errorCode);
+    return ERROR_ok;
+}
+
+unsigned int ts3client_registerCustomDevice(const char* deviceID, const char* deviceDisplayName, int capFrequency, int capChannels, int playFrequency, int playChannels) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_unregisterCustomDevice(const char* deviceID) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_processCustomCaptureData(const char* deviceName, const short* buffer, int samples) {
+    return ERROR_ok;
+}
+
+unsigned int ts3client_acquireCustomPlaybackData(const char* deviceName, short* buffer, int samples) {
+    return atomic_load(&playbackData) ? ERROR_ok : ERROR_sound_no_data;
+}
+
+void ts3stub_playbackData(int data) {
+    atomic_store(&playbackData, data);
+}
+
+void ts3stub_setClients(uint64 serverConnectionHandlerID, unsigned int count, unsigned int channels) {
+    clientsConnection = serverConnectionHandlerID;
+    clientCount = count;
+    clientChannels = channels > 0 ? channels : 1;
+}
+
+static int isStubClient(uint64 serverConnectionHandlerID, anyID clientID) {
+    return serverConnectionHandlerID == clientsConnection && clientID >= 1 && clientID <= clientCount;
+}
+
+unsigned int ts3client_getClientList(uint64 serverConnectionHandlerID, anyID** result) {
+    unsigned int i;
+
+    if (serverConnectionHandlerID != clientsConnection || clientCount == 0) {
+        *result = (anyID*)ts3stub_empty();
+        return ERROR_ok;
+    }
+    if ((*result = (anyID*)malloc((clientCount + 1) * sizeof(anyID))) == NULL)
+        return ERROR_out_of_memory;
+    for (i = 0; i < clientCount; ++i)
+        (*result)[i] = (anyID)(i + 1);
+    (*result)[clientCount] = 0;
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getChannelOfClient(uint64 serverConnectionHandlerID, anyID clientID, uint64* result) {
+    *result = isStubClient(serverConnectionHandlerID, clientID) ? clientID % clientChannels + 1 : 0;
+    return ERROR_ok;
+}
+
+unsigned int ts3client_getClientVariableAsString(uint64 serverConnectionHandlerID, anyID clientID, size_t flag, char** result) {
+    if (!isStubClient(serverConnectionHandlerID, clientID) || (flag != CLIENT_NICKNAME && flag != CLIENT_UNIQUE_IDENTIFIER)) {
+        *result = (char*)ts3stub_empty();
+        return ERROR_ok;
+    }
+    if ((*result = (char*)malloc(32)) == NULL)
+        return ERROR_out_of_memory;
+    snprintf(*result, 32, flag == CLIENT_NICKNAME ? "Client %u" : "stub%05u=", (unsigned int)clientID);
+    return ERROR_ok;
+}
+
+struct fireArgs {
+    int event;
+    uint64 serverConnectionHandlerID;
+    unsigned int count;
+};
+
+static void fire(const struct fireArgs* args) {
+    uint64 id = args->serverConnectionHandlerID;
+    unsigned int i;
+
+    for (i = 0; i < args->count; ++i) {
+        switch (args->event) {
+        case TS3STUB_CLIENT_MOVE:
+            if (funcs.onClientMoveEvent != NULL)
+                funcs.onClientMoveEvent(id, (anyID)(i % 1000 + 1), 1, 2, ENTER_VISIBILITY, "moved");
+            break;
+        case TS3STUB_UPDATE_CLIENT:
+            if (funcs.onUpdateClientEvent != NULL)
+                funcs.onUpdateClientEvent(id, (anyID)(i % 1000 + 1), 1, "ServerAdmin", "qz5OA4JAL9gZtXo1p3YdmpTD3Vs=");
+            break;
+        case TS3STUB_TALK_STATUS_CHANGE:
+            if (funcs.onTalkStatusChangeEvent != NULL)
+                funcs.onTalkStatusChangeEvent(id, (int)(i & 1), 0, (anyID)(i % 1000 + 1));
+            break;
+        case TS3STUB_CLIENT_KICK_FROM_SERVER:
+            if (funcs.onClientKickFromServerEvent != NULL)
+                funcs.onClientKickFromServerEvent(id, (anyID)(i % 1000 + 1), 1, 0, LEAVE_VISIBILITY, 1, "ServerAdmin", "qz5OA4JAL9gZtXo1p3YdmpTD3Vs=", "kicked");
+            break;
+        case TS3STUB_CONNECTION_LOST:
+            if (funcs.onConnectStatusChangeEvent != NULL)
+                funcs.onConnectStatusChangeEvent(id, STATUS_DISCONNECTED, ERROR_connection_lost);
+            break;
+        case TS3STUB_CONNECTION_ESTABLISHED:
+            if (funcs.onConnectStatusChangeEvent != NULL)
+                funcs.onConnectStatusChangeEvent(id, STATUS_CONNECTION_ESTABLISHED, ERROR_ok);
+            break;
+        }
+    }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI fireThread(LPVOID args) {
+    fire((const struct fireArgs*)args);
+    return 0;
+}
+
+void ts3stub_fire(int event, uint64 serverConnectionHandlerID, unsigned int count) {
+    struct fireArgs args = { event, serverConnectionHandlerID, count };
+    HANDLE thread = CreateThread(NULL, 0, fireThread, &args, 0, NULL);
+
+    if (thread == NULL) {
+        fire(&args);
+        return;
+    }
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+}
+#else
+static void* fireThread(void* args) {
+    fire((const struct fireArgs*)args);
+    return NULL;
+}
+
+void ts3stub_fire(int event, uint64 serverConnectionHandlerID, unsigned int count) {
+    struct fireArgs args = { event, serverConnectionHandlerID, count };
+    pthread_t thread;
+
+    if (pthread_create(&thread, NULL, fireThread, &args) != 0) {
+        fire(&args);
+        return;
+    }
+    pthread_join(thread, NULL);
+}
+#endif
@@ -0,0 +1,51 @@
+#ifndef TS3STUB_STUB_H
+#define TS3STUB_STUB_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <teamspeak/clientlib.h>
+#include <teamspeak/public_definitions.h>
+#include <teamspeak/public_errors.h>
+
+/* Events ts3stub_fire can raise */
+enum ts3stub_event {
+    TS3STUB_CLIENT_MOVE = 0,       /* onClientMoveEvent with a move message */
+    TS3STUB_UPDATE_CLIENT,         /* onUpdateClientEvent with an invoker name and unique identifier */
+    TS3STUB_TALK_STATUS_CHANGE,    /* onTalkStatusChangeEvent, no strings */
+    TS3STUB_CLIENT_KICK_FROM_SERVER, /* onClientKickFromServerEvent, a generated callback */
+    TS3STUB_CONNECTION_LOST,         /* onConnectStatusChangeEvent to STATUS_DISCONNECTED with ERROR_connection_lost */
+    TS3STUB_CONNECTION_ESTABLISHED   /* onConnectStatusChangeEvent to STATUS_CONNECTION_ESTABLISHED */
+};
+
+/* A zeroed block, empty as a string or a zero terminated array. Freed with ts3client_freeMemory. */
+void* ts3stub_empty(void);
+
+/* Answers a request with ERROR_ok through onServerErrorEvent if it has a return code */
+unsigned int ts3stub_answer(uint64 serverConnectionHandlerID, const char* returnCode);
+
+/* While drop is set ts3stub_answer accepts requests but never answers them, like a lost reply */
+void ts3stub_dropAnswers(int drop);
+
+/* While data is set ts3client_acquireCustomPlaybackData reports a frame to play and leaves the buffer as it is, else it has no data */
+void ts3stub_playbackData(int data);
+
+/*
+ * While established is set a successful ts3client_startConnection raises STATUS_CONNECTION_ESTABLISHED
+ * for the connection through ts3stub_fire before it returns, else it fires nothing
+ */
+void ts3stub_establishOnStart(int established);
+
+/* Makes the next count calls of ts3client_startConnection fail with ERROR_failed_connection_initialisation */
+void ts3stub_failStarts(unsigned int count);
+
+/*
+ * Makes clients 1 to count visible on one connection, client n in channel n % channels + 1 with the
+ * nickname "Client n". The client list, channel and string variables of other clients and
+ * connections are empty as in the generated stub. Call while no other thread queries clients.
+ */
+void ts3stub_setClients(uint64 serverConnectionHandlerID, unsigned int count, unsigned int channels);
+
+/* Raises an event count times on a thread of its own, as the client lib does, and waits for it */
+void ts3stub_fire(int event, uint64 serverConnectionHandlerID, unsigned int count);
+
+#endif
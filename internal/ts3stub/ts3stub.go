@@ -0,0 +1,78 @@
+//go:build ts3stub
+
+// Package ts3stub is a stand-in for the TeamSpeak client lib, linked into package ts3sdk
+// by building with -tags ts3stub. Every function of clientlib.h succeeds without doing
+// anything, requests with a return code are answered right away with ERROR_ok, Fire raises
+// events through the callbacks passed to ts3client_initClientLib and SetClients fills in a
+// client table. It lets the tests and the benchmarks in bench/ measure the bindings without
+// the SDK binaries or a server.
+package ts3stub
+
+/*
+#cgo CFLAGS: -I${SRCDIR}/../../ts_sdk_3.3.1/include
+#cgo linux LDFLAGS: -lpthread
+#include "stub.h"
+*/
+import "C"
+
+// Event is an event Fire can raise
+type Event int
+
+// Events Fire can raise
+const (
+	ClientMove            Event = C.TS3STUB_CLIENT_MOVE             // with a move message
+	UpdateClient          Event = C.TS3STUB_UPDATE_CLIENT           // with an invoker name and unique identifier
+	TalkStatusChange      Event = C.TS3STUB_TALK_STATUS_CHANGE      // without strings
+	ClientKickFromServer  Event = C.TS3STUB_CLIENT_KICK_FROM_SERVER // a generated callback
+	ConnectionLost        Event = C.TS3STUB_CONNECTION_LOST         // a status change to StatusDisconnected
+	ConnectionEstablished Event = C.TS3STUB_CONNECTION_ESTABLISHED  // a status change to StatusConnectionEstablished
+)
+
+// Fire raises event count times on a C thread of its own, as the client lib does, and
+// returns once the callbacks returned. Client IDs cycle through 1 to 1000.
+func Fire(event Event, serverConnectionHandlerID uint64, count int) {
+	C.ts3stub_fire(C.int(event), C.uint64(serverConnectionHandlerID), C.uint(count))
+}
+
+// DropAnswers makes the stub accept requests without ever answering them while drop is set,
+// as if the reply got lost
+func DropAnswers(drop bool) {
+	d := 0
+	if drop {
+		d = 1
+	}
+	C.ts3stub_dropAnswers(C.int(d))
+}
+
+// PlaybackData makes custom devices report a frame to play while data is set, the buffer is
+// left as it is. Without it they never have anything to play.
+func PlaybackData(data bool) {
+	d := 0
+	if data {
+		d = 1
+	}
+	C.ts3stub_playbackData(C.int(d))
+}
+
+// EstablishOnStart makes a successful StartConnection fire ConnectionEstablished for its
+// connection before it returns while established is set. Without it starts fire nothing.
+func EstablishOnStart(established bool) {
+	e := 0
+	if established {
+		e = 1
+	}
+	C.ts3stub_establishOnStart(C.int(e))
+}
+
+// FailStarts makes the next count calls of StartConnection fail with
+// ErrorFailedConnectionInitialisation
+func FailStarts(count int) {
+	C.ts3stub_failStarts(C.uint(count))
+}
+
+// SetClients makes clients 1 to count visible on one connection of the stub, client n in channel
+// n%channels+1 with the nickname "Client n". Clients of other connections are forgotten. It must
+// not be called while other goroutines query clients.
+func SetClients(serverConnectionHandlerID uint64, count, channels int) {
+	C.ts3stub_setClients(C.uint64(serverConnectionHandlerID), C.uint(count), C.uint(channels))
+}
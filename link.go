@@ -0,0 +1,13 @@
+//go:build !ts3stub
+
+package ts3sdk
+
+// The client lib to link against. Building with -tags ts3stub links the stub in
+// internal/ts3stub instead, for tests and benchmarks without the SDK binaries.
+
+/*
+#cgo windows LDFLAGS: -L${SRCDIR}/ts_sdk_3.3.1/lib/windows -lts3client_win64
+#cgo linux,amd64 LDFLAGS: -L${SRCDIR}/ts_sdk_3.3.1/bin/linux/amd64 -lts3client -Wl,-rpath,${SRCDIR}/ts_sdk_3.3.1/bin/linux/amd64
+#cgo linux,arm64 LDFLAGS: -L${SRCDIR}/ts_sdk_3.3.1/bin/linux/armv8 -lts3client -Wl,-rpath,${SRCDIR}/ts_sdk_3.3.1/bin/linux/armv8
+*/
+import "C"
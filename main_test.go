@@ -0,0 +1,20 @@
+//go:build ts3stub
+
+package ts3sdk
+
+import (
+	"fmt"
+	"os"
+	"testing"
+)
+
+// The tests run against the stub client lib of internal/ts3stub
+func TestMain(m *testing.M) {
+	if err := Initialize("", "", LogTypeNone); err != nil {
+		fmt.Fprintln(os.Stderr, "initializing the stub client lib:", err)
+		os.Exit(1)
+	}
+	code := m.Run()
+	Shutdown()
+	os.Exit(code)
+}
@@ -0,0 +1,379 @@
+// Package ts3sdk provides Go bindings for the TeamSpeak 3 Client SDK.
+package ts3sdk
+
+import (
+	"math/rand"
+	"runtime"
+	"sync"
+	"sync/atomic"
+	"time"
+)
+
+// ServerAddress holds what is needed to connect a server connection handler
+type ServerAddress struct {
+	Identity               string
+	IP                     string
+	Port                   uint16
+	Nickname               string
+	DefaultChannelPassword string
+	ServerPassword         string
+}
+
+// ConnectionPoolOptions configures a ConnectionPool
+type ConnectionPoolOptions struct {
+	// StartInterval is the minimum time between two connection starts
+	StartInterval time.Duration
+	// MinBackoff and MaxBackoff bound the exponential delay before reconnecting a lost connection
+	MinBackoff time.Duration
+	MaxBackoff time.Duration
+	// Shards is the number of goroutines events are delivered on
+	Shards int
+	// ShardQueue is the number of events buffered per shard. The SDK thread blocks when it is full.
+	ShardQueue int
+}
+
+// DefaultConnectionPoolOptions are used for zero fields of ConnectionPoolOptions
+var DefaultConnectionPoolOptions = ConnectionPoolOptions{
+	StartInterval: 20 * time.Millisecond,
+	MinBackoff:    time.Second,
+	MaxBackoff:    time.Minute,
+	Shards:        runtime.GOMAXPROCS(0),
+	ShardQueue:    1024,
+}
+
+// ConnectionPoolStats holds counters of a ConnectionPool
+type ConnectionPoolStats struct {
+	Connections int    // handlers in the pool
+	Connected   int    // handlers with an established connection
+	Starts      uint64 // StartConnection calls
+	Reconnects  uint64 // starts after a lost connection or a failed start
+}
+
+// ConnectionPool manages many server connection handlers.
+//
+// Connection starts are queued and spaced by StartInterval so a large fleet doesn't hit
+// the server at once. Lost connections are restarted after an exponential backoff with
+// jitter. Events are delivered on Shards goroutines, chosen by ConnectionHandlerID, so
+// events of one connection arrive in order while connections are handled in parallel.
+type ConnectionPool struct {
+	opts      ConnectionPoolOptions
+	callbacks Callbacks
+
+	connections sync.Map // ConnectionHandlerID -> *pooledConnection
+	count       atomic.Int64
+	connected   atomic.Int64
+	starts      atomic.Uint64
+	reconnects  atomic.Uint64
+
+	shards []chan func()
+
+	startMutex  sync.Mutex
+	startQueue  []*pooledConnection
+	startNotify chan struct{}
+
+	closed chan struct{}
+	wg     sync.WaitGroup
+}
+
+type pooledConnection struct {
+	id        ConnectionHandlerID
+	address   ServerAddress
+	attempts  int // consecutive failed attempts, only touched on the connection's shard
+	connected atomic.Bool
+	removed   atomic.Bool
+}
+
+// NewConnectionPool creates a pool delivering events to cb.
+// Register the pool's Callbacks with SetClientCallbacks or SetClientCallbacksBatched.
+func NewConnectionPool(cb Callbacks, opts ConnectionPoolOptions) *ConnectionPool {
+	if opts.StartInterval <= 0 {
+		opts.StartInterval = DefaultConnectionPoolOptions.StartInterval
+	}
+	if opts.MinBackoff <= 0 {
+		opts.MinBackoff = DefaultConnectionPoolOptions.MinBackoff
+	}
+	if opts.MaxBackoff < opts.MinBackoff {
+		opts.MaxBackoff = max(DefaultConnectionPoolOptions.MaxBackoff, opts.MinBackoff)
+	}
+	if opts.Shards <= 0 {
+		opts.Shards = DefaultConnectionPoolOptions.Shards
+	}
+	if opts.ShardQueue <= 0 {
+		opts.ShardQueue = DefaultConnectionPoolOptions.ShardQueue
+	}
+
+	p := &ConnectionPool{
+		opts:        opts,
+		callbacks:   cb,
+		shards:      make([]chan func(), opts.Shards),
+		startNotify: make(chan struct{}, 1),
+		closed:      make(chan struct{}),
+	}
+	for i := range p.shards {
+		p.shards[i] = make(chan func(), opts.ShardQueue)
+		p.wg.Add(1)
+		go p.runShard(p.shards[i])
+	}
+	p.wg.Add(1)
+	go p.runStarter()
+	return p
+}
+
+// Add creates a server connection handler and queues its connection start
+func (p *ConnectionPool) Add(address ServerAddress) (ConnectionHandlerID, error) {
+	id, err := CreateServerConnectionHandler()
+	if err != nil {
+		return 0, err
+	}
+	pc := &pooledConnection{id: id, address: address}
+	p.connections.Store(id, pc)
+	p.count.Add(1)
+	p.queueStart(pc)
+	return id, nil
+}
+
+// Remove stops the connection and destroys its handler
+func (p *ConnectionPool) Remove(serverConnectionHandlerID ConnectionHandlerID, quitMessage string) error {
+	v, ok := p.connections.LoadAndDelete(serverConnectionHandlerID)
+	if !ok {
+		return ErrorUndefined
+	}
+	pc := v.(*pooledConnection)
+	pc.removed.Store(true)
+	p.count.Add(-1)
+	if pc.connected.CompareAndSwap(true, false) {
+		p.connected.Add(-1)
+	}
+
+	StopConnection(serverConnectionHandlerID, quitMessage)
+	return DestroyServerConnectionHandler(serverConnectionHandlerID)
+}
+
+// Close removes all connections and stops the pool's goroutines
+func (p *ConnectionPool) Close(quitMessage string) {
+	p.connections.Range(func(key, _ any) bool {
+		p.Remove(key.(ConnectionHandlerID), quitMessage)
+		return true
+	})
+	close(p.closed)
+	p.wg.Wait()
+}
+
+// Stats returns the counters of the pool
+func (p *ConnectionPool) Stats() ConnectionPoolStats {
+	return ConnectionPoolStats{
+		Connections: int(p.count.Load()),
+		Connected:   int(p.connected.Load()),
+		Starts:      p.starts.Load(),
+		Reconnects:  p.reconnects.Load(),
+	}
+}
+
+func (p *ConnectionPool) queueStart(pc *pooledConnection) {
+	p.startMutex.Lock()
+	p.startQueue = append(p.startQueue, pc)
+	p.startMutex.Unlock()
+
+	select {
+	case p.startNotify <- struct{}{}:
+	default:
+	}
+}
+
+// runStarter starts queued connections one StartInterval apart
+func (p *ConnectionPool) runStarter() {
+	defer p.wg.Done()
+
+	throttle := time.NewTimer(0)
+	defer throttle.Stop()
+
+	for {
+		p.startMutex.Lock()
+		var pc *pooledConnection
+		if len(p.startQueue) > 0 {
+			pc = p.startQueue[0]
+			p.startQueue[0] = nil
+			p.startQueue = p.startQueue[1:]
+		}
+		p.startMutex.Unlock()
+
+		if pc == nil {
+			select {
+			case <-p.startNotify:
+				continue
+			case <-p.closed:
+				return
+			}
+		}
+		if pc.removed.Load() {
+			continue
+		}
+
+		select {
+		case <-throttle.C:
+		case <-p.closed:
+			return
+		}
+
+		a := pc.address
+		p.starts.Add(1)
+		if err := StartConnection(pc.id, a.Identity, a.IP, a.Port, a.Nickname, a.DefaultChannelPassword, a.ServerPassword); err != nil {
+			p.route(pc.id, func() { p.retry(pc) })
+		}
+		throttle.Reset(p.opts.StartInterval)
+	}
+}
+
+// retry queues a start after the backoff delay, runs on the connection's shard
+func (p *ConnectionPool) retry(pc *pooledConnection) {
+	if pc.removed.Load() {
+		return
+	}
+	pc.attempts++
+	p.reconnects.Add(1)
+	time.AfterFunc(p.backoff(pc.attempts), func() { p.queueStart(pc) })
+}
+
+// backoff returns the delay before the given attempt, MinBackoff doubled per attempt up to
+// MaxBackoff, randomized to [delay/2, delay) so lost connections don't come back in lockstep
+func (p *ConnectionPool) backoff(attempt int) time.Duration {
+	delay := p.opts.MaxBackoff
+	if shift := attempt - 1; shift < 32 && p.opts.MinBackoff<<shift < p.opts.MaxBackoff {
+		delay = p.opts.MinBackoff << shift
+	}
+	return delay/2 + time.Duration(rand.Int63n(int64(delay/2)+1))
+}
+
+func (p *ConnectionPool) runShard(events <-chan func()) {
+	defer p.wg.Done()
+	for {
+		select {
+		case fn := <-events:
+			fn()
+		case <-p.closed:
+			return
+		}
+	}
+}
+
+// route runs fn on the shard of a connection
+func (p *ConnectionPool) route(serverConnectionHandlerID ConnectionHandlerID, fn func()) {
+	select {
+	case p.shards[uint64(serverConnectionHandlerID)%uint64(len(p.shards))] <- fn:
+	case <-p.closed:
+	}
+}
+
+func (p *ConnectionPool) connectStatusChange(conn ConnectionHandlerID, newStatus ConnectStatus) {
+	v, ok := p.connections.Load(conn)
+	if !ok {
+		return
+	}
+	pc := v.(*pooledConnection)
+
+	switch newStatus {
+	case StatusConnectionEstablished:
+		pc.attempts = 0
+		if pc.connected.CompareAndSwap(false, true) {
+			p.connected.Add(1)
+		}
+	case StatusDisconnected:
+		if pc.connected.CompareAndSwap(true, false) {
+			p.connected.Add(-1)
+		}
+		p.retry(pc)
+	}
+}
+
+// Callbacks returns the callbacks to register with the client lib. They track connection
+// state and hand every event to the shard of its connection, where the pool's callbacks run.
+func (p *ConnectionPool) Callbacks() Callbacks {
+	cb := p.callbacks
+	var routed Callbacks
+
+	routed.ExtraCallbacks = routeExtraCallbacks(cb.ExtraCallbacks, p.route)
+
+	routed.ConnectStatusChange = func(conn ConnectionHandlerID, newStatus ConnectStatus, errorNumber Error) {
+		p.route(conn, func() {
+			p.connectStatusChange(conn, newStatus)
+			if cb.ConnectStatusChange != nil {
+				cb.ConnectStatusChange(conn, newStatus, errorNumber)
+			}
+		})
+	}
+	if cb.ServerProtocolVersion != nil {
+		routed.ServerProtocolVersion = func(conn ConnectionHandlerID, protocolVersion int) {
+			p.route(conn, func() { cb.ServerProtocolVersion(conn, protocolVersion) })
+		}
+	}
+	if cb.NewChannel != nil {
+		routed.NewChannel = func(conn ConnectionHandlerID, channelID, channelParentID ChannelID) {
+			p.route(conn, func() { cb.NewChannel(conn, channelID, channelParentID) })
+		}
+	}
+	if cb.NewChannelCreated != nil {
+		routed.NewChannelCreated = func(conn ConnectionHandlerID, channelID, channelParentID ChannelID, invokerID ClientID, invokerName, invokerUniqueIdentifier string) {
+			p.route(conn, func() {
+				cb.NewChannelCreated(conn, channelID, channelParentID, invokerID, invokerName, invokerUniqueIdentifier)
+			})
+		}
+	}
+	if cb.DelChannel != nil {
+		routed.DelChannel = func(conn ConnectionHandlerID, channelID ChannelID, invokerID ClientID, invokerName, invokerUniqueIdentifier string) {
+			p.route(conn, func() { cb.DelChannel(conn, channelID, invokerID, invokerName, invokerUniqueIdentifier) })
+		}
+	}
+	if cb.ChannelMove != nil {
+		routed.ChannelMove = func(conn ConnectionHandlerID, channelID, newChannelParentID ChannelID, invokerID ClientID, invokerName, invokerUniqueIdentifier string) {
+			p.route(conn, func() {
+				cb.ChannelMove(conn, channelID, newChannelParentID, invokerID, invokerName, invokerUniqueIdentifier)
+			})
+		}
+	}
+	if cb.UpdateChannel != nil {
+		routed.UpdateChannel = func(conn ConnectionHandlerID, channelID ChannelID) {
+			p.route(conn, func() { cb.UpdateChannel(conn, channelID) })
+		}
+	}
+	if cb.UpdateChannelEdited != nil {
+		routed.UpdateChannelEdited = func(conn ConnectionHandlerID, channelID ChannelID, invokerID ClientID, invokerName, invokerUniqueIdentifier string) {
+			p.route(conn, func() { cb.UpdateChannelEdited(conn, channelID, invokerID, invokerName, invokerUniqueIdentifier) })
+		}
+	}
+	if cb.UpdateClient != nil {
+		routed.UpdateClient = func(conn ConnectionHandlerID, clientID, invokerID ClientID, invokerName, invokerUniqueIdentifier string) {
+			p.route(conn, func() { cb.UpdateClient(conn, clientID, invokerID, invokerName, invokerUniqueIdentifier) })
+		}
+	}
+	if cb.ClientMove != nil {
+		routed.ClientMove = func(conn ConnectionHandlerID, clientID ClientID, oldChannelID, newChannelID ChannelID, visibility int, moveMessage string) {
+			p.route(conn, func() { cb.ClientMove(conn, clientID, oldChannelID, newChannelID, visibility, moveMessage) })
+		}
+	}
+	if cb.ClientMoveSubscription != nil {
+		routed.ClientMoveSubscription = func(conn ConnectionHandlerID, clientID ClientID, oldChannelID, newChannelID ChannelID, visibility int) {
+			p.route(conn, func() { cb.ClientMoveSubscription(conn, clientID, oldChannelID, newChannelID, visibility) })
+		}
+	}
+	if cb.ClientMoveTimeout != nil {
+		routed.ClientMoveTimeout = func(conn ConnectionHandlerID, clientID ClientID, oldChannelID, newChannelID ChannelID, visibility int, timeoutMessage string) {
+			p.route(conn, func() { cb.ClientMoveTimeout(conn, clientID, oldChannelID, newChannelID, visibility, timeoutMessage) })
+		}
+	}
+	if cb.TalkStatusChange != nil {
+		routed.TalkStatusChange = func(conn ConnectionHandlerID, status int, isReceivedWhisper int, clientID ClientID) {
+			p.route(conn, func() { cb.TalkStatusChange(conn, status, isReceivedWhisper, clientID) })
+		}
+	}
+	if cb.TextMessage != nil {
+		routed.TextMessage = func(conn ConnectionHandlerID, targetMode int, toID uint64, fromID ClientID, fromName, fromUniqueIdentifier, message string) {
+			p.route(conn, func() { cb.TextMessage(conn, targetMode, toID, fromID, fromName, fromUniqueIdentifier, message) })
+		}
+	}
+	if cb.ServerError != nil {
+		routed.ServerError = func(conn ConnectionHandlerID, errorMessage string, errorNumber Error, returnCode, extraMessage string) {
+			p.route(conn, func() { cb.ServerError(conn, errorMessage, errorNumber, returnCode, extraMessage) })
+		}
+	}
+	return routed
+}
@@ -0,0 +1,175 @@
+//go:build ts3stub
+
+package ts3sdk
+
+import (
+	"fmt"
+	"runtime"
+	"sync/atomic"
+	"testing"
+	"time"
+
+	"github.com/Piekario/ts3sdk/internal/ts3stub"
+)
+
+// The generated callbacks run on the shard of their connection like the hand-written ones
+func TestConnectionPoolRoutesExtraCallbacks(t *testing.T) {
+	shardRan := make(chan ConnectionHandlerID, 1)
+	cb := Callbacks{}
+	cb.ClientKickFromServer = func(conn ConnectionHandlerID, _ ClientID, _, _ ChannelID, _ int, _ ClientID, _, _, _ string) {
+		shardRan <- conn
+	}
+	p := NewConnectionPool(cb, ConnectionPoolOptions{Shards: 1})
+	defer p.Close("")
+
+	routed := p.Callbacks()
+	if routed.ClientKickFromServer == nil {
+		t.Fatal("ClientKickFromServer isn't routed")
+	}
+	if err := SetClientCallbacks(routed); err != nil {
+		t.Fatal(err)
+	}
+	defer SetClientCallbacks(Callbacks{})
+
+	ts3stub.Fire(ts3stub.ClientKickFromServer, 3, 1)
+	select {
+	case conn := <-shardRan:
+		if conn != 3 {
+			t.Errorf("event of connection 3 delivered for %d", conn)
+		}
+	case <-time.After(time.Second):
+		t.Fatal("routed event not delivered")
+	}
+}
+
+// waitForPool polls the pool's stats until done accepts them or a second passed
+func waitForPool(t *testing.T, p *ConnectionPool, done func(ConnectionPoolStats) bool) ConnectionPoolStats {
+	t.Helper()
+	deadline := time.Now().Add(time.Second)
+	for {
+		s := p.Stats()
+		if done(s) {
+			return s
+		}
+		if time.Now().After(deadline) {
+			t.Fatalf("pool stuck at %+v", s)
+		}
+		time.Sleep(time.Millisecond)
+	}
+}
+
+// Failed starts and lost connections are retried after a backoff until the connection is up
+func TestConnectionPoolRetry(t *testing.T) {
+	ts3stub.EstablishOnStart(true)
+	defer ts3stub.EstablishOnStart(false)
+	ts3stub.FailStarts(2)
+	defer ts3stub.FailStarts(0)
+
+	p := NewConnectionPool(Callbacks{}, ConnectionPoolOptions{
+		StartInterval: time.Millisecond,
+		MinBackoff:    time.Millisecond,
+		MaxBackoff:    4 * time.Millisecond,
+		Shards:        1,
+	})
+	defer p.Close("")
+	if err := SetClientCallbacks(p.Callbacks()); err != nil {
+		t.Fatal(err)
+	}
+	defer SetClientCallbacks(Callbacks{})
+
+	conn, err := p.Add(ServerAddress{IP: "localhost", Port: 9987, Nickname: "client"})
+	if err != nil {
+		t.Fatal(err)
+	}
+	s := waitForPool(t, p, func(s ConnectionPoolStats) bool { return s.Connected == 1 })
+	if s.Starts != 3 || s.Reconnects != 2 {
+		t.Errorf("two failed starts took %d starts and %d reconnects, want 3 and 2", s.Starts, s.Reconnects)
+	}
+
+	ts3stub.Fire(ts3stub.ConnectionLost, uint64(conn), 1)
+	s = waitForPool(t, p, func(s ConnectionPoolStats) bool { return s.Starts == 4 && s.Connected == 1 })
+	if s.Reconnects != 3 {
+		t.Errorf("lost connection counted %d reconnects, want 3", s.Reconnects)
+	}
+}
+
+// The backoff doubles from MinBackoff up to MaxBackoff and stays within [delay/2, delay]
+func TestConnectionPoolBackoff(t *testing.T) {
+	p := NewConnectionPool(Callbacks{}, ConnectionPoolOptions{
+		MinBackoff: 10 * time.Millisecond,
+		MaxBackoff: 100 * time.Millisecond,
+		Shards:     1,
+	})
+	defer p.Close("")
+
+	for _, tt := range []struct {
+		attempt int
+		delay   time.Duration
+	}{
+		{1, 10 * time.Millisecond},
+		{2, 20 * time.Millisecond},
+		{4, 80 * time.Millisecond},
+		{5, 100 * time.Millisecond},
+		{40, 100 * time.Millisecond},
+	} {
+		for i := 0; i < 100; i++ {
+			if d := p.backoff(tt.attempt); d < tt.delay/2 || d > tt.delay {
+				t.Fatalf("backoff(%d) = %v, want within [%v, %v]", tt.attempt, d, tt.delay/2, tt.delay)
+			}
+		}
+	}
+}
+
+// Adding a fleet of connections, timed until every one of them is established. Each
+// connection of the stub is established as soon as it is started, so this measures the
+// pool's start queue, throttle and shard routing. heap-B/handler is the heap the pool
+// keeps per connection once all are up.
+func BenchmarkConnectionPoolConnect(b *testing.B) {
+	ts3stub.EstablishOnStart(true)
+	defer ts3stub.EstablishOnStart(false)
+	defer SetClientCallbacks(Callbacks{})
+
+	for _, n := range []int{100, 1000} {
+		b.Run(fmt.Sprint(n), func(b *testing.B) {
+			var heap uint64
+			for i := 0; i < b.N; i++ {
+				b.StopTimer()
+				var established atomic.Int64
+				done := make(chan struct{})
+				p := NewConnectionPool(Callbacks{
+					ConnectStatusChange: func(_ ConnectionHandlerID, newStatus ConnectStatus, _ Error) {
+						if newStatus == StatusConnectionEstablished && established.Add(1) == int64(n) {
+							close(done)
+						}
+					},
+				}, ConnectionPoolOptions{StartInterval: time.Nanosecond})
+				if err := SetClientCallbacks(p.Callbacks()); err != nil {
+					b.Fatal(err)
+				}
+				var before, after runtime.MemStats
+				runtime.GC()
+				runtime.ReadMemStats(&before)
+				b.StartTimer()
+
+				for j := 0; j < n; j++ {
+					if _, err := p.Add(ServerAddress{IP: "localhost", Port: 9987, Nickname: "client"}); err != nil {
+						b.Fatal(err)
+					}
+				}
+				select {
+				case <-done:
+				case <-time.After(10 * time.Second):
+					b.Fatalf("%d of %d connections established", established.Load(), n)
+				}
+
+				b.StopTimer()
+				runtime.GC()
+				runtime.ReadMemStats(&after)
+				heap += after.HeapAlloc - min(after.HeapAlloc, before.HeapAlloc)
+				p.Close("")
+				b.StartTimer()
+			}
+			b.ReportMetric(float64(heap)/float64(b.N*n), "heap-B/handler")
+		})
+	}
+}
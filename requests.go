@@ -0,0 +1,337 @@
+// Package ts3sdk provides Go bindings for the TeamSpeak 3 Client SDK.
+package ts3sdk
+
+/*
+#include <stdlib.h>
+#include <teamspeak/clientlib.h>
+#include <teamspeak/public_definitions.h>
+#include <teamspeak/public_errors.h>
+*/
+import "C"
+import (
+	"context"
+	"strconv"
+	"sync"
+	"sync/atomic"
+	"time"
+)
+
+// Requests sent by the Async functions carry a return code "ts3sdk:<n>". The server
+// echoes it in onServerErrorEvent, which resolves the matching Request.
+const returnCodePrefix = "ts3sdk:"
+
+// DefaultRequestWindow is the number of requests per connection that may await an answer at once
+const DefaultRequestWindow = 64
+
+// DefaultRequestTimeout is how long a request awaits its answer before it fails with
+// context.DeadlineExceeded, so a lost reply doesn't hold a slot of the window forever
+const DefaultRequestTimeout = 30 * time.Second
+
+// Request is a request sent to the server that is answered asynchronously
+type Request struct {
+	serverConnectionHandlerID ConnectionHandlerID
+	done                      chan struct{}
+	err                       error
+	sent                      time.Time
+	rtt                       time.Duration
+	window                    chan struct{}
+	deadline                  *time.Timer // nil without a timeout
+}
+
+// Done returns a channel that is closed once the server answered the request
+func (r *Request) Done() <-chan struct{} {
+	return r.done
+}
+
+// Wait waits for the answer of the server and returns its error, nil on success
+func (r *Request) Wait(ctx context.Context) error {
+	select {
+	case <-r.done:
+		return r.err
+	case <-ctx.Done():
+		return ctx.Err()
+	}
+}
+
+// Err returns the answer of the server, only valid after Done is closed
+func (r *Request) Err() error {
+	return r.err
+}
+
+// RTT returns the time between sending the request and receiving the answer, only valid after Done is closed
+func (r *Request) RTT() time.Duration {
+	return r.rtt
+}
+
+// RequestStats holds counters of requests sent with the Async functions
+type RequestStats struct {
+	Completed uint64        // requests the server answered with ErrorOK
+	Failed    uint64        // requests answered with an error, timed out or lost with the connection
+	InFlight  int64         // requests awaiting an answer
+	TotalRTT  time.Duration // sum of the round-trip times of answered requests
+	MaxRTT    time.Duration
+}
+
+// Pending requests by return code number. Lookups happen on the SDK callback
+// threads, sync.Map keeps them free of a global lock.
+var (
+	pendingRequests   sync.Map // uint64 -> *Request
+	nextReturnCode    atomic.Uint64
+	requestWindowSize atomic.Int64
+	requestWindows    sync.Map // ConnectionHandlerID -> chan struct{}
+	requestTimeout    atomic.Int64
+
+	requestsCompleted atomic.Uint64
+	requestsFailed    atomic.Uint64
+	requestsInFlight  atomic.Int64
+	requestsTotalRTT  atomic.Int64
+	requestsMaxRTT    atomic.Int64
+)
+
+// SetRequestWindow sets how many requests per connection may await an answer at once.
+// It applies to connections that haven't sent a request yet.
+func SetRequestWindow(size int) {
+	requestWindowSize.Store(int64(size))
+}
+
+// SetRequestTimeout sets how long requests await their answer before they fail, 0 or less
+// for no limit. It applies to requests sent afterwards.
+func SetRequestTimeout(timeout time.Duration) {
+	if timeout <= 0 {
+		timeout = -1
+	}
+	requestTimeout.Store(int64(timeout))
+}
+
+// GetRequestStats returns the counters of requests sent with the Async functions
+func GetRequestStats() RequestStats {
+	return RequestStats{
+		Completed: requestsCompleted.Load(),
+		Failed:    requestsFailed.Load(),
+		InFlight:  requestsInFlight.Load(),
+		TotalRTT:  time.Duration(requestsTotalRTT.Load()),
+		MaxRTT:    time.Duration(requestsMaxRTT.Load()),
+	}
+}
+
+func requestWindow(serverConnectionHandlerID ConnectionHandlerID) chan struct{} {
+	if w, ok := requestWindows.Load(serverConnectionHandlerID); ok {
+		return w.(chan struct{})
+	}
+	size := requestWindowSize.Load()
+	if size <= 0 {
+		size = DefaultRequestWindow
+	}
+	w, _ := requestWindows.LoadOrStore(serverConnectionHandlerID, make(chan struct{}, size))
+	return w.(chan struct{})
+}
+
+// sendRequest waits for a free slot in the window of the connection, registers a Request
+// and calls send with its return code
+func sendRequest(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, send func(returnCode string) C.uint) (*Request, error) {
+	window := requestWindow(serverConnectionHandlerID)
+	select {
+	case window <- struct{}{}:
+	case <-ctx.Done():
+		return nil, ctx.Err()
+	}
+
+	id := nextReturnCode.Add(1)
+
+	r := &Request{
+		serverConnectionHandlerID: serverConnectionHandlerID,
+		done:                      make(chan struct{}),
+		sent:                      time.Now(),
+		window:                    window,
+	}
+	timeout := time.Duration(requestTimeout.Load())
+	if timeout == 0 {
+		timeout = DefaultRequestTimeout
+	}
+	if timeout > 0 {
+		// set before the request is published, whoever resolves it stops the timer
+		r.deadline = time.AfterFunc(timeout, func() { expireRequest(id) })
+	}
+	pendingRequests.Store(id, r)
+	requestsInFlight.Add(1)
+
+	err := send(returnCodePrefix + strconv.FormatUint(id, 10))
+	if err != C.ERROR_ok {
+		if _, ok := pendingRequests.LoadAndDelete(id); ok {
+			if r.deadline != nil {
+				r.deadline.Stop()
+			}
+			requestsInFlight.Add(-1)
+			<-window
+		}
+		return nil, Error(err)
+	}
+	return r, nil
+}
+
+// expireRequest fails a request whose answer didn't arrive in time
+func expireRequest(id uint64) {
+	v, ok := pendingRequests.LoadAndDelete(id)
+	if !ok {
+		return
+	}
+	r := v.(*Request)
+	r.err = context.DeadlineExceeded
+	finishRequest(r)
+}
+
+// completeRequest resolves the request a server answer belongs to. returnCode may point to C memory.
+func completeRequest(returnCode []byte, errorNumber Error) {
+	if len(returnCode) <= len(returnCodePrefix) || string(returnCode[:len(returnCodePrefix)]) != returnCodePrefix {
+		return
+	}
+	id, err := strconv.ParseUint(string(returnCode[len(returnCodePrefix):]), 10, 64)
+	if err != nil {
+		return
+	}
+	v, ok := pendingRequests.LoadAndDelete(id)
+	if !ok {
+		return
+	}
+	r := v.(*Request)
+
+	r.rtt = time.Since(r.sent)
+	requestsTotalRTT.Add(int64(r.rtt))
+	for old := requestsMaxRTT.Load(); int64(r.rtt) > old; old = requestsMaxRTT.Load() {
+		if requestsMaxRTT.CompareAndSwap(old, int64(r.rtt)) {
+			break
+		}
+	}
+	if errorNumber != ErrorOK {
+		r.err = errorNumber
+	}
+	finishRequest(r)
+}
+
+// forgetRequestWindow fails the requests of a destroyed connection and drops its window
+func forgetRequestWindow(serverConnectionHandlerID ConnectionHandlerID) {
+	failPendingRequests(serverConnectionHandlerID, ErrorConnectionLost)
+	requestWindows.Delete(serverConnectionHandlerID)
+}
+
+// failPendingRequests resolves all requests of a connection with err, e.g. when it was closed
+func failPendingRequests(serverConnectionHandlerID ConnectionHandlerID, err Error) {
+	pendingRequests.Range(func(key, v any) bool {
+		r := v.(*Request)
+		if r.serverConnectionHandlerID == serverConnectionHandlerID {
+			if _, ok := pendingRequests.LoadAndDelete(key); ok {
+				r.err = err
+				finishRequest(r)
+			}
+		}
+		return true
+	})
+}
+
+// finishRequest releases the slot of a request and closes Done. Only call it after removing
+// the request from pendingRequests, which makes sure it runs once.
+func finishRequest(r *Request) {
+	if r.deadline != nil {
+		r.deadline.Stop()
+	}
+	if r.err != nil {
+		requestsFailed.Add(1)
+	} else {
+		requestsCompleted.Add(1)
+	}
+	requestsInFlight.Add(-1)
+	<-r.window
+	close(r.done)
+}
+
+// RequestClientMoveAsync requests to move a client to another channel
+func RequestClientMoveAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, clientID ClientID, newChannelID ChannelID, password string) (*Request, error) {
+	clientIDArray := []C.anyID{C.anyID(clientID), 0}
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(password, returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestClientMove(
+			C.uint64(serverConnectionHandlerID),
+			&clientIDArray[0],
+			C.uint64(newChannelID),
+			a.str(0),
+			a.str(1),
+		)
+	})
+}
+
+// RequestSendPrivateTextMsgAsync sends a private text message to a client
+func RequestSendPrivateTextMsgAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, message string, targetClientID ClientID) (*Request, error) {
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(message, returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestSendPrivateTextMsg(
+			C.uint64(serverConnectionHandlerID),
+			a.str(0),
+			C.anyID(targetClientID),
+			a.str(1),
+		)
+	})
+}
+
+// RequestSendChannelTextMsgAsync sends a text message to a channel
+func RequestSendChannelTextMsgAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, message string, targetChannelID ChannelID) (*Request, error) {
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(message, returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestSendChannelTextMsg(
+			C.uint64(serverConnectionHandlerID),
+			a.str(0),
+			C.uint64(targetChannelID),
+			a.str(1),
+		)
+	})
+}
+
+// RequestSendServerTextMsgAsync sends a text message to the server
+func RequestSendServerTextMsgAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, message string) (*Request, error) {
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(message, returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestSendServerTextMsg(
+			C.uint64(serverConnectionHandlerID),
+			a.str(0),
+			a.str(1),
+		)
+	})
+}
+
+// RequestChannelSubscribeAsync subscribes to channels
+func RequestChannelSubscribeAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, channelIDs []ChannelID) (*Request, error) {
+	channelIDArray := channelIDArray(channelIDs)
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestChannelSubscribe(C.uint64(serverConnectionHandlerID), &channelIDArray[0], a.str(0))
+	})
+}
+
+// RequestChannelUnsubscribeAsync unsubscribes from channels
+func RequestChannelUnsubscribeAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, channelIDs []ChannelID) (*Request, error) {
+	channelIDArray := channelIDArray(channelIDs)
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestChannelUnsubscribe(C.uint64(serverConnectionHandlerID), &channelIDArray[0], a.str(0))
+	})
+}
+
+// channelIDArray returns a zero terminated channel ID array
+func channelIDArray(channelIDs []ChannelID) []C.uint64 {
+	array := make([]C.uint64, len(channelIDs)+1)
+	for i, channelID := range channelIDs {
+		array[i] = C.uint64(channelID)
+	}
+	return array
+}
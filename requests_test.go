@@ -0,0 +1,77 @@
+//go:build ts3stub
+
+package ts3sdk
+
+import (
+	"context"
+	"testing"
+	"time"
+
+	"github.com/Piekario/ts3sdk/internal/ts3stub"
+)
+
+func TestRequestTimeout(t *testing.T) {
+	conn, err := CreateServerConnectionHandler()
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer DestroyServerConnectionHandler(conn)
+
+	SetRequestWindow(1)
+	SetRequestTimeout(20 * time.Millisecond)
+	ts3stub.DropAnswers(true)
+	defer func() {
+		SetRequestWindow(0)
+		SetRequestTimeout(0)
+		ts3stub.DropAnswers(false)
+	}()
+
+	lost, err := RequestSendServerTextMsgAsync(context.Background(), conn, "lost")
+	if err != nil {
+		t.Fatal(err)
+	}
+	if err := lost.Wait(context.Background()); err != context.DeadlineExceeded {
+		t.Fatalf("request without an answer returned %v", err)
+	}
+
+	// the slot of the lost request is free again
+	ts3stub.DropAnswers(false)
+	ctx, cancel := context.WithTimeout(context.Background(), time.Second)
+	defer cancel()
+	r, err := RequestSendServerTextMsgAsync(ctx, conn, "answered")
+	if err != nil {
+		t.Fatal(err)
+	}
+	if err := r.Wait(ctx); err != nil {
+		t.Fatal(err)
+	}
+}
+
+func TestRequestDestroyConnection(t *testing.T) {
+	conn, err := CreateServerConnectionHandler()
+	if err != nil {
+		t.Fatal(err)
+	}
+
+	ts3stub.DropAnswers(true)
+	defer ts3stub.DropAnswers(false)
+
+	r, err := RequestSendServerTextMsgAsync(context.Background(), conn, "pending")
+	if err != nil {
+		t.Fatal(err)
+	}
+	if err := DestroyServerConnectionHandler(conn); err != nil {
+		t.Fatal(err)
+	}
+	select {
+	case <-r.Done():
+	default:
+		t.Fatal("request still pending after its connection was destroyed")
+	}
+	if r.Err() != ErrorConnectionLost {
+		t.Errorf("request of a destroyed connection returned %v", r.Err())
+	}
+	if _, ok := requestWindows.Load(conn); ok {
+		t.Error("window of a destroyed connection was kept")
+	}
+}
@@ -0,0 +1,475 @@
+// Package ts3sdk provides Go bindings for the TeamSpeak 3 Client SDK.
+package ts3sdk
+
+import (
+	"slices"
+	"sync"
+	"sync/atomic"
+)
+
+// Channel is a channel as seen by a StateMirror
+type Channel struct {
+	ID       ChannelID
+	ParentID ChannelID
+	Name     string
+}
+
+// Client is a client as seen by a StateMirror
+type Client struct {
+	ID               ClientID
+	ChannelID        ChannelID
+	Nickname         string
+	UniqueIdentifier string
+}
+
+// ServerState is an immutable snapshot of the channel tree and client table of a connection.
+// It is safe for concurrent use and queries don't call into the client lib.
+type ServerState struct {
+	channels       shardedMap[ChannelID, Channel]
+	clients        shardedMap[ClientID, Client]
+	channelClients shardedLists[ChannelID, ClientID]
+	subChannels    shardedLists[ChannelID, ChannelID]
+}
+
+var emptyServerState = &ServerState{}
+
+// Channel returns a channel by ID
+func (s *ServerState) Channel(channelID ChannelID) (Channel, bool) {
+	return s.channels.get(channelID)
+}
+
+// Client returns a client by ID
+func (s *ServerState) Client(clientID ClientID) (Client, bool) {
+	return s.clients.get(clientID)
+}
+
+// ChannelClients returns the IDs of the clients in a channel. The slice must not be modified.
+func (s *ServerState) ChannelClients(channelID ChannelID) []ClientID {
+	list, _ := s.channelClients.get(channelID)
+	return list
+}
+
+// SubChannels returns the IDs of the direct subchannels of a channel, 0 for the root. The slice must not be modified.
+func (s *ServerState) SubChannels(channelID ChannelID) []ChannelID {
+	list, _ := s.subChannels.get(channelID)
+	return list
+}
+
+// NumChannels returns the number of known channels
+func (s *ServerState) NumChannels() int {
+	return s.channels.len
+}
+
+// NumClients returns the number of visible clients
+func (s *ServerState) NumClients() int {
+	return s.clients.len
+}
+
+// StateMirror keeps an in-memory model of the channel tree and visible clients of each
+// connection, updated incrementally from events.
+//
+// Events are applied under a mutex to the working state of a connection, which shares its
+// tables with the last published snapshot. The tables are split into shards by ID, and a
+// change copies only the shard it touches, once per snapshot. The first reader after a
+// change publishes the working state, so bursts of events (e.g. the initial channel and
+// client list on connect) copy each shard at most once, and readers between changes share
+// the same immutable ServerState without locking.
+type StateMirror struct {
+	connections sync.Map // ConnectionHandlerID -> *mirroredServer
+}
+
+type mirroredServer struct {
+	mutex    sync.Mutex
+	state    ServerState                 // working state, guarded by mutex
+	snapshot atomic.Pointer[ServerState] // nil when stale
+}
+
+// NewStateMirror creates an empty state mirror. Hook it into the event stream with Callbacks.
+func NewStateMirror() *StateMirror {
+	return &StateMirror{}
+}
+
+// Snapshot returns the current state of a connection
+func (m *StateMirror) Snapshot(serverConnectionHandlerID ConnectionHandlerID) *ServerState {
+	v, ok := m.connections.Load(serverConnectionHandlerID)
+	if !ok {
+		return emptyServerState
+	}
+	srv := v.(*mirroredServer)
+	if s := srv.snapshot.Load(); s != nil {
+		return s
+	}
+
+	srv.mutex.Lock()
+	defer srv.mutex.Unlock()
+
+	// another reader may have rebuilt it meanwhile
+	if s := srv.snapshot.Load(); s != nil {
+		return s
+	}
+	s := srv.state.publish()
+	srv.snapshot.Store(s)
+	return s
+}
+
+// Resync replaces the state of a connection with the current channel and client lists of the client lib.
+// It is only needed when the mirror was hooked in after the connection was established.
+func (m *StateMirror) Resync(serverConnectionHandlerID ConnectionHandlerID) error {
+	channelIDs, err := GetChannelList(serverConnectionHandlerID)
+	if err != nil {
+		return err
+	}
+	clientIDs, err := GetClientList(serverConnectionHandlerID)
+	if err != nil {
+		return err
+	}
+
+	srv := m.server(serverConnectionHandlerID)
+	srv.mutex.Lock()
+	defer srv.mutex.Unlock()
+
+	srv.state = ServerState{}
+	for _, channelID := range channelIDs {
+		parentID, _ := GetParentChannelOfChannel(serverConnectionHandlerID, channelID)
+		srv.state.putChannel(Channel{
+			ID:       channelID,
+			ParentID: parentID,
+			Name:     channelName(serverConnectionHandlerID, channelID),
+		})
+	}
+	for _, clientID := range clientIDs {
+		channelID, _ := GetChannelOfClient(serverConnectionHandlerID, clientID)
+		srv.state.putClient(fetchClient(serverConnectionHandlerID, clientID, channelID))
+	}
+	srv.snapshot.Store(nil)
+	return nil
+}
+
+// Callbacks returns callbacks that update the mirror and then call next
+func (m *StateMirror) Callbacks(next Callbacks) Callbacks {
+	cb := next
+
+	cb.ConnectStatusChange = func(conn ConnectionHandlerID, newStatus ConnectStatus, errorNumber Error) {
+		if newStatus == StatusDisconnected {
+			m.connections.Delete(conn)
+		}
+		if next.ConnectStatusChange != nil {
+			next.ConnectStatusChange(conn, newStatus, errorNumber)
+		}
+	}
+
+	cb.NewChannel = func(conn ConnectionHandlerID, channelID, channelParentID ChannelID) {
+		m.putChannel(conn, channelID, channelParentID)
+		if next.NewChannel != nil {
+			next.NewChannel(conn, channelID, channelParentID)
+		}
+	}
+
+	cb.NewChannelCreated = func(conn ConnectionHandlerID, channelID, channelParentID ChannelID, invokerID ClientID, invokerName, invokerUniqueIdentifier string) {
+		m.putChannel(conn, channelID, channelParentID)
+		if next.NewChannelCreated != nil {
+			next.NewChannelCreated(conn, channelID, channelParentID, invokerID, invokerName, invokerUniqueIdentifier)
+		}
+	}
+
+	cb.DelChannel = func(conn ConnectionHandlerID, channelID ChannelID, invokerID ClientID, invokerName, invokerUniqueIdentifier string) {
+		m.update(conn, func(s *ServerState) {
+			s.deleteChannel(channelID)
+		})
+		if next.DelChannel != nil {
+			next.DelChannel(conn, channelID, invokerID, invokerName, invokerUniqueIdentifier)
+		}
+	}
+
+	cb.ChannelMove = func(conn ConnectionHandlerID, channelID, newChannelParentID ChannelID, invokerID ClientID, invokerName, invokerUniqueIdentifier string) {
+		m.update(conn, func(s *ServerState) {
+			if ch, ok := s.channels.get(channelID); ok {
+				ch.ParentID = newChannelParentID
+				s.putChannel(ch)
+			}
+		})
+		if next.ChannelMove != nil {
+			next.ChannelMove(conn, channelID, newChannelParentID, invokerID, invokerName, invokerUniqueIdentifier)
+		}
+	}
+
+	cb.UpdateChannel = func(conn ConnectionHandlerID, channelID ChannelID) {
+		m.renameChannel(conn, channelID)
+		if next.UpdateChannel != nil {
+			next.UpdateChannel(conn, channelID)
+		}
+	}
+
+	cb.UpdateChannelEdited = func(conn ConnectionHandlerID, channelID ChannelID, invokerID ClientID, invokerName, invokerUniqueIdentifier string) {
+		m.renameChannel(conn, channelID)
+		if next.UpdateChannelEdited != nil {
+			next.UpdateChannelEdited(conn, channelID, invokerID, invokerName, invokerUniqueIdentifier)
+		}
+	}
+
+	cb.UpdateClient = func(conn ConnectionHandlerID, clientID, invokerID ClientID, invokerName, invokerUniqueIdentifier string) {
+		nickname, err := GetClientVariableAsString(conn, clientID, ClientNickname)
+		if err == nil {
+			m.update(conn, func(s *ServerState) {
+				if cl, ok := s.clients.get(clientID); ok {
+					cl.Nickname = nickname
+					s.putClient(cl)
+				}
+			})
+		}
+		if next.UpdateClient != nil {
+			next.UpdateClient(conn, clientID, invokerID, invokerName, invokerUniqueIdentifier)
+		}
+	}
+
+	cb.ClientMove = func(conn ConnectionHandlerID, clientID ClientID, oldChannelID, newChannelID ChannelID, visibility int, moveMessage string) {
+		m.moveClient(conn, clientID, newChannelID, visibility)
+		if next.ClientMove != nil {
+			next.ClientMove(conn, clientID, oldChannelID, newChannelID, visibility, moveMessage)
+		}
+	}
+
+	cb.ClientMoveSubscription = func(conn ConnectionHandlerID, clientID ClientID, oldChannelID, newChannelID ChannelID, visibility int) {
+		m.moveClient(conn, clientID, newChannelID, visibility)
+		if next.ClientMoveSubscription != nil {
+			next.ClientMoveSubscription(conn, clientID, oldChannelID, newChannelID, visibility)
+		}
+	}
+
+	cb.ClientMoveTimeout = func(conn ConnectionHandlerID, clientID ClientID, oldChannelID, newChannelID ChannelID, visibility int, timeoutMessage string) {
+		m.moveClient(conn, clientID, 0, LeaveVisibility)
+		if next.ClientMoveTimeout != nil {
+			next.ClientMoveTimeout(conn, clientID, oldChannelID, newChannelID, visibility, timeoutMessage)
+		}
+	}
+
+	cb.ClientMoveMoved = func(conn ConnectionHandlerID, clientID ClientID, oldChannelID, newChannelID ChannelID, visibility int, moverID ClientID, moverName, moverUniqueIdentifier, moveMessage string) {
+		m.moveClient(conn, clientID, newChannelID, visibility)
+		if next.ClientMoveMoved != nil {
+			next.ClientMoveMoved(conn, clientID, oldChannelID, newChannelID, visibility, moverID, moverName, moverUniqueIdentifier, moveMessage)
+		}
+	}
+
+	cb.ClientKickFromChannel = func(conn ConnectionHandlerID, clientID ClientID, oldChannelID, newChannelID ChannelID, visibility int, kickerID ClientID, kickerName, kickerUniqueIdentifier, kickMessage string) {
+		m.moveClient(conn, clientID, newChannelID, visibility)
+		if next.ClientKickFromChannel != nil {
+			next.ClientKickFromChannel(conn, clientID, oldChannelID, newChannelID, visibility, kickerID, kickerName, kickerUniqueIdentifier, kickMessage)
+		}
+	}
+
+	cb.ClientKickFromServer = func(conn ConnectionHandlerID, clientID ClientID, oldChannelID, newChannelID ChannelID, visibility int, kickerID ClientID, kickerName, kickerUniqueIdentifier, kickMessage string) {
+		m.moveClient(conn, clientID, 0, LeaveVisibility)
+		if next.ClientKickFromServer != nil {
+			next.ClientKickFromServer(conn, clientID, oldChannelID, newChannelID, visibility, kickerID, kickerName, kickerUniqueIdentifier, kickMessage)
+		}
+	}
+
+	return cb
+}
+
+func (m *StateMirror) server(conn ConnectionHandlerID) *mirroredServer {
+	if v, ok := m.connections.Load(conn); ok {
+		return v.(*mirroredServer)
+	}
+	v, _ := m.connections.LoadOrStore(conn, &mirroredServer{})
+	return v.(*mirroredServer)
+}
+
+// update applies fn to the working state of a connection and invalidates its snapshot
+func (m *StateMirror) update(conn ConnectionHandlerID, fn func(s *ServerState)) {
+	srv := m.server(conn)
+	srv.mutex.Lock()
+	defer srv.mutex.Unlock()
+
+	fn(&srv.state)
+	srv.snapshot.Store(nil)
+}
+
+func (m *StateMirror) putChannel(conn ConnectionHandlerID, channelID, channelParentID ChannelID) {
+	// fetch before locking, cgo calls are slow compared to the table update
+	name := channelName(conn, channelID)
+	m.update(conn, func(s *ServerState) {
+		s.putChannel(Channel{ID: channelID, ParentID: channelParentID, Name: name})
+	})
+}
+
+func (m *StateMirror) renameChannel(conn ConnectionHandlerID, channelID ChannelID) {
+	name := channelName(conn, channelID)
+	m.update(conn, func(s *ServerState) {
+		if ch, ok := s.channels.get(channelID); ok {
+			ch.Name = name
+			s.putChannel(ch)
+		}
+	})
+}
+
+func (m *StateMirror) moveClient(conn ConnectionHandlerID, clientID ClientID, newChannelID ChannelID, visibility int) {
+	if newChannelID == 0 || visibility == LeaveVisibility {
+		m.update(conn, func(s *ServerState) {
+			s.deleteClient(clientID)
+		})
+		return
+	}
+
+	var entered Client
+	if visibility == EnterVisibility {
+		entered = fetchClient(conn, clientID, newChannelID)
+	}
+	m.update(conn, func(s *ServerState) {
+		cl, ok := s.clients.get(clientID)
+		if visibility == EnterVisibility || !ok {
+			cl = entered
+			cl.ID = clientID
+		}
+		cl.ChannelID = newChannelID
+		s.putClient(cl)
+	})
+}
+
+func channelName(conn ConnectionHandlerID, channelID ChannelID) string {
+	name, _ := GetChannelVariableAsString(conn, channelID, ChannelName)
+	return name
+}
+
+func fetchClient(conn ConnectionHandlerID, clientID ClientID, channelID ChannelID) Client {
+	nickname, _ := GetClientVariableAsString(conn, clientID, ClientNickname)
+	uniqueIdentifier, _ := GetClientVariableAsString(conn, clientID, ClientUniqueIdentifier)
+	return Client{
+		ID:               clientID,
+		ChannelID:        channelID,
+		Nickname:         nickname,
+		UniqueIdentifier: uniqueIdentifier,
+	}
+}
+
+// putChannel adds or replaces a channel of the working state
+func (s *ServerState) putChannel(ch Channel) {
+	if old, ok := s.channels.get(ch.ID); !ok {
+		s.subChannels.add(ch.ParentID, ch.ID)
+	} else if old.ParentID != ch.ParentID {
+		s.subChannels.remove(old.ParentID, ch.ID)
+		s.subChannels.add(ch.ParentID, ch.ID)
+	}
+	s.channels.set(ch.ID, ch)
+}
+
+func (s *ServerState) deleteChannel(channelID ChannelID) {
+	if ch, ok := s.channels.get(channelID); ok {
+		s.subChannels.remove(ch.ParentID, channelID)
+		s.channels.delete(channelID)
+	}
+}
+
+// putClient adds or replaces a client of the working state
+func (s *ServerState) putClient(cl Client) {
+	if old, ok := s.clients.get(cl.ID); !ok {
+		s.channelClients.add(cl.ChannelID, cl.ID)
+	} else if old.ChannelID != cl.ChannelID {
+		s.channelClients.remove(old.ChannelID, cl.ID)
+		s.channelClients.add(cl.ChannelID, cl.ID)
+	}
+	s.clients.set(cl.ID, cl)
+}
+
+func (s *ServerState) deleteClient(clientID ClientID) {
+	if cl, ok := s.clients.get(clientID); ok {
+		s.channelClients.remove(cl.ChannelID, clientID)
+		s.clients.delete(clientID)
+	}
+}
+
+// publish returns a snapshot of the working state. Afterwards the working state shares
+// all its shards and lists with the snapshot and copies them again before writing.
+func (s *ServerState) publish() *ServerState {
+	s.channels.owned = 0
+	s.clients.owned = 0
+	s.channelClients.owned = 0
+	s.channelClients.ownedLists = nil
+	s.subChannels.owned = 0
+	s.subChannels.ownedLists = nil
+	snapshot := *s
+	return &snapshot
+}
+
+// Number of shards the tables of a ServerState are split into, at most 64 for the owned bit set
+const stateShards = 64
+
+// shardedMap is a map split into stateShards maps by key. Snapshots share the shards, and
+// the working state copies a shard before its first write after a snapshot was published.
+type shardedMap[K ChannelID | ClientID, V any] struct {
+	shards [stateShards]map[K]V
+	len    int
+	owned  uint64 // bit i is set when shards[i] was copied since the last snapshot
+}
+
+func (m *shardedMap[K, V]) get(key K) (V, bool) {
+	v, ok := m.shards[uint64(key)%stateShards][key]
+	return v, ok
+}
+
+// writable returns the shard of key for writing
+func (m *shardedMap[K, V]) writable(key K) map[K]V {
+	i := uint64(key) % stateShards
+	if m.owned&(1<<i) == 0 {
+		shard := make(map[K]V, len(m.shards[i])+1)
+		for k, v := range m.shards[i] {
+			shard[k] = v
+		}
+		m.shards[i] = shard
+		m.owned |= 1 << i
+	}
+	return m.shards[i]
+}
+
+func (m *shardedMap[K, V]) set(key K, v V) {
+	shard := m.writable(key)
+	if _, ok := shard[key]; !ok {
+		m.len++
+	}
+	shard[key] = v
+}
+
+func (m *shardedMap[K, V]) delete(key K) {
+	if _, ok := m.get(key); ok {
+		delete(m.writable(key), key)
+		m.len--
+	}
+}
+
+// shardedLists is a shardedMap of ID lists. A list shared with a snapshot is copied before
+// it changes, one copied since the last snapshot is changed in place.
+type shardedLists[K ChannelID | ClientID, E ChannelID | ClientID] struct {
+	shardedMap[K, []E]
+	ownedLists map[K]struct{}
+}
+
+func (m *shardedLists[K, E]) add(key K, e E) {
+	list, _ := m.get(key)
+	if _, ok := m.ownedLists[key]; !ok {
+		list = append(make([]E, 0, 2*len(list)+1), list...)
+		if m.ownedLists == nil {
+			m.ownedLists = make(map[K]struct{})
+		}
+		m.ownedLists[key] = struct{}{}
+	}
+	m.set(key, append(list, e))
+}
+
+func (m *shardedLists[K, E]) remove(key K, e E) {
+	list, _ := m.get(key)
+	i := slices.Index(list, e)
+	if i < 0 {
+		return
+	}
+	if len(list) == 1 {
+		m.delete(key)
+		delete(m.ownedLists, key)
+		return
+	}
+	if _, ok := m.ownedLists[key]; ok {
+		list[i] = list[len(list)-1]
+		m.set(key, list[:len(list)-1])
+		return
+	}
+	m.set(key, append(list[:i:i], list[i+1:]...))
+}
@@ -0,0 +1,147 @@
+//go:build ts3stub
+
+package ts3sdk
+
+import (
+	"slices"
+	"testing"
+
+	"github.com/Piekario/ts3sdk/internal/ts3stub"
+)
+
+func TestStateMirrorEvents(t *testing.T) {
+	const conn = ConnectionHandlerID(1)
+	m := NewStateMirror()
+	cb := m.Callbacks(Callbacks{})
+
+	cb.NewChannel(conn, 1, 0)
+	cb.NewChannel(conn, 2, 0)
+	cb.NewChannel(conn, 3, 1)
+	for id := ClientID(1); id <= 4; id++ {
+		cb.ClientMove(conn, id, 0, 1, EnterVisibility, "")
+	}
+	before := m.Snapshot(conn)
+
+	cb.ClientMoveMoved(conn, 1, 1, 2, RetainVisibility, 9, "mover", "", "")
+	cb.ClientKickFromChannel(conn, 2, 1, 3, RetainVisibility, 9, "kicker", "", "")
+	cb.ClientKickFromServer(conn, 3, 1, 0, LeaveVisibility, 9, "kicker", "", "")
+	cb.ChannelMove(conn, 3, 2, 9, "mover", "")
+	after := m.Snapshot(conn)
+
+	// the earlier snapshot is untouched by the later changes
+	if got := sorted(before.ChannelClients(1)); !slices.Equal(got, []ClientID{1, 2, 3, 4}) {
+		t.Errorf("old snapshot lists clients %v in channel 1", got)
+	}
+	if got := before.SubChannels(1); !slices.Equal(got, []ChannelID{3}) {
+		t.Errorf("old snapshot lists subchannels %v of channel 1", got)
+	}
+
+	if got := after.ChannelClients(1); !slices.Equal(got, []ClientID{4}) {
+		t.Errorf("clients %v in channel 1", got)
+	}
+	if got := after.ChannelClients(2); !slices.Equal(got, []ClientID{1}) {
+		t.Errorf("clients %v in channel 2 after the move", got)
+	}
+	if got := after.ChannelClients(3); !slices.Equal(got, []ClientID{2}) {
+		t.Errorf("clients %v in channel 3 after the channel kick", got)
+	}
+	if _, ok := after.Client(3); ok || after.NumClients() != 3 {
+		t.Errorf("client kicked from the server still listed, %d clients", after.NumClients())
+	}
+	if got := after.SubChannels(2); !slices.Equal(got, []ChannelID{3}) {
+		t.Errorf("subchannels %v of channel 2 after the channel move", got)
+	}
+	if got := after.SubChannels(1); len(got) != 0 {
+		t.Errorf("subchannels %v of channel 1 after the channel move", got)
+	}
+	if m.Snapshot(conn) != after {
+		t.Error("snapshot rebuilt without a change")
+	}
+}
+
+func sorted(ids []ClientID) []ClientID {
+	ids = slices.Clone(ids)
+	slices.Sort(ids)
+	return ids
+}
+
+// One change and a snapshot in a mirror of 1,000 channels and 5,000 clients
+func BenchmarkStateMirrorChange(b *testing.B) {
+	const conn = ConnectionHandlerID(1)
+	m := NewStateMirror()
+	for id := ChannelID(1); id <= 1000; id++ {
+		m.update(conn, func(s *ServerState) {
+			s.putChannel(Channel{ID: id})
+		})
+	}
+	for id := ClientID(1); id <= 5000; id++ {
+		m.update(conn, func(s *ServerState) {
+			s.putClient(Client{ID: id, ChannelID: ChannelID(id%1000 + 1)})
+		})
+	}
+	m.Snapshot(conn)
+	b.ReportAllocs()
+	b.ResetTimer()
+
+	for i := 0; i < b.N; i++ {
+		id := ClientID(i%5000 + 1)
+		m.update(conn, func(s *ServerState) {
+			s.putClient(Client{ID: id, ChannelID: ChannelID(i%1000 + 1)})
+		})
+		m.Snapshot(conn)
+	}
+}
+
+// Looking up the nickname and channel of a client in a mirror of 5,000 clients, against asking
+// the client lib each time
+func BenchmarkStateMirrorLookup(b *testing.B) {
+	const conn = ConnectionHandlerID(1)
+	const clients = 5000
+	ts3stub.SetClients(uint64(conn), clients, 100)
+	defer ts3stub.SetClients(0, 0, 0)
+
+	m := NewStateMirror()
+	if err := m.Resync(conn); err != nil {
+		b.Fatal(err)
+	}
+	if cl, _ := m.Snapshot(conn).Client(clients); cl.Nickname != "Client 5000" || cl.ChannelID != clients%100+1 {
+		b.Fatalf("mirrored client %+v", cl)
+	}
+
+	b.Run("Mirror/Nickname", func(b *testing.B) {
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			cl, ok := m.Snapshot(conn).Client(ClientID(i%clients + 1))
+			if !ok || cl.Nickname == "" {
+				b.Fatal("client not mirrored")
+			}
+		}
+	})
+	b.Run("ClientLib/Nickname", func(b *testing.B) {
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			name, err := GetClientVariableAsString(conn, ClientID(i%clients+1), ClientNickname)
+			if err != nil || name == "" {
+				b.Fatal(err)
+			}
+		}
+	})
+	b.Run("Mirror/Channel", func(b *testing.B) {
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			cl, ok := m.Snapshot(conn).Client(ClientID(i%clients + 1))
+			if !ok || cl.ChannelID == 0 {
+				b.Fatal("client not mirrored")
+			}
+		}
+	})
+	b.Run("ClientLib/Channel", func(b *testing.B) {
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			channelID, err := GetChannelOfClient(conn, ClientID(i%clients+1))
+			if err != nil || channelID == 0 {
+				b.Fatal(err)
+			}
+		}
+	})
+}
@@ -0,0 +1,6 @@
+//go:build ts3stub
+
+package ts3sdk
+
+// Links the stub client lib instead of the SDK, see internal/ts3stub
+import _ "github.com/Piekario/ts3sdk/internal/ts3stub"
@@ -5,8 +5,8 @@
 package ts3sdk
 
 /*
-#cgo windows LDFLAGS: -L${SRCDIR}/ts_sdk_3.3.1/lib/windows -lts3client_win64
 #cgo windows CFLAGS: -I${SRCDIR}/ts_sdk_3.3.1/include
+#cgo linux CFLAGS: -I${SRCDIR}/ts_sdk_3.3.1/include
 
 #include <stdlib.h>
 #include <teamspeak/clientlib.h>
@@ -17,23 +17,33 @@ package ts3sdk
 import "C"
 import (
 	"fmt"
-	"runtime"
+	"sync"
 	"unsafe"
 )
 
 // Error represents a TeamSpeak 3 error code
 type Error int
 
+// Messages never change for a code, so each is fetched from the client lib once
+var errorMessages sync.Map // Error -> string
+
 // Error implements the error interface
 func (e Error) Error() string {
 	if e == 0 {
 		return "ok"
 	}
+	if msg, ok := errorMessages.Load(e); ok {
+		return msg.(string)
+	}
 
 	var errorMsg *C.char
-	C.ts3client_getErrorMessage(C.uint(e), &errorMsg)
+	if C.ts3client_getErrorMessage(C.uint(e), &errorMsg) != C.ERROR_ok {
+		return fmt.Sprintf("TeamSpeak error %d", int(e))
+	}
 	defer C.ts3client_freeMemory(unsafe.Pointer(errorMsg))
-	return fmt.Sprintf("TeamSpeak error %d: %s", int(e), C.GoString(errorMsg))
+	msg := fmt.Sprintf("TeamSpeak error %d: %s", int(e), C.GoString(errorMsg))
+	errorMessages.Store(e, msg)
+	return msg
 }
 
 // Common error codes
@@ -45,6 +55,10 @@ const (
 	ErrorDontNotify          = Error(C.ERROR_dont_notify)
 	ErrorLibTimeLimitReached = Error(C.ERROR_lib_time_limit_reached)
 	ErrorOutOfMemory         = Error(C.ERROR_out_of_memory)
+	ErrorParameterInvalid    = Error(C.ERROR_parameter_invalid)
+	ErrorSoundNoData         = Error(C.ERROR_sound_no_data)
+	ErrorSoundUnknownDevice  = Error(C.ERROR_sound_unknown_device)
+	ErrorConnectionLost      = Error(C.ERROR_connection_lost)
 )
 
 // ConnectStatus represents the connection status
@@ -68,24 +82,22 @@ type ClientID uint16
 // ChannelID represents a channel ID
 type ChannelID uint64
 
-// Initialize initializes the TeamSpeak 3 Client SDK
-func Initialize(clientLibPath, resourcePath string, logTypes int) error {
-	cClientLibPath := C.CString(clientLibPath)
-	defer C.free(unsafe.Pointer(cClientLibPath))
+// Initialize initializes the TeamSpeak 3 Client SDK. Empty folders use the working directory.
+//
+// The client lib takes its callbacks only here, so the callback table is registered once and
+// every event goes to the callbacks set with SetClientCallbacks or SetClientCallbacksBatched,
+// which may be called before or after Initialize.
+func Initialize(logFileFolder, resourcesFolder string, logTypes int) error {
+	a := getCArena(logFileFolder, resourcesFolder)
+	defer putCArena(a)
 
-	cResourcePath := C.CString(resourcePath)
-	defer C.free(unsafe.Pointer(cResourcePath))
+	var funcs C.struct_ClientUIFunctions
+	fillCallbacks(&funcs)
 
-	err := C.ts3client_initClientLib(C.int(logTypes), cClientLibPath, cResourcePath)
+	err := C.ts3client_initClientLib(&funcs, nil, C.int(logTypes), a.str(0), a.str(1))
 	if err != C.ERROR_ok {
 		return Error(err)
 	}
-
-	// Set up finalizer to ensure we clean up
-	runtime.SetFinalizer(&struct{}{}, func(_ interface{}) {
-		C.ts3client_destroyClientLib()
-	})
-
 	return nil
 }
 
@@ -114,6 +126,7 @@ func DestroyServerConnectionHandler(serverConnectionHandlerID ConnectionHandlerI
 	if err != C.ERROR_ok {
 		return Error(err)
 	}
+	forgetRequestWindow(serverConnectionHandlerID)
 	return nil
 }
 
@@ -130,30 +143,18 @@ func GetClientLibVersion() (string, error) {
 
 // StartConnection starts a connection to a TeamSpeak 3 server
 func StartConnection(serverConnectionHandlerID ConnectionHandlerID, identity, ip string, port uint16, nickname, defaultChannelPassword, serverPassword string) error {
-	cIdentity := C.CString(identity)
-	defer C.free(unsafe.Pointer(cIdentity))
-
-	cIP := C.CString(ip)
-	defer C.free(unsafe.Pointer(cIP))
-
-	cNickname := C.CString(nickname)
-	defer C.free(unsafe.Pointer(cNickname))
-
-	cDefaultChannelPassword := C.CString(defaultChannelPassword)
-	defer C.free(unsafe.Pointer(cDefaultChannelPassword))
-
-	cServerPassword := C.CString(serverPassword)
-	defer C.free(unsafe.Pointer(cServerPassword))
+	a := getCArena(identity, ip, nickname, defaultChannelPassword, serverPassword)
+	defer putCArena(a)
 
 	err := C.ts3client_startConnection(
 		C.uint64(serverConnectionHandlerID),
-		cIdentity,
-		cIP,
+		a.str(0), // identity
+		a.str(1), // ip
 		C.uint(port),
-		cNickname,
-		nil, // default channel
-		cDefaultChannelPassword,
-		cServerPassword,
+		a.str(2), // nickname
+		nil,      // default channel
+		a.str(3), // default channel password
+		a.str(4), // server password
 	)
 	if err != C.ERROR_ok {
 		return Error(err)
@@ -163,10 +164,10 @@ func StartConnection(serverConnectionHandlerID ConnectionHandlerID, identity, ip
 
 // StopConnection stops a connection to a TeamSpeak 3 server
 func StopConnection(serverConnectionHandlerID ConnectionHandlerID, quitMessage string) error {
-	cQuitMessage := C.CString(quitMessage)
-	defer C.free(unsafe.Pointer(cQuitMessage))
+	a := getCArena(quitMessage)
+	defer putCArena(a)
 
-	err := C.ts3client_stopConnection(C.uint64(serverConnectionHandlerID), cQuitMessage)
+	err := C.ts3client_stopConnection(C.uint64(serverConnectionHandlerID), a.str(0))
 	if err != C.ERROR_ok {
 		return Error(err)
 	}
@@ -183,16 +184,41 @@ func GetConnectionStatus(serverConnectionHandlerID ConnectionHandlerID) (Connect
 	return ConnectStatus(status), nil
 }
 
+// OpenCaptureDevice opens a capture device on a connection. An empty mode and device open the default device.
+func OpenCaptureDevice(serverConnectionHandlerID ConnectionHandlerID, mode, device string) error {
+	a := getCArena(mode, device)
+	defer putCArena(a)
+
+	err := C.ts3client_openCaptureDevice(C.uint64(serverConnectionHandlerID), a.str(0), a.str(1))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// OpenPlaybackDevice opens a playback device on a connection. An empty mode and device open the default device.
+func OpenPlaybackDevice(serverConnectionHandlerID ConnectionHandlerID, mode, device string) error {
+	a := getCArena(mode, device)
+	defer putCArena(a)
+
+	err := C.ts3client_openPlaybackDevice(C.uint64(serverConnectionHandlerID), a.str(0), a.str(1))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
 // RequestClientMove requests to move a client to another channel
 func RequestClientMove(serverConnectionHandlerID ConnectionHandlerID, clientID ClientID, newChannelID ChannelID, password string) error {
-	cPassword := C.CString(password)
-	defer C.free(unsafe.Pointer(cPassword))
+	a := getCArena(password)
+	defer putCArena(a)
 
+	clientIDArray := [2]C.anyID{C.anyID(clientID), 0}
 	err := C.ts3client_requestClientMove(
 		C.uint64(serverConnectionHandlerID),
-		C.anyID(clientID),
+		&clientIDArray[0],
 		C.uint64(newChannelID),
-		cPassword,
+		a.str(0),
 		nil,
 	)
 	if err != C.ERROR_ok {
@@ -203,12 +229,12 @@ func RequestClientMove(serverConnectionHandlerID ConnectionHandlerID, clientID C
 
 // RequestSendPrivateTextMsg sends a private text message to a client
 func RequestSendPrivateTextMsg(serverConnectionHandlerID ConnectionHandlerID, message string, targetClientID ClientID) error {
-	cMessage := C.CString(message)
-	defer C.free(unsafe.Pointer(cMessage))
+	a := getCArena(message)
+	defer putCArena(a)
 
 	err := C.ts3client_requestSendPrivateTextMsg(
 		C.uint64(serverConnectionHandlerID),
-		cMessage,
+		a.str(0),
 		C.anyID(targetClientID),
 		nil,
 	)
@@ -220,12 +246,12 @@ func RequestSendPrivateTextMsg(serverConnectionHandlerID ConnectionHandlerID, me
 
 // RequestSendChannelTextMsg sends a text message to a channel
 func RequestSendChannelTextMsg(serverConnectionHandlerID ConnectionHandlerID, message string, targetChannelID ChannelID) error {
-	cMessage := C.CString(message)
-	defer C.free(unsafe.Pointer(cMessage))
+	a := getCArena(message)
+	defer putCArena(a)
 
 	err := C.ts3client_requestSendChannelTextMsg(
 		C.uint64(serverConnectionHandlerID),
-		cMessage,
+		a.str(0),
 		C.uint64(targetChannelID),
 		nil,
 	)
@@ -237,12 +263,12 @@ func RequestSendChannelTextMsg(serverConnectionHandlerID ConnectionHandlerID, me
 
 // RequestSendServerTextMsg sends a text message to the server
 func RequestSendServerTextMsg(serverConnectionHandlerID ConnectionHandlerID, message string) error {
-	cMessage := C.CString(message)
-	defer C.free(unsafe.Pointer(cMessage))
+	a := getCArena(message)
+	defer putCArena(a)
 
 	err := C.ts3client_requestSendServerTextMsg(
 		C.uint64(serverConnectionHandlerID),
-		cMessage,
+		a.str(0),
 		nil,
 	)
 	if err != C.ERROR_ok {
@@ -260,3 +286,102 @@ func GetClientID(serverConnectionHandlerID ConnectionHandlerID) (ClientID, error
 	}
 	return ClientID(clientID), nil
 }
+
+// GetClientVariableAsString returns a string property of a client, see the ClientProperties enum values
+func GetClientVariableAsString(serverConnectionHandlerID ConnectionHandlerID, clientID ClientID, flag ClientProperties) (string, error) {
+	var result *C.char
+	err := C.ts3client_getClientVariableAsString(C.uint64(serverConnectionHandlerID), C.anyID(clientID), C.size_t(flag), &result)
+	if err != C.ERROR_ok {
+		return "", Error(err)
+	}
+	defer C.ts3client_freeMemory(unsafe.Pointer(result))
+	return C.GoString(result), nil
+}
+
+// GetClientVariableAsInt returns an integer property of a client, see the ClientProperties enum values
+func GetClientVariableAsInt(serverConnectionHandlerID ConnectionHandlerID, clientID ClientID, flag ClientProperties) (int, error) {
+	var result C.int
+	err := C.ts3client_getClientVariableAsInt(C.uint64(serverConnectionHandlerID), C.anyID(clientID), C.size_t(flag), &result)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return int(result), nil
+}
+
+// GetChannelVariableAsString returns a string property of a channel, see the ChannelProperties enum values
+func GetChannelVariableAsString(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID, flag ChannelProperties) (string, error) {
+	var result *C.char
+	err := C.ts3client_getChannelVariableAsString(C.uint64(serverConnectionHandlerID), C.uint64(channelID), C.size_t(flag), &result)
+	if err != C.ERROR_ok {
+		return "", Error(err)
+	}
+	defer C.ts3client_freeMemory(unsafe.Pointer(result))
+	return C.GoString(result), nil
+}
+
+// GetChannelOfClient returns the channel a client is in
+func GetChannelOfClient(serverConnectionHandlerID ConnectionHandlerID, clientID ClientID) (ChannelID, error) {
+	var result C.uint64
+	err := C.ts3client_getChannelOfClient(C.uint64(serverConnectionHandlerID), C.anyID(clientID), &result)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return ChannelID(result), nil
+}
+
+// GetParentChannelOfChannel returns the parent of a channel, 0 for top level channels
+func GetParentChannelOfChannel(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID) (ChannelID, error) {
+	var result C.uint64
+	err := C.ts3client_getParentChannelOfChannel(C.uint64(serverConnectionHandlerID), C.uint64(channelID), &result)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return ChannelID(result), nil
+}
+
+// GetClientList returns the IDs of all visible clients
+func GetClientList(serverConnectionHandlerID ConnectionHandlerID) ([]ClientID, error) {
+	var result *C.anyID
+	err := C.ts3client_getClientList(C.uint64(serverConnectionHandlerID), &result)
+	if err != C.ERROR_ok {
+		return nil, Error(err)
+	}
+	defer C.ts3client_freeMemory(unsafe.Pointer(result))
+	return clientIDsFromArray(result), nil
+}
+
+// GetChannelClientList returns the IDs of all visible clients in a channel
+func GetChannelClientList(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID) ([]ClientID, error) {
+	var result *C.anyID
+	err := C.ts3client_getChannelClientList(C.uint64(serverConnectionHandlerID), C.uint64(channelID), &result)
+	if err != C.ERROR_ok {
+		return nil, Error(err)
+	}
+	defer C.ts3client_freeMemory(unsafe.Pointer(result))
+	return clientIDsFromArray(result), nil
+}
+
+// GetChannelList returns the IDs of all channels
+func GetChannelList(serverConnectionHandlerID ConnectionHandlerID) ([]ChannelID, error) {
+	var result *C.uint64
+	err := C.ts3client_getChannelList(C.uint64(serverConnectionHandlerID), &result)
+	if err != C.ERROR_ok {
+		return nil, Error(err)
+	}
+	defer C.ts3client_freeMemory(unsafe.Pointer(result))
+
+	var channelIDs []ChannelID
+	for p := result; *p != 0; p = (*C.uint64)(unsafe.Add(unsafe.Pointer(p), unsafe.Sizeof(*p))) {
+		channelIDs = append(channelIDs, ChannelID(*p))
+	}
+	return channelIDs, nil
+}
+
+// clientIDsFromArray copies a zero terminated client ID array returned by the client lib
+func clientIDsFromArray(array *C.anyID) []ClientID {
+	var clientIDs []ClientID
+	for p := array; *p != 0; p = (*C.anyID)(unsafe.Add(unsafe.Pointer(p), unsafe.Sizeof(*p))) {
+		clientIDs = append(clientIDs, ClientID(*p))
+	}
+	return clientIDs
+}
@@ -0,0 +1,2767 @@
+// Code generated by ts3gen from clientlib.h and public_definitions.h. DO NOT EDIT.
+
+package ts3sdk
+
+/*
+#include <stdlib.h>
+#include <teamspeak/clientlib.h>
+#include <teamspeak/public_definitions.h>
+#include <teamspeak/public_errors.h>
+#include "eventqueue_gen.h"
+
+extern void onUserLoggingMessageEvent(char*, int, char*, uint64, char*, char*);
+*/
+import "C"
+import (
+	"context"
+	"unsafe"
+)
+
+// GetClientLibVersionNumber binds ts3client_getClientLibVersionNumber
+//
+// Get the version number of the client library
+func GetClientLibVersionNumber() (uint64, error) {
+	var cResult C.uint64
+
+	err := C.ts3client_getClientLibVersionNumber(&cResult)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return uint64(cResult), nil
+}
+
+// CreateIdentity binds ts3client_createIdentity
+//
+// Create a new identity to use for connecting to a server
+func CreateIdentity() (string, error) {
+	var cResult *C.char
+
+	err := C.ts3client_createIdentity(&cResult)
+	if err != C.ERROR_ok {
+		return "", Error(err)
+	}
+	defer C.ts3client_freeMemory(unsafe.Pointer(cResult))
+	return C.GoString(cResult), nil
+}
+
+// IdentityStringToUniqueIdentifier binds ts3client_identityStringToUniqueIdentifier
+//
+// Get the unique client identifier from an identity
+func IdentityStringToUniqueIdentifier(identityString string) (string, error) {
+	var cResult *C.char
+
+	a := getCArena(identityString)
+	defer putCArena(a)
+
+	err := C.ts3client_identityStringToUniqueIdentifier(a.str(0), &cResult)
+	if err != C.ERROR_ok {
+		return "", Error(err)
+	}
+	defer C.ts3client_freeMemory(unsafe.Pointer(cResult))
+	return C.GoString(cResult), nil
+}
+
+// GetDefaultPlayBackMode binds ts3client_getDefaultPlayBackMode
+//
+// Retrieve the current default playback mode
+func GetDefaultPlayBackMode() (string, error) {
+	var cResult *C.char
+
+	err := C.ts3client_getDefaultPlayBackMode(&cResult)
+	if err != C.ERROR_ok {
+		return "", Error(err)
+	}
+	defer C.ts3client_freeMemory(unsafe.Pointer(cResult))
+	return C.GoString(cResult), nil
+}
+
+// GetDefaultCaptureMode binds ts3client_getDefaultCaptureMode
+//
+// Retrieve the current default capture mode
+func GetDefaultCaptureMode() (string, error) {
+	var cResult *C.char
+
+	err := C.ts3client_getDefaultCaptureMode(&cResult)
+	if err != C.ERROR_ok {
+		return "", Error(err)
+	}
+	defer C.ts3client_freeMemory(unsafe.Pointer(cResult))
+	return C.GoString(cResult), nil
+}
+
+// GetCurrentPlaybackDeviceName binds ts3client_getCurrentPlaybackDeviceName
+//
+// Retrieve the device name that is currently used to play audio on a server
+func GetCurrentPlaybackDeviceName(serverConnectionHandlerID ConnectionHandlerID) (string, int, error) {
+	var cResult *C.char
+	var cIsDefault C.int
+
+	err := C.ts3client_getCurrentPlaybackDeviceName(C.uint64(serverConnectionHandlerID), &cResult, &cIsDefault)
+	if err != C.ERROR_ok {
+		return "", 0, Error(err)
+	}
+	defer C.ts3client_freeMemory(unsafe.Pointer(cResult))
+	return C.GoString(cResult), int(cIsDefault), nil
+}
+
+// GetCurrentPlayBackMode binds ts3client_getCurrentPlayBackMode
+//
+// Retrieve the mode the current playback device on a server is using
+func GetCurrentPlayBackMode(serverConnectionHandlerID ConnectionHandlerID) (string, error) {
+	var cResult *C.char
+
+	err := C.ts3client_getCurrentPlayBackMode(C.uint64(serverConnectionHandlerID), &cResult)
+	if err != C.ERROR_ok {
+		return "", Error(err)
+	}
+	defer C.ts3client_freeMemory(unsafe.Pointer(cResult))
+	return C.GoString(cResult), nil
+}
+
+// GetCurrentCaptureDeviceName binds ts3client_getCurrentCaptureDeviceName
+//
+// Retrieve the device name that is currently used to capture audio on a server
+func GetCurrentCaptureDeviceName(serverConnectionHandlerID ConnectionHandlerID) (string, int, error) {
+	var cResult *C.char
+	var cIsDefault C.int
+
+	err := C.ts3client_getCurrentCaptureDeviceName(C.uint64(serverConnectionHandlerID), &cResult, &cIsDefault)
+	if err != C.ERROR_ok {
+		return "", 0, Error(err)
+	}
+	defer C.ts3client_freeMemory(unsafe.Pointer(cResult))
+	return C.GoString(cResult), int(cIsDefault), nil
+}
+
+// GetCurrentCaptureMode binds ts3client_getCurrentCaptureMode
+//
+// Retrieve the mode the current capture device on a server is using
+func GetCurrentCaptureMode(serverConnectionHandlerID ConnectionHandlerID) (string, error) {
+	var cResult *C.char
+
+	err := C.ts3client_getCurrentCaptureMode(C.uint64(serverConnectionHandlerID), &cResult)
+	if err != C.ERROR_ok {
+		return "", Error(err)
+	}
+	defer C.ts3client_freeMemory(unsafe.Pointer(cResult))
+	return C.GoString(cResult), nil
+}
+
+// InitiateGracefulPlaybackShutdown binds ts3client_initiateGracefulPlaybackShutdown
+//
+// Close the playback device after all currently playing sounds are done playing
+func InitiateGracefulPlaybackShutdown(serverConnectionHandlerID ConnectionHandlerID) error {
+	err := C.ts3client_initiateGracefulPlaybackShutdown(C.uint64(serverConnectionHandlerID))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// ClosePlaybackDevice binds ts3client_closePlaybackDevice
+//
+// Immediately close the current playback device on a connection handler
+func ClosePlaybackDevice(serverConnectionHandlerID ConnectionHandlerID) error {
+	err := C.ts3client_closePlaybackDevice(C.uint64(serverConnectionHandlerID))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// CloseCaptureDevice binds ts3client_closeCaptureDevice
+//
+// Immediately close the current capture device on a connection handler
+func CloseCaptureDevice(serverConnectionHandlerID ConnectionHandlerID) error {
+	err := C.ts3client_closeCaptureDevice(C.uint64(serverConnectionHandlerID))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// ActivateCaptureDevice binds ts3client_activateCaptureDevice
+//
+// Activate a previously opened capture device on a server connection
+func ActivateCaptureDevice(serverConnectionHandlerID ConnectionHandlerID) error {
+	err := C.ts3client_activateCaptureDevice(C.uint64(serverConnectionHandlerID))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// PlayWaveFile binds ts3client_playWaveFile
+//
+// Play a local wave file on the playback device of the connection handler
+func PlayWaveFile(serverConnectionHandlerID ConnectionHandlerID, path string) error {
+	a := getCArena(path)
+	defer putCArena(a)
+
+	err := C.ts3client_playWaveFile(C.uint64(serverConnectionHandlerID), a.str(0))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// PlayWaveFileHandle binds ts3client_playWaveFileHandle
+//
+// Play a local wave file on the playback device of the connection handler
+func PlayWaveFileHandle(serverConnectionHandlerID ConnectionHandlerID, path string, loop int) (uint64, error) {
+	var cWaveHandle C.uint64
+
+	a := getCArena(path)
+	defer putCArena(a)
+
+	err := C.ts3client_playWaveFileHandle(C.uint64(serverConnectionHandlerID), a.str(0), C.int(loop), &cWaveHandle)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return uint64(cWaveHandle), nil
+}
+
+// PauseWaveFileHandle binds ts3client_pauseWaveFileHandle
+//
+// Pauses or resumes playback of a wave file handle retrieved by ts3client_playWaveFileHandle
+func PauseWaveFileHandle(serverConnectionHandlerID ConnectionHandlerID, waveHandle uint64, pause int) error {
+	err := C.ts3client_pauseWaveFileHandle(C.uint64(serverConnectionHandlerID), C.uint64(waveHandle), C.int(pause))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// CloseWaveFileHandle binds ts3client_closeWaveFileHandle
+//
+// Stops playback of, closes the wave file and invalidates the handle retrieved by ts3client_playWaveFileHandle
+func CloseWaveFileHandle(serverConnectionHandlerID ConnectionHandlerID, waveHandle uint64) error {
+	err := C.ts3client_closeWaveFileHandle(C.uint64(serverConnectionHandlerID), C.uint64(waveHandle))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// SetLocalTestMode binds ts3client_setLocalTestMode
+//
+// Route captured audio directly to the playback device rather than through the network
+func SetLocalTestMode(serverConnectionHandlerID ConnectionHandlerID, status int) error {
+	err := C.ts3client_setLocalTestMode(C.uint64(serverConnectionHandlerID), C.int(status))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// StartVoiceRecording binds ts3client_startVoiceRecording
+//
+// Flags the client as recording received audio transmissions
+func StartVoiceRecording(serverConnectionHandlerID ConnectionHandlerID) error {
+	err := C.ts3client_startVoiceRecording(C.uint64(serverConnectionHandlerID))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// StopVoiceRecording binds ts3client_stopVoiceRecording
+//
+// Flags the client as no longer recording audio transmissions
+func StopVoiceRecording(serverConnectionHandlerID ConnectionHandlerID) error {
+	err := C.ts3client_stopVoiceRecording(C.uint64(serverConnectionHandlerID))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// AllowWhispersFrom binds ts3client_allowWhispersFrom
+//
+// Allow another client to whisper us
+func AllowWhispersFrom(serverConnectionHandlerID ConnectionHandlerID, clID ClientID) error {
+	err := C.ts3client_allowWhispersFrom(C.uint64(serverConnectionHandlerID), C.anyID(clID))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RemoveFromAllowedWhispersFrom binds ts3client_removeFromAllowedWhispersFrom
+//
+// Removes a client from the allowed whisper list
+func RemoveFromAllowedWhispersFrom(serverConnectionHandlerID ConnectionHandlerID, clID ClientID) error {
+	err := C.ts3client_removeFromAllowedWhispersFrom(C.uint64(serverConnectionHandlerID), C.anyID(clID))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// GetWhisperReceiveWhitelist binds ts3client_getWhisperReceiveWhitelist
+//
+// Retrieve the list of clients we allow to whisper us
+func GetWhisperReceiveWhitelist(serverConnectionHandlerID ConnectionHandlerID) ([]ClientID, error) {
+	var cResult *C.anyID
+
+	err := C.ts3client_getWhisperReceiveWhitelist(C.uint64(serverConnectionHandlerID), &cResult)
+	if err != C.ERROR_ok {
+		return nil, Error(err)
+	}
+	defer C.ts3client_freeMemory(unsafe.Pointer(cResult))
+	return clientIDsFromArray(cResult), nil
+}
+
+// IsWhisperReceiveWhitelisted binds ts3client_isWhisperReceiveWhitelisted
+//
+// Check if we allow receiving whispers from a client
+func IsWhisperReceiveWhitelisted(serverConnectionHandlerID ConnectionHandlerID, clientID ClientID) (int, error) {
+	var cResult C.int
+
+	err := C.ts3client_isWhisperReceiveWhitelisted(C.uint64(serverConnectionHandlerID), C.anyID(clientID), &cResult)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return int(cResult), nil
+}
+
+// SetWhisperReceiveWhitelist binds ts3client_setWhisperReceiveWhitelist
+//
+// Set the list of clients we allow to whisper us
+func SetWhisperReceiveWhitelist(serverConnectionHandlerID ConnectionHandlerID, clientIDs []ClientID) error {
+	cClientIDs := make([]C.anyID, len(clientIDs)+1)
+	for i, id := range clientIDs {
+		cClientIDs[i] = C.anyID(id)
+	}
+
+	err := C.ts3client_setWhisperReceiveWhitelist(C.uint64(serverConnectionHandlerID), &cClientIDs[0])
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// Systemset3DSettings binds ts3client_systemset3DSettings
+//
+// Change 3D sound attenuation and distance settings
+func Systemset3DSettings(serverConnectionHandlerID ConnectionHandlerID, distanceFactor float32, rolloffScale float32) error {
+	err := C.ts3client_systemset3DSettings(C.uint64(serverConnectionHandlerID), C.float(distanceFactor), C.float(rolloffScale))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// GetPreProcessorInfoValueFloat binds ts3client_getPreProcessorInfoValueFloat
+//
+// Retrieve floating point preprocessor configuration values
+func GetPreProcessorInfoValueFloat(serverConnectionHandlerID ConnectionHandlerID, ident string) (float32, error) {
+	var cResult C.float
+
+	a := getCArena(ident)
+	defer putCArena(a)
+
+	err := C.ts3client_getPreProcessorInfoValueFloat(C.uint64(serverConnectionHandlerID), a.str(0), &cResult)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return float32(cResult), nil
+}
+
+// GetPreProcessorConfigValue binds ts3client_getPreProcessorConfigValue
+//
+// Retrieve preprocessor configuration values
+func GetPreProcessorConfigValue(serverConnectionHandlerID ConnectionHandlerID, ident string) (string, error) {
+	var cResult *C.char
+
+	a := getCArena(ident)
+	defer putCArena(a)
+
+	err := C.ts3client_getPreProcessorConfigValue(C.uint64(serverConnectionHandlerID), a.str(0), &cResult)
+	if err != C.ERROR_ok {
+		return "", Error(err)
+	}
+	defer C.ts3client_freeMemory(unsafe.Pointer(cResult))
+	return C.GoString(cResult), nil
+}
+
+// SetPreProcessorConfigValue binds ts3client_setPreProcessorConfigValue
+//
+// Set preprocessor configuration values
+func SetPreProcessorConfigValue(serverConnectionHandlerID ConnectionHandlerID, ident string, value string) error {
+	a := getCArena(ident, value)
+	defer putCArena(a)
+
+	err := C.ts3client_setPreProcessorConfigValue(C.uint64(serverConnectionHandlerID), a.str(0), a.str(1))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// SetKeyPressedDuringChunk binds ts3client_setKeyPressedDuringChunk
+//
+// Indicates to the client that a key press has occurred and that it should run the typing attenuation algoritm
+func SetKeyPressedDuringChunk() error {
+	err := C.ts3client_setKeyPressedDuringChunk()
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// GetGlobalConfigValueAsInt binds ts3client_getGlobalConfigValueAsInt
+//
+// Gets global client configuration values
+func GetGlobalConfigValueAsInt(ident string) (int, error) {
+	var cResult C.int
+
+	a := getCArena(ident)
+	defer putCArena(a)
+
+	err := C.ts3client_getGlobalConfigValueAsInt(a.str(0), &cResult)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return int(cResult), nil
+}
+
+// SetGlobalConfigValue binds ts3client_setGlobalConfigValue
+//
+// Allows changing global client configuration values
+func SetGlobalConfigValue(ident string, value string) error {
+	a := getCArena(ident, value)
+	defer putCArena(a)
+
+	err := C.ts3client_setGlobalConfigValue(a.str(0), a.str(1))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// GetEncodeConfigValue binds ts3client_getEncodeConfigValue
+//
+// Retrieve voice encoder information
+func GetEncodeConfigValue(serverConnectionHandlerID ConnectionHandlerID, ident string) (string, error) {
+	var cResult *C.char
+
+	a := getCArena(ident)
+	defer putCArena(a)
+
+	err := C.ts3client_getEncodeConfigValue(C.uint64(serverConnectionHandlerID), a.str(0), &cResult)
+	if err != C.ERROR_ok {
+		return "", Error(err)
+	}
+	defer C.ts3client_freeMemory(unsafe.Pointer(cResult))
+	return C.GoString(cResult), nil
+}
+
+// GetPlaybackConfigValueAsFloat binds ts3client_getPlaybackConfigValueAsFloat
+//
+// Retrieve floating point playback configuration settings
+func GetPlaybackConfigValueAsFloat(serverConnectionHandlerID ConnectionHandlerID, ident string) (float32, error) {
+	var cResult C.float
+
+	a := getCArena(ident)
+	defer putCArena(a)
+
+	err := C.ts3client_getPlaybackConfigValueAsFloat(C.uint64(serverConnectionHandlerID), a.str(0), &cResult)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return float32(cResult), nil
+}
+
+// SetPlaybackConfigValue binds ts3client_setPlaybackConfigValue
+//
+// Set playback configuration settings
+func SetPlaybackConfigValue(serverConnectionHandlerID ConnectionHandlerID, ident string, value string) error {
+	a := getCArena(ident, value)
+	defer putCArena(a)
+
+	err := C.ts3client_setPlaybackConfigValue(C.uint64(serverConnectionHandlerID), a.str(0), a.str(1))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// SetClientVolumeModifier binds ts3client_setClientVolumeModifier
+//
+// Adjust playback volume of an individual client
+func SetClientVolumeModifier(serverConnectionHandlerID ConnectionHandlerID, clientID ClientID, value float32) error {
+	err := C.ts3client_setClientVolumeModifier(C.uint64(serverConnectionHandlerID), C.anyID(clientID), C.float(value))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// LogMessage binds ts3client_logMessage
+//
+// Log a message to the client log
+func LogMessage(logMessage string, severity int, channel string, logID uint64) error {
+	a := getCArena(logMessage, channel)
+	defer putCArena(a)
+
+	err := C.ts3client_logMessage(a.str(0), C.enum_LogLevel(severity), a.str(1), C.uint64(logID))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// SetLogVerbosity binds ts3client_setLogVerbosity
+//
+// When using custom logging define the severity of log messages above which to call the onUserLoggingMessageEvent for
+func SetLogVerbosity(logVerbosity int) error {
+	err := C.ts3client_setLogVerbosity(C.enum_LogLevel(logVerbosity))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// StartConnectionWithChannelID binds ts3client_startConnectionWithChannelID
+//
+// Initiates a connection to a TeamSpeak server
+func StartConnectionWithChannelID(serverConnectionHandlerID ConnectionHandlerID, identity string, ip string, port uint32, nickname string, defaultChannelId ChannelID, defaultChannelPassword string, serverPassword string) error {
+	a := getCArena(identity, ip, nickname, defaultChannelPassword, serverPassword)
+	defer putCArena(a)
+
+	err := C.ts3client_startConnectionWithChannelID(C.uint64(serverConnectionHandlerID), a.str(0), a.str(1), C.uint(port), a.str(2), C.uint64(defaultChannelId), a.str(3), a.str(4))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RequestClientVariables binds ts3client_requestClientVariables
+//
+// Ask the server to provide additional request only variables for a client
+func RequestClientVariables(serverConnectionHandlerID ConnectionHandlerID, clientID ClientID) error {
+	err := C.ts3client_requestClientVariables(C.uint64(serverConnectionHandlerID), C.anyID(clientID), nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RequestClientVariablesAsync binds ts3client_requestClientVariables
+//
+// Ask the server to provide additional request only variables for a client
+func RequestClientVariablesAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, clientID ClientID) (*Request, error) {
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestClientVariables(C.uint64(serverConnectionHandlerID), C.anyID(clientID), a.str(0))
+	})
+}
+
+// RequestClientKickFromChannel binds ts3client_requestClientKickFromChannel
+//
+// Request client(s) to be kicked from their current channel
+func RequestClientKickFromChannel(serverConnectionHandlerID ConnectionHandlerID, clientIDArray []ClientID, kickReason string) error {
+	cClientIDArray := make([]C.anyID, len(clientIDArray)+1)
+	for i, id := range clientIDArray {
+		cClientIDArray[i] = C.anyID(id)
+	}
+
+	a := getCArena(kickReason)
+	defer putCArena(a)
+
+	err := C.ts3client_requestClientKickFromChannel(C.uint64(serverConnectionHandlerID), &cClientIDArray[0], a.str(0), nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RequestClientKickFromChannelAsync binds ts3client_requestClientKickFromChannel
+//
+// Request client(s) to be kicked from their current channel
+func RequestClientKickFromChannelAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, clientIDArray []ClientID, kickReason string) (*Request, error) {
+	cClientIDArray := make([]C.anyID, len(clientIDArray)+1)
+	for i, id := range clientIDArray {
+		cClientIDArray[i] = C.anyID(id)
+	}
+
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(kickReason, returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestClientKickFromChannel(C.uint64(serverConnectionHandlerID), &cClientIDArray[0], a.str(0), a.str(1))
+	})
+}
+
+// RequestClientKickFromServer binds ts3client_requestClientKickFromServer
+//
+// Request client(s) to be kicked from the server
+func RequestClientKickFromServer(serverConnectionHandlerID ConnectionHandlerID, clientIDArray []ClientID, kickReason string) error {
+	cClientIDArray := make([]C.anyID, len(clientIDArray)+1)
+	for i, id := range clientIDArray {
+		cClientIDArray[i] = C.anyID(id)
+	}
+
+	a := getCArena(kickReason)
+	defer putCArena(a)
+
+	err := C.ts3client_requestClientKickFromServer(C.uint64(serverConnectionHandlerID), &cClientIDArray[0], a.str(0), nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RequestClientKickFromServerAsync binds ts3client_requestClientKickFromServer
+//
+// Request client(s) to be kicked from the server
+func RequestClientKickFromServerAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, clientIDArray []ClientID, kickReason string) (*Request, error) {
+	cClientIDArray := make([]C.anyID, len(clientIDArray)+1)
+	for i, id := range clientIDArray {
+		cClientIDArray[i] = C.anyID(id)
+	}
+
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(kickReason, returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestClientKickFromServer(C.uint64(serverConnectionHandlerID), &cClientIDArray[0], a.str(0), a.str(1))
+	})
+}
+
+// RequestChannelDelete binds ts3client_requestChannelDelete
+//
+// Request a channel to be deleted
+func RequestChannelDelete(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID, force int) error {
+	err := C.ts3client_requestChannelDelete(C.uint64(serverConnectionHandlerID), C.uint64(channelID), C.int(force), nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RequestChannelDeleteAsync binds ts3client_requestChannelDelete
+//
+// Request a channel to be deleted
+func RequestChannelDeleteAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID, force int) (*Request, error) {
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestChannelDelete(C.uint64(serverConnectionHandlerID), C.uint64(channelID), C.int(force), a.str(0))
+	})
+}
+
+// RequestChannelMove binds ts3client_requestChannelMove
+//
+// Move a channel in a tree or to a different parent channel
+func RequestChannelMove(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID, newChannelParentID ChannelID, newChannelOrder uint64) error {
+	err := C.ts3client_requestChannelMove(C.uint64(serverConnectionHandlerID), C.uint64(channelID), C.uint64(newChannelParentID), C.uint64(newChannelOrder), nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RequestChannelMoveAsync binds ts3client_requestChannelMove
+//
+// Move a channel in a tree or to a different parent channel
+func RequestChannelMoveAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID, newChannelParentID ChannelID, newChannelOrder uint64) (*Request, error) {
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestChannelMove(C.uint64(serverConnectionHandlerID), C.uint64(channelID), C.uint64(newChannelParentID), C.uint64(newChannelOrder), a.str(0))
+	})
+}
+
+// RequestChat binds ts3client_requestChat
+//
+// Request opening a new new-style chat room to the target user
+func RequestChat(serverConnectionHandlerID ConnectionHandlerID, type_ string, targetClientID ClientID) error {
+	a := getCArena(type_)
+	defer putCArena(a)
+
+	err := C.ts3client_requestChat(C.uint64(serverConnectionHandlerID), a.str(0), C.anyID(targetClientID), nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RequestChatAsync binds ts3client_requestChat
+//
+// Request opening a new new-style chat room to the target user
+func RequestChatAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, type_ string, targetClientID ClientID) (*Request, error) {
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(type_, returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestChat(C.uint64(serverConnectionHandlerID), a.str(0), C.anyID(targetClientID), a.str(1))
+	})
+}
+
+// RequestConnectionInfo binds ts3client_requestConnectionInfo
+//
+// Request connection variables for a client (e.g. bandwidth usage, ping)
+func RequestConnectionInfo(serverConnectionHandlerID ConnectionHandlerID, clientID ClientID) error {
+	err := C.ts3client_requestConnectionInfo(C.uint64(serverConnectionHandlerID), C.anyID(clientID), nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RequestConnectionInfoAsync binds ts3client_requestConnectionInfo
+//
+// Request connection variables for a client (e.g. bandwidth usage, ping)
+func RequestConnectionInfoAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, clientID ClientID) (*Request, error) {
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestConnectionInfo(C.uint64(serverConnectionHandlerID), C.anyID(clientID), a.str(0))
+	})
+}
+
+// RequestClientSetWhisperList binds ts3client_requestClientSetWhisperList
+//
+// Sets the client to which to transmit voice. Stops standard channel voice transmission
+func RequestClientSetWhisperList(serverConnectionHandlerID ConnectionHandlerID, clientID ClientID, targetChannelIDArray []ChannelID, targetClientIDArray []ClientID) error {
+	cTargetChannelIDArray := make([]C.uint64, len(targetChannelIDArray)+1)
+	for i, id := range targetChannelIDArray {
+		cTargetChannelIDArray[i] = C.uint64(id)
+	}
+	cTargetClientIDArray := make([]C.anyID, len(targetClientIDArray)+1)
+	for i, id := range targetClientIDArray {
+		cTargetClientIDArray[i] = C.anyID(id)
+	}
+
+	err := C.ts3client_requestClientSetWhisperList(C.uint64(serverConnectionHandlerID), C.anyID(clientID), &cTargetChannelIDArray[0], &cTargetClientIDArray[0], nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RequestClientSetWhisperListAsync binds ts3client_requestClientSetWhisperList
+//
+// Sets the client to which to transmit voice. Stops standard channel voice transmission
+func RequestClientSetWhisperListAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, clientID ClientID, targetChannelIDArray []ChannelID, targetClientIDArray []ClientID) (*Request, error) {
+	cTargetChannelIDArray := make([]C.uint64, len(targetChannelIDArray)+1)
+	for i, id := range targetChannelIDArray {
+		cTargetChannelIDArray[i] = C.uint64(id)
+	}
+	cTargetClientIDArray := make([]C.anyID, len(targetClientIDArray)+1)
+	for i, id := range targetClientIDArray {
+		cTargetClientIDArray[i] = C.anyID(id)
+	}
+
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestClientSetWhisperList(C.uint64(serverConnectionHandlerID), C.anyID(clientID), &cTargetChannelIDArray[0], &cTargetClientIDArray[0], a.str(0))
+	})
+}
+
+// RequestChannelSubscribe binds ts3client_requestChannelSubscribe
+//
+// Request live updates to specific channels, being able to see clients in the channel
+func RequestChannelSubscribe(serverConnectionHandlerID ConnectionHandlerID, channelIDArray []ChannelID) error {
+	cChannelIDArray := make([]C.uint64, len(channelIDArray)+1)
+	for i, id := range channelIDArray {
+		cChannelIDArray[i] = C.uint64(id)
+	}
+
+	err := C.ts3client_requestChannelSubscribe(C.uint64(serverConnectionHandlerID), &cChannelIDArray[0], nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RequestChannelSubscribeAll binds ts3client_requestChannelSubscribeAll
+//
+// Request live updates from all channels, being able to see clients in the channels
+func RequestChannelSubscribeAll(serverConnectionHandlerID ConnectionHandlerID) error {
+	err := C.ts3client_requestChannelSubscribeAll(C.uint64(serverConnectionHandlerID), nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RequestChannelSubscribeAllAsync binds ts3client_requestChannelSubscribeAll
+//
+// Request live updates from all channels, being able to see clients in the channels
+func RequestChannelSubscribeAllAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID) (*Request, error) {
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestChannelSubscribeAll(C.uint64(serverConnectionHandlerID), a.str(0))
+	})
+}
+
+// RequestChannelUnsubscribe binds ts3client_requestChannelUnsubscribe
+//
+// Remove subscription from channels. No longer receiving updates to clients in the channels
+func RequestChannelUnsubscribe(serverConnectionHandlerID ConnectionHandlerID, channelIDArray []ChannelID) error {
+	cChannelIDArray := make([]C.uint64, len(channelIDArray)+1)
+	for i, id := range channelIDArray {
+		cChannelIDArray[i] = C.uint64(id)
+	}
+
+	err := C.ts3client_requestChannelUnsubscribe(C.uint64(serverConnectionHandlerID), &cChannelIDArray[0], nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RequestChannelUnsubscribeAll binds ts3client_requestChannelUnsubscribeAll
+//
+// Remove subscription from all channels. No longer receiving updates to clients outside of own channel
+func RequestChannelUnsubscribeAll(serverConnectionHandlerID ConnectionHandlerID) error {
+	err := C.ts3client_requestChannelUnsubscribeAll(C.uint64(serverConnectionHandlerID), nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RequestChannelUnsubscribeAllAsync binds ts3client_requestChannelUnsubscribeAll
+//
+// Remove subscription from all channels. No longer receiving updates to clients outside of own channel
+func RequestChannelUnsubscribeAllAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID) (*Request, error) {
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestChannelUnsubscribeAll(C.uint64(serverConnectionHandlerID), a.str(0))
+	})
+}
+
+// RequestChannelDescription binds ts3client_requestChannelDescription
+//
+// Retrieve the channel description of the specified channel
+func RequestChannelDescription(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID) error {
+	err := C.ts3client_requestChannelDescription(C.uint64(serverConnectionHandlerID), C.uint64(channelID), nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RequestChannelDescriptionAsync binds ts3client_requestChannelDescription
+//
+// Retrieve the channel description of the specified channel
+func RequestChannelDescriptionAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID) (*Request, error) {
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestChannelDescription(C.uint64(serverConnectionHandlerID), C.uint64(channelID), a.str(0))
+	})
+}
+
+// RequestMuteClients binds ts3client_requestMuteClients
+//
+// Mute clients locally, the server will not be sending audio data for the specified clients anymore
+func RequestMuteClients(serverConnectionHandlerID ConnectionHandlerID, clientIDArray []ClientID) error {
+	cClientIDArray := make([]C.anyID, len(clientIDArray)+1)
+	for i, id := range clientIDArray {
+		cClientIDArray[i] = C.anyID(id)
+	}
+
+	err := C.ts3client_requestMuteClients(C.uint64(serverConnectionHandlerID), &cClientIDArray[0], nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RequestMuteClientsAsync binds ts3client_requestMuteClients
+//
+// Mute clients locally, the server will not be sending audio data for the specified clients anymore
+func RequestMuteClientsAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, clientIDArray []ClientID) (*Request, error) {
+	cClientIDArray := make([]C.anyID, len(clientIDArray)+1)
+	for i, id := range clientIDArray {
+		cClientIDArray[i] = C.anyID(id)
+	}
+
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestMuteClients(C.uint64(serverConnectionHandlerID), &cClientIDArray[0], a.str(0))
+	})
+}
+
+// RequestUnmuteClients binds ts3client_requestUnmuteClients
+//
+// Unmute clients locally. Server will start sending audio packets for the specified clients again
+func RequestUnmuteClients(serverConnectionHandlerID ConnectionHandlerID, clientIDArray []ClientID) error {
+	cClientIDArray := make([]C.anyID, len(clientIDArray)+1)
+	for i, id := range clientIDArray {
+		cClientIDArray[i] = C.anyID(id)
+	}
+
+	err := C.ts3client_requestUnmuteClients(C.uint64(serverConnectionHandlerID), &cClientIDArray[0], nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RequestUnmuteClientsAsync binds ts3client_requestUnmuteClients
+//
+// Unmute clients locally. Server will start sending audio packets for the specified clients again
+func RequestUnmuteClientsAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, clientIDArray []ClientID) (*Request, error) {
+	cClientIDArray := make([]C.anyID, len(clientIDArray)+1)
+	for i, id := range clientIDArray {
+		cClientIDArray[i] = C.anyID(id)
+	}
+
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestUnmuteClients(C.uint64(serverConnectionHandlerID), &cClientIDArray[0], a.str(0))
+	})
+}
+
+// RequestClientIDs binds ts3client_requestClientIDs
+//
+// Retrieve the current client ids of all clients connected using the specified unique identifier
+func RequestClientIDs(serverConnectionHandlerID ConnectionHandlerID, clientUniqueIdentifier string) error {
+	a := getCArena(clientUniqueIdentifier)
+	defer putCArena(a)
+
+	err := C.ts3client_requestClientIDs(C.uint64(serverConnectionHandlerID), a.str(0), nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RequestClientIDsAsync binds ts3client_requestClientIDs
+//
+// Retrieve the current client ids of all clients connected using the specified unique identifier
+func RequestClientIDsAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, clientUniqueIdentifier string) (*Request, error) {
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(clientUniqueIdentifier, returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestClientIDs(C.uint64(serverConnectionHandlerID), a.str(0), a.str(1))
+	})
+}
+
+// RequestSlotsFromProvisioningServer binds ts3client_requestSlotsFromProvisioningServer
+func RequestSlotsFromProvisioningServer(ip string, port uint16, serverPassword string, slots uint16, identity string, region string) (uint64, error) {
+	var cRequestHandle C.uint64
+
+	a := getCArena(ip, serverPassword, identity, region)
+	defer putCArena(a)
+
+	err := C.ts3client_requestSlotsFromProvisioningServer(a.str(0), C.ushort(port), a.str(1), C.ushort(slots), a.str(2), a.str(3), &cRequestHandle)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return uint64(cRequestHandle), nil
+}
+
+// CancelRequestSlotsFromProvisioningServer binds ts3client_cancelRequestSlotsFromProvisioningServer
+func CancelRequestSlotsFromProvisioningServer(requestHandle uint64) error {
+	err := C.ts3client_cancelRequestSlotsFromProvisioningServer(C.uint64(requestHandle))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// StartConnectionWithProvisioningKey binds ts3client_startConnectionWithProvisioningKey
+func StartConnectionWithProvisioningKey(serverConnectionHandlerID ConnectionHandlerID, identity string, nickname string, connectionKey string, clientMetaData string) error {
+	a := getCArena(identity, nickname, connectionKey, clientMetaData)
+	defer putCArena(a)
+
+	err := C.ts3client_startConnectionWithProvisioningKey(C.uint64(serverConnectionHandlerID), a.str(0), a.str(1), a.str(2), a.str(3))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// GetConnectionVariableAsUInt64 binds ts3client_getConnectionVariableAsUInt64
+//
+// Get value for connection based variable of a client as unsigned 64 bit integer
+func GetConnectionVariableAsUInt64(serverConnectionHandlerID ConnectionHandlerID, clientID ClientID, flag ConnectionProperties) (uint64, error) {
+	var cResult C.uint64
+
+	err := C.ts3client_getConnectionVariableAsUInt64(C.uint64(serverConnectionHandlerID), C.anyID(clientID), C.size_t(flag), &cResult)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return uint64(cResult), nil
+}
+
+// GetConnectionVariableAsDouble binds ts3client_getConnectionVariableAsDouble
+//
+// Get value for connection based variable of a client as double
+func GetConnectionVariableAsDouble(serverConnectionHandlerID ConnectionHandlerID, clientID ClientID, flag ConnectionProperties) (float64, error) {
+	var cResult C.double
+
+	err := C.ts3client_getConnectionVariableAsDouble(C.uint64(serverConnectionHandlerID), C.anyID(clientID), C.size_t(flag), &cResult)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return float64(cResult), nil
+}
+
+// GetConnectionVariableAsString binds ts3client_getConnectionVariableAsString
+//
+// Get value for connection based variable of a client as string
+func GetConnectionVariableAsString(serverConnectionHandlerID ConnectionHandlerID, clientID ClientID, flag ConnectionProperties) (string, error) {
+	var cResult *C.char
+
+	err := C.ts3client_getConnectionVariableAsString(C.uint64(serverConnectionHandlerID), C.anyID(clientID), C.size_t(flag), &cResult)
+	if err != C.ERROR_ok {
+		return "", Error(err)
+	}
+	defer C.ts3client_freeMemory(unsafe.Pointer(cResult))
+	return C.GoString(cResult), nil
+}
+
+// CleanUpConnectionInfo binds ts3client_cleanUpConnectionInfo
+//
+// TODO
+func CleanUpConnectionInfo(serverConnectionHandlerID ConnectionHandlerID, clientID ClientID) error {
+	err := C.ts3client_cleanUpConnectionInfo(C.uint64(serverConnectionHandlerID), C.anyID(clientID))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RequestServerConnectionInfo binds ts3client_requestServerConnectionInfo
+//
+// Make server connection variables available for retrieval
+func RequestServerConnectionInfo(serverConnectionHandlerID ConnectionHandlerID) error {
+	err := C.ts3client_requestServerConnectionInfo(C.uint64(serverConnectionHandlerID), nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RequestServerConnectionInfoAsync binds ts3client_requestServerConnectionInfo
+//
+// Make server connection variables available for retrieval
+func RequestServerConnectionInfoAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID) (*Request, error) {
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestServerConnectionInfo(C.uint64(serverConnectionHandlerID), a.str(0))
+	})
+}
+
+// GetServerConnectionVariableAsUInt64 binds ts3client_getServerConnectionVariableAsUInt64
+//
+// Retrieve value of a server connection variable as unsigned 64 bit integer
+func GetServerConnectionVariableAsUInt64(serverConnectionHandlerID ConnectionHandlerID, flag ConnectionProperties) (uint64, error) {
+	var cResult C.uint64
+
+	err := C.ts3client_getServerConnectionVariableAsUInt64(C.uint64(serverConnectionHandlerID), C.size_t(flag), &cResult)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return uint64(cResult), nil
+}
+
+// GetServerConnectionVariableAsFloat binds ts3client_getServerConnectionVariableAsFloat
+//
+// Retrieve value of a server connection variable as float
+func GetServerConnectionVariableAsFloat(serverConnectionHandlerID ConnectionHandlerID, flag ConnectionProperties) (float32, error) {
+	var cResult C.float
+
+	err := C.ts3client_getServerConnectionVariableAsFloat(C.uint64(serverConnectionHandlerID), C.size_t(flag), &cResult)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return float32(cResult), nil
+}
+
+// GetClientSelfVariableAsInt binds ts3client_getClientSelfVariableAsInt
+//
+// Retrieve value of a variable of your own client as an integer
+func GetClientSelfVariableAsInt(serverConnectionHandlerID ConnectionHandlerID, flag ClientProperties) (int, error) {
+	var cResult C.int
+
+	err := C.ts3client_getClientSelfVariableAsInt(C.uint64(serverConnectionHandlerID), C.size_t(flag), &cResult)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return int(cResult), nil
+}
+
+// GetClientSelfVariableAsString binds ts3client_getClientSelfVariableAsString
+//
+// Retrieve value of a variable of your own client as string
+func GetClientSelfVariableAsString(serverConnectionHandlerID ConnectionHandlerID, flag ClientProperties) (string, error) {
+	var cResult *C.char
+
+	err := C.ts3client_getClientSelfVariableAsString(C.uint64(serverConnectionHandlerID), C.size_t(flag), &cResult)
+	if err != C.ERROR_ok {
+		return "", Error(err)
+	}
+	defer C.ts3client_freeMemory(unsafe.Pointer(cResult))
+	return C.GoString(cResult), nil
+}
+
+// SetClientSelfVariableAsInt binds ts3client_setClientSelfVariableAsInt
+//
+// Change the value of an integer variable on your own client
+func SetClientSelfVariableAsInt(serverConnectionHandlerID ConnectionHandlerID, flag ClientProperties, value int) error {
+	err := C.ts3client_setClientSelfVariableAsInt(C.uint64(serverConnectionHandlerID), C.size_t(flag), C.int(value))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// SetClientSelfVariableAsString binds ts3client_setClientSelfVariableAsString
+//
+// Change the value of a string variable on your own client
+func SetClientSelfVariableAsString(serverConnectionHandlerID ConnectionHandlerID, flag ClientProperties, value string) error {
+	a := getCArena(value)
+	defer putCArena(a)
+
+	err := C.ts3client_setClientSelfVariableAsString(C.uint64(serverConnectionHandlerID), C.size_t(flag), a.str(0))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// FlushClientSelfUpdates binds ts3client_flushClientSelfUpdates
+//
+// Send changes to the local client to the server
+func FlushClientSelfUpdates(serverConnectionHandlerID ConnectionHandlerID) error {
+	err := C.ts3client_flushClientSelfUpdates(C.uint64(serverConnectionHandlerID), nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// FlushClientSelfUpdatesAsync binds ts3client_flushClientSelfUpdates
+//
+// Send changes to the local client to the server
+func FlushClientSelfUpdatesAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID) (*Request, error) {
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_flushClientSelfUpdates(C.uint64(serverConnectionHandlerID), a.str(0))
+	})
+}
+
+// GetClientVariableAsUInt64 binds ts3client_getClientVariableAsUInt64
+//
+// Retrieve the value of a variable from a client as unsigned 64bit integer
+func GetClientVariableAsUInt64(serverConnectionHandlerID ConnectionHandlerID, clientID ClientID, flag ClientProperties) (uint64, error) {
+	var cResult C.uint64
+
+	err := C.ts3client_getClientVariableAsUInt64(C.uint64(serverConnectionHandlerID), C.anyID(clientID), C.size_t(flag), &cResult)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return uint64(cResult), nil
+}
+
+// GetChannelVariableAsInt binds ts3client_getChannelVariableAsInt
+//
+// Retrieve the value of a channel property as integer
+func GetChannelVariableAsInt(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID, flag ChannelProperties) (int, error) {
+	var cResult C.int
+
+	err := C.ts3client_getChannelVariableAsInt(C.uint64(serverConnectionHandlerID), C.uint64(channelID), C.size_t(flag), &cResult)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return int(cResult), nil
+}
+
+// GetChannelVariableAsUInt64 binds ts3client_getChannelVariableAsUInt64
+//
+// Retrieve the value of a channel property as unsigned 64 bit integer
+func GetChannelVariableAsUInt64(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID, flag ChannelProperties) (uint64, error) {
+	var cResult C.uint64
+
+	err := C.ts3client_getChannelVariableAsUInt64(C.uint64(serverConnectionHandlerID), C.uint64(channelID), C.size_t(flag), &cResult)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return uint64(cResult), nil
+}
+
+// SetChannelVariableAsInt binds ts3client_setChannelVariableAsInt
+//
+// Set a new value for an integer channel property
+func SetChannelVariableAsInt(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID, flag ChannelProperties, value int) error {
+	err := C.ts3client_setChannelVariableAsInt(C.uint64(serverConnectionHandlerID), C.uint64(channelID), C.size_t(flag), C.int(value))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// SetChannelVariableAsUInt64 binds ts3client_setChannelVariableAsUInt64
+//
+// Set a new value for an unsigned 64 bit channel property
+func SetChannelVariableAsUInt64(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID, flag ChannelProperties, value uint64) error {
+	err := C.ts3client_setChannelVariableAsUInt64(C.uint64(serverConnectionHandlerID), C.uint64(channelID), C.size_t(flag), C.uint64(value))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// SetChannelVariableAsString binds ts3client_setChannelVariableAsString
+//
+// Set a new value for a string channel property
+func SetChannelVariableAsString(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID, flag ChannelProperties, value string) error {
+	a := getCArena(value)
+	defer putCArena(a)
+
+	err := C.ts3client_setChannelVariableAsString(C.uint64(serverConnectionHandlerID), C.uint64(channelID), C.size_t(flag), a.str(0))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// FlushChannelUpdates binds ts3client_flushChannelUpdates
+//
+// Inform server of changes to channel properties
+func FlushChannelUpdates(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID) error {
+	err := C.ts3client_flushChannelUpdates(C.uint64(serverConnectionHandlerID), C.uint64(channelID), nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// FlushChannelUpdatesAsync binds ts3client_flushChannelUpdates
+//
+// Inform server of changes to channel properties
+func FlushChannelUpdatesAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID) (*Request, error) {
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_flushChannelUpdates(C.uint64(serverConnectionHandlerID), C.uint64(channelID), a.str(0))
+	})
+}
+
+// FlushChannelCreation binds ts3client_flushChannelCreation
+//
+// Create the channel on the server
+func FlushChannelCreation(serverConnectionHandlerID ConnectionHandlerID, channelParentID ChannelID) error {
+	err := C.ts3client_flushChannelCreation(C.uint64(serverConnectionHandlerID), C.uint64(channelParentID), nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// FlushChannelCreationAsync binds ts3client_flushChannelCreation
+//
+// Create the channel on the server
+func FlushChannelCreationAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, channelParentID ChannelID) (*Request, error) {
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_flushChannelCreation(C.uint64(serverConnectionHandlerID), C.uint64(channelParentID), a.str(0))
+	})
+}
+
+// GetChannelEmptySecs binds ts3client_getChannelEmptySecs
+//
+// Get time in seconds since last client left the specified channel
+func GetChannelEmptySecs(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID) (int, error) {
+	var cResult C.int
+
+	err := C.ts3client_getChannelEmptySecs(C.uint64(serverConnectionHandlerID), C.uint64(channelID), &cResult)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return int(cResult), nil
+}
+
+// GetServerConnectionHandlerList binds ts3client_getServerConnectionHandlerList
+//
+// Get a list of all connection handlers
+func GetServerConnectionHandlerList() ([]ConnectionHandlerID, error) {
+	var cResult *C.uint64
+
+	err := C.ts3client_getServerConnectionHandlerList(&cResult)
+	if err != C.ERROR_ok {
+		return nil, Error(err)
+	}
+	defer C.ts3client_freeMemory(unsafe.Pointer(cResult))
+	var result []ConnectionHandlerID
+	for p := cResult; *p != 0; p = (*C.uint64)(unsafe.Add(unsafe.Pointer(p), unsafe.Sizeof(*p))) {
+		result = append(result, ConnectionHandlerID(*p))
+	}
+	return result, nil
+}
+
+// GetServerVariableAsInt binds ts3client_getServerVariableAsInt
+//
+// Get the value of an integer server property
+func GetServerVariableAsInt(serverConnectionHandlerID ConnectionHandlerID, flag VirtualServerProperties) (int, error) {
+	var cResult C.int
+
+	err := C.ts3client_getServerVariableAsInt(C.uint64(serverConnectionHandlerID), C.size_t(flag), &cResult)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return int(cResult), nil
+}
+
+// GetServerVariableAsUInt64 binds ts3client_getServerVariableAsUInt64
+//
+// Get the value of an unsigned 64 bit integer server property
+func GetServerVariableAsUInt64(serverConnectionHandlerID ConnectionHandlerID, flag VirtualServerProperties) (uint64, error) {
+	var cResult C.uint64
+
+	err := C.ts3client_getServerVariableAsUInt64(C.uint64(serverConnectionHandlerID), C.size_t(flag), &cResult)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return uint64(cResult), nil
+}
+
+// GetServerVariableAsString binds ts3client_getServerVariableAsString
+//
+// Get the value of a string server property
+func GetServerVariableAsString(serverConnectionHandlerID ConnectionHandlerID, flag VirtualServerProperties) (string, error) {
+	var cResult *C.char
+
+	err := C.ts3client_getServerVariableAsString(C.uint64(serverConnectionHandlerID), C.size_t(flag), &cResult)
+	if err != C.ERROR_ok {
+		return "", Error(err)
+	}
+	defer C.ts3client_freeMemory(unsafe.Pointer(cResult))
+	return C.GoString(cResult), nil
+}
+
+// RequestServerVariables binds ts3client_requestServerVariables
+//
+// Make request only server variables available locally
+func RequestServerVariables(serverConnectionHandlerID ConnectionHandlerID) error {
+	err := C.ts3client_requestServerVariables(C.uint64(serverConnectionHandlerID), nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RequestServerVariablesAsync binds ts3client_requestServerVariables
+//
+// Make request only server variables available locally
+func RequestServerVariablesAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID) (*Request, error) {
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestServerVariables(C.uint64(serverConnectionHandlerID), a.str(0))
+	})
+}
+
+// GetTransferFileName binds ts3client_getTransferFileName
+//
+// Get the local file name for a file transfer
+func GetTransferFileName(transferID uint16) (string, error) {
+	var cResult *C.char
+
+	err := C.ts3client_getTransferFileName(C.anyID(transferID), &cResult)
+	if err != C.ERROR_ok {
+		return "", Error(err)
+	}
+	defer C.ts3client_freeMemory(unsafe.Pointer(cResult))
+	return C.GoString(cResult), nil
+}
+
+// GetTransferFilePath binds ts3client_getTransferFilePath
+//
+// Get the local path of a file transfer
+func GetTransferFilePath(transferID uint16) (string, error) {
+	var cResult *C.char
+
+	err := C.ts3client_getTransferFilePath(C.anyID(transferID), &cResult)
+	if err != C.ERROR_ok {
+		return "", Error(err)
+	}
+	defer C.ts3client_freeMemory(unsafe.Pointer(cResult))
+	return C.GoString(cResult), nil
+}
+
+// GetTransferFileRemotePath binds ts3client_getTransferFileRemotePath
+//
+// Get the server path of the file transfer
+func GetTransferFileRemotePath(transferID uint16) (string, error) {
+	var cResult *C.char
+
+	err := C.ts3client_getTransferFileRemotePath(C.anyID(transferID), &cResult)
+	if err != C.ERROR_ok {
+		return "", Error(err)
+	}
+	defer C.ts3client_freeMemory(unsafe.Pointer(cResult))
+	return C.GoString(cResult), nil
+}
+
+// GetTransferFileSize binds ts3client_getTransferFileSize
+//
+// Get the total size in bytes of a file transfer
+func GetTransferFileSize(transferID uint16) (uint64, error) {
+	var cResult C.uint64
+
+	err := C.ts3client_getTransferFileSize(C.anyID(transferID), &cResult)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return uint64(cResult), nil
+}
+
+// GetTransferFileSizeDone binds ts3client_getTransferFileSizeDone
+//
+// Get the amount of bytes already transferred
+func GetTransferFileSizeDone(transferID uint16) (uint64, error) {
+	var cResult C.uint64
+
+	err := C.ts3client_getTransferFileSizeDone(C.anyID(transferID), &cResult)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return uint64(cResult), nil
+}
+
+// IsTransferSender binds ts3client_isTransferSender
+//
+// Determine if the file transfer is an upload or download
+func IsTransferSender(transferID uint16) (int, error) {
+	var cResult C.int
+
+	err := C.ts3client_isTransferSender(C.anyID(transferID), &cResult)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return int(cResult), nil
+}
+
+// GetTransferStatus binds ts3client_getTransferStatus
+//
+// Determine the current status of the transfer in question
+func GetTransferStatus(transferID uint16) (int, error) {
+	var cResult C.int
+
+	err := C.ts3client_getTransferStatus(C.anyID(transferID), &cResult)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return int(cResult), nil
+}
+
+// GetCurrentTransferSpeed binds ts3client_getCurrentTransferSpeed
+//
+// Get the current approximate speed (in bytes/sec) of a file transfer
+func GetCurrentTransferSpeed(transferID uint16) (float32, error) {
+	var cResult C.float
+
+	err := C.ts3client_getCurrentTransferSpeed(C.anyID(transferID), &cResult)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return float32(cResult), nil
+}
+
+// GetAverageTransferSpeed binds ts3client_getAverageTransferSpeed
+//
+// Get the average transfer speed (in bytes/sec) of a file transfer since it started
+func GetAverageTransferSpeed(transferID uint16) (float32, error) {
+	var cResult C.float
+
+	err := C.ts3client_getAverageTransferSpeed(C.anyID(transferID), &cResult)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return float32(cResult), nil
+}
+
+// GetTransferRunTime binds ts3client_getTransferRunTime
+//
+// Get the time (in seconds) a file transfer has been active
+func GetTransferRunTime(transferID uint16) (uint64, error) {
+	var cResult C.uint64
+
+	err := C.ts3client_getTransferRunTime(C.anyID(transferID), &cResult)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return uint64(cResult), nil
+}
+
+// HaltTransfer binds ts3client_haltTransfer
+//
+// Cancel a file transfer
+func HaltTransfer(serverConnectionHandlerID ConnectionHandlerID, transferID uint16, deleteUnfinishedFile int) error {
+	err := C.ts3client_haltTransfer(C.uint64(serverConnectionHandlerID), C.anyID(transferID), C.int(deleteUnfinishedFile), nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// HaltTransferAsync binds ts3client_haltTransfer
+//
+// Cancel a file transfer
+func HaltTransferAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, transferID uint16, deleteUnfinishedFile int) (*Request, error) {
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_haltTransfer(C.uint64(serverConnectionHandlerID), C.anyID(transferID), C.int(deleteUnfinishedFile), a.str(0))
+	})
+}
+
+// RequestFileList binds ts3client_requestFileList
+//
+// Retrieve a list of files in a directory
+func RequestFileList(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID, channelPW string, path string) error {
+	a := getCArena(channelPW, path)
+	defer putCArena(a)
+
+	err := C.ts3client_requestFileList(C.uint64(serverConnectionHandlerID), C.uint64(channelID), a.str(0), a.str(1), nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RequestFileListAsync binds ts3client_requestFileList
+//
+// Retrieve a list of files in a directory
+func RequestFileListAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID, channelPW string, path string) (*Request, error) {
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(channelPW, path, returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestFileList(C.uint64(serverConnectionHandlerID), C.uint64(channelID), a.str(0), a.str(1), a.str(2))
+	})
+}
+
+// RequestFileInfo binds ts3client_requestFileInfo
+//
+// Retrieve information about a specific file
+func RequestFileInfo(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID, channelPW string, file string) error {
+	a := getCArena(channelPW, file)
+	defer putCArena(a)
+
+	err := C.ts3client_requestFileInfo(C.uint64(serverConnectionHandlerID), C.uint64(channelID), a.str(0), a.str(1), nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RequestFileInfoAsync binds ts3client_requestFileInfo
+//
+// Retrieve information about a specific file
+func RequestFileInfoAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID, channelPW string, file string) (*Request, error) {
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(channelPW, file, returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestFileInfo(C.uint64(serverConnectionHandlerID), C.uint64(channelID), a.str(0), a.str(1), a.str(2))
+	})
+}
+
+// RequestCreateDirectory binds ts3client_requestCreateDirectory
+//
+// Create a directory in a channel for file organization
+func RequestCreateDirectory(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID, channelPW string, directoryPath string) error {
+	a := getCArena(channelPW, directoryPath)
+	defer putCArena(a)
+
+	err := C.ts3client_requestCreateDirectory(C.uint64(serverConnectionHandlerID), C.uint64(channelID), a.str(0), a.str(1), nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RequestCreateDirectoryAsync binds ts3client_requestCreateDirectory
+//
+// Create a directory in a channel for file organization
+func RequestCreateDirectoryAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID, channelPW string, directoryPath string) (*Request, error) {
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(channelPW, directoryPath, returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestCreateDirectory(C.uint64(serverConnectionHandlerID), C.uint64(channelID), a.str(0), a.str(1), a.str(2))
+	})
+}
+
+// RequestRenameFile binds ts3client_requestRenameFile
+//
+// Move or rename a file on the server
+func RequestRenameFile(serverConnectionHandlerID ConnectionHandlerID, fromChannelID ChannelID, fromChannelPW string, toChannelID ChannelID, toChannelPW string, oldFile string, newFile string) error {
+	a := getCArena(fromChannelPW, toChannelPW, oldFile, newFile)
+	defer putCArena(a)
+
+	err := C.ts3client_requestRenameFile(C.uint64(serverConnectionHandlerID), C.uint64(fromChannelID), a.str(0), C.uint64(toChannelID), a.str(1), a.str(2), a.str(3), nil)
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// RequestRenameFileAsync binds ts3client_requestRenameFile
+//
+// Move or rename a file on the server
+func RequestRenameFileAsync(ctx context.Context, serverConnectionHandlerID ConnectionHandlerID, fromChannelID ChannelID, fromChannelPW string, toChannelID ChannelID, toChannelPW string, oldFile string, newFile string) (*Request, error) {
+	return sendRequest(ctx, serverConnectionHandlerID, func(returnCode string) C.uint {
+		a := getCArena(fromChannelPW, toChannelPW, oldFile, newFile, returnCode)
+		defer putCArena(a)
+
+		return C.ts3client_requestRenameFile(C.uint64(serverConnectionHandlerID), C.uint64(fromChannelID), a.str(0), C.uint64(toChannelID), a.str(1), a.str(2), a.str(3), a.str(4))
+	})
+}
+
+// GetInstanceSpeedLimitUp binds ts3client_getInstanceSpeedLimitUp
+//
+// Get the configured maximum upload speed of the server instance
+func GetInstanceSpeedLimitUp() (uint64, error) {
+	var cLimit C.uint64
+
+	err := C.ts3client_getInstanceSpeedLimitUp(&cLimit)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return uint64(cLimit), nil
+}
+
+// GetInstanceSpeedLimitDown binds ts3client_getInstanceSpeedLimitDown
+//
+// Get the configured maximum download speed of the server instance
+func GetInstanceSpeedLimitDown() (uint64, error) {
+	var cLimit C.uint64
+
+	err := C.ts3client_getInstanceSpeedLimitDown(&cLimit)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return uint64(cLimit), nil
+}
+
+// GetServerConnectionHandlerSpeedLimitUp binds ts3client_getServerConnectionHandlerSpeedLimitUp
+//
+// Get the configured maximum upload speed for the virtual server
+func GetServerConnectionHandlerSpeedLimitUp(serverConnectionHandlerID ConnectionHandlerID) (uint64, error) {
+	var cLimit C.uint64
+
+	err := C.ts3client_getServerConnectionHandlerSpeedLimitUp(C.uint64(serverConnectionHandlerID), &cLimit)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return uint64(cLimit), nil
+}
+
+// GetServerConnectionHandlerSpeedLimitDown binds ts3client_getServerConnectionHandlerSpeedLimitDown
+//
+// Get the configured maximum download speed for the virtual server
+func GetServerConnectionHandlerSpeedLimitDown(serverConnectionHandlerID ConnectionHandlerID) (uint64, error) {
+	var cLimit C.uint64
+
+	err := C.ts3client_getServerConnectionHandlerSpeedLimitDown(C.uint64(serverConnectionHandlerID), &cLimit)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return uint64(cLimit), nil
+}
+
+// GetTransferSpeedLimit binds ts3client_getTransferSpeedLimit
+//
+// Get the speed limit for a specific file transfer
+func GetTransferSpeedLimit(transferID uint16) (uint64, error) {
+	var cLimit C.uint64
+
+	err := C.ts3client_getTransferSpeedLimit(C.anyID(transferID), &cLimit)
+	if err != C.ERROR_ok {
+		return 0, Error(err)
+	}
+	return uint64(cLimit), nil
+}
+
+// SetInstanceSpeedLimitUp binds ts3client_setInstanceSpeedLimitUp
+//
+// Set the instance wide upload speed limit for file transfer
+func SetInstanceSpeedLimitUp(newLimit uint64) error {
+	err := C.ts3client_setInstanceSpeedLimitUp(C.uint64(newLimit))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// SetInstanceSpeedLimitDown binds ts3client_setInstanceSpeedLimitDown
+//
+// Set the instance wide download speed limit for file transfer
+func SetInstanceSpeedLimitDown(newLimit uint64) error {
+	err := C.ts3client_setInstanceSpeedLimitDown(C.uint64(newLimit))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// SetServerConnectionHandlerSpeedLimitUp binds ts3client_setServerConnectionHandlerSpeedLimitUp
+//
+// Set the virtual server upload speed limit for file transfer
+func SetServerConnectionHandlerSpeedLimitUp(serverConnectionHandlerID ConnectionHandlerID, newLimit uint64) error {
+	err := C.ts3client_setServerConnectionHandlerSpeedLimitUp(C.uint64(serverConnectionHandlerID), C.uint64(newLimit))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// SetServerConnectionHandlerSpeedLimitDown binds ts3client_setServerConnectionHandlerSpeedLimitDown
+//
+// Set the virtual server download speed limit for file transfer
+func SetServerConnectionHandlerSpeedLimitDown(serverConnectionHandlerID ConnectionHandlerID, newLimit uint64) error {
+	err := C.ts3client_setServerConnectionHandlerSpeedLimitDown(C.uint64(serverConnectionHandlerID), C.uint64(newLimit))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// SetTransferSpeedLimit binds ts3client_setTransferSpeedLimit
+//
+// Set the transfer limit for an individual file transfer
+func SetTransferSpeedLimit(transferID uint16, newLimit uint64) error {
+	err := C.ts3client_setTransferSpeedLimit(C.anyID(transferID), C.uint64(newLimit))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// GetChatLoginToken binds ts3client_getChatLoginToken
+//
+// Request a login token for the chat server associated with the specified virtual server
+func GetChatLoginToken(serverConnectionHandlerID ConnectionHandlerID) error {
+	err := C.ts3client_getChatLoginToken(C.uint64(serverConnectionHandlerID))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// GetAuthenticationToken binds ts3client_getAuthenticationToken
+//
+// Request an authentication token from the specified virtual server
+func GetAuthenticationToken(serverConnectionHandlerID ConnectionHandlerID) error {
+	err := C.ts3client_getAuthenticationToken(C.uint64(serverConnectionHandlerID))
+	if err != C.ERROR_ok {
+		return Error(err)
+	}
+	return nil
+}
+
+// Callback types generated from ClientUIFunctions
+type (
+	// ClientMoveMovedCallback is called when a client was moved by the server or another client
+	ClientMoveMovedCallback func(serverConnectionHandlerID ConnectionHandlerID, clientID ClientID, oldChannelID ChannelID, newChannelID ChannelID, visibility int, moverID ClientID, moverName string, moverUniqueIdentifier string, moveMessage string)
+
+	// ClientKickFromChannelCallback is called when a client is kicked from their channel
+	ClientKickFromChannelCallback func(serverConnectionHandlerID ConnectionHandlerID, clientID ClientID, oldChannelID ChannelID, newChannelID ChannelID, visibility int, kickerID ClientID, kickerName string, kickerUniqueIdentifier string, kickMessage string)
+
+	// ClientKickFromServerCallback is called when a client was kicked from the server
+	ClientKickFromServerCallback func(serverConnectionHandlerID ConnectionHandlerID, clientID ClientID, oldChannelID ChannelID, newChannelID ChannelID, visibility int, kickerID ClientID, kickerName string, kickerUniqueIdentifier string, kickMessage string)
+
+	// ClientIDsCallback is called for every connection using the identity after a call to ts3client_requestClientIDs
+	ClientIDsCallback func(serverConnectionHandlerID ConnectionHandlerID, uniqueClientIdentifier string, clientID ClientID, clientName string)
+
+	// ClientIDsFinishedCallback is called after onClientIDsEvent was called for every client using the queried identity
+	ClientIDsFinishedCallback func(serverConnectionHandlerID ConnectionHandlerID)
+
+	// ServerEditedCallback is called when the server was edited
+	ServerEditedCallback func(serverConnectionHandlerID ConnectionHandlerID, editerID ClientID, editerName string, editerUniqueIdentifier string)
+
+	// ServerUpdatedCallback is called whenever updates about changed server properties are received from the server
+	ServerUpdatedCallback func(serverConnectionHandlerID ConnectionHandlerID)
+
+	// ServerStopCallback is called when the server was stopped
+	ServerStopCallback func(serverConnectionHandlerID ConnectionHandlerID, shutdownMessage string)
+
+	// IgnoredWhisperCallback is called when someone whispers us that is not on the list of clients we accept whispers from
+	IgnoredWhisperCallback func(serverConnectionHandlerID ConnectionHandlerID, clientID ClientID)
+
+	// ConnectionInfoCallback is called when updated connection properties for a client are available
+	ConnectionInfoCallback func(serverConnectionHandlerID ConnectionHandlerID, clientID ClientID)
+
+	// ServerConnectionInfoCallback is called after a call ts3client_requestServerConnectionInfo when the connection information for the server are available
+	ServerConnectionInfoCallback func(serverConnectionHandlerID ConnectionHandlerID)
+
+	// ChannelSubscribeCallback is called when a channel was successfully subscribed by us
+	ChannelSubscribeCallback func(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID)
+
+	// ChannelSubscribeFinishedCallback is called after all channels we attempted to subscribe to are subscribed
+	ChannelSubscribeFinishedCallback func(serverConnectionHandlerID ConnectionHandlerID)
+
+	// ChannelUnsubscribeCallback is called after we unsubscribed from a channel
+	ChannelUnsubscribeCallback func(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID)
+
+	// ChannelUnsubscribeFinishedCallback is called after all channels we attempted to unsubscribe from are unsubscribed
+	ChannelUnsubscribeFinishedCallback func(serverConnectionHandlerID ConnectionHandlerID)
+
+	// ChannelDescriptionUpdateCallback is called when the channel description of a channel has changed
+	ChannelDescriptionUpdateCallback func(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID)
+
+	// ChannelPasswordChangedCallback is called when a channel password was changed. Can be used to invalidate cached passwords previously stored for the channel
+	ChannelPasswordChangedCallback func(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID)
+
+	// PlaybackShutdownCompleteCallback is called once the playback device was closed on a connection
+	PlaybackShutdownCompleteCallback func(serverConnectionHandlerID ConnectionHandlerID)
+
+	// SoundDeviceListChangedCallback is called when the available devices changed
+	SoundDeviceListChangedCallback func(modeID string, playOrCap int)
+
+	// UserLoggingMessageCallback is called for every log message if the client lib was initialized with user logging
+	UserLoggingMessageCallback func(logmessage string, logLevel int, logChannel string, logID uint64, logTime string, completeLogString string)
+
+	// ProvisioningSlotRequestResultCallback is called for onProvisioningSlotRequestResultEvent
+	ProvisioningSlotRequestResultCallback func(error Error, requestHandle uint64, connectionKey string)
+
+	// FileTransferStatusCallback is called when file transfers finish or terminate with an error
+	FileTransferStatusCallback func(transferID uint16, status uint32, statusMessage string, remotefileSize uint64, serverConnectionHandlerID ConnectionHandlerID)
+
+	// FileListCallback is called as an answer to ts3client_requestFileList. Called once for every file in the requested path, providing file information
+	FileListCallback func(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID, path string, name string, size uint64, datetime uint64, type_ int, incompletesize uint64, returnCode string)
+
+	// FileListFinishedCallback is called after onFileListEvent was called for all directories / files in a given path
+	FileListFinishedCallback func(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID, path string)
+
+	// FileInfoCallback is called after a call to ts3client_requestFileInfo providing the requested information about a file
+	FileInfoCallback func(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID, name string, size uint64, datetime uint64)
+
+	// ChatLoginTokenCallback is called after a call to ts3client_getChatLoginToken providing the requested login token for the chat server associated with this teamspeak server
+	ChatLoginTokenCallback func(serverConnectionHandlerID ConnectionHandlerID, token string)
+
+	// AuthenticationTokenCallback is called after a call to ts3client_getAuthenticationToken providing the requested authentication token for the virtual server
+	AuthenticationTokenCallback func(serverConnectionHandlerID ConnectionHandlerID, token string)
+)
+
+// ExtraCallbacks holds the generated callbacks. It is embedded in Callbacks.
+// With SetClientCallbacksBatched their events are queued like the others, except for
+// UserLoggingMessage, whose arguments don't fit a queued event and which
+// are always called directly on the client lib threads.
+type ExtraCallbacks struct {
+	ClientMoveMoved               ClientMoveMovedCallback
+	ClientKickFromChannel         ClientKickFromChannelCallback
+	ClientKickFromServer          ClientKickFromServerCallback
+	ClientIDs                     ClientIDsCallback
+	ClientIDsFinished             ClientIDsFinishedCallback
+	ServerEdited                  ServerEditedCallback
+	ServerUpdated                 ServerUpdatedCallback
+	ServerStop                    ServerStopCallback
+	IgnoredWhisper                IgnoredWhisperCallback
+	ConnectionInfo                ConnectionInfoCallback
+	ServerConnectionInfo          ServerConnectionInfoCallback
+	ChannelSubscribe              ChannelSubscribeCallback
+	ChannelSubscribeFinished      ChannelSubscribeFinishedCallback
+	ChannelUnsubscribe            ChannelUnsubscribeCallback
+	ChannelUnsubscribeFinished    ChannelUnsubscribeFinishedCallback
+	ChannelDescriptionUpdate      ChannelDescriptionUpdateCallback
+	ChannelPasswordChanged        ChannelPasswordChangedCallback
+	PlaybackShutdownComplete      PlaybackShutdownCompleteCallback
+	SoundDeviceListChanged        SoundDeviceListChangedCallback
+	UserLoggingMessage            UserLoggingMessageCallback
+	ProvisioningSlotRequestResult ProvisioningSlotRequestResultCallback
+	FileTransferStatus            FileTransferStatusCallback
+	FileList                      FileListCallback
+	FileListFinished              FileListFinishedCallback
+	FileInfo                      FileInfoCallback
+	ChatLoginToken                ChatLoginTokenCallback
+	AuthenticationToken           AuthenticationTokenCallback
+}
+
+// fillExtraCallbacks points the generated callbacks at their queueing C functions, or at
+// their exported Go functions if they aren't queued
+func fillExtraCallbacks(funcs *C.struct_ClientUIFunctions) {
+	C.ts3sdk_eventQueueFillExtraCallbacks(funcs)
+	funcs.onUserLoggingMessageEvent = (*[0]byte)(C.onUserLoggingMessageEvent)
+}
+
+//export onClientMoveMovedEvent
+func onClientMoveMovedEvent(serverConnectionHandlerID C.uint64, clientID C.anyID, oldChannelID C.uint64, newChannelID C.uint64, visibility C.int, moverID C.anyID, moverName *C.char, moverUniqueIdentifier *C.char, moveMessage *C.char) {
+	if cb := loadCallbacks(); cb.ClientMoveMoved != nil {
+		cb.ClientMoveMoved(
+			ConnectionHandlerID(serverConnectionHandlerID),
+			ClientID(clientID),
+			ChannelID(oldChannelID),
+			ChannelID(newChannelID),
+			int(visibility),
+			ClientID(moverID),
+			internCString(moverName),
+			internCString(moverUniqueIdentifier),
+			C.GoString(moveMessage),
+		)
+	}
+}
+
+//export onClientKickFromChannelEvent
+func onClientKickFromChannelEvent(serverConnectionHandlerID C.uint64, clientID C.anyID, oldChannelID C.uint64, newChannelID C.uint64, visibility C.int, kickerID C.anyID, kickerName *C.char, kickerUniqueIdentifier *C.char, kickMessage *C.char) {
+	if cb := loadCallbacks(); cb.ClientKickFromChannel != nil {
+		cb.ClientKickFromChannel(
+			ConnectionHandlerID(serverConnectionHandlerID),
+			ClientID(clientID),
+			ChannelID(oldChannelID),
+			ChannelID(newChannelID),
+			int(visibility),
+			ClientID(kickerID),
+			internCString(kickerName),
+			internCString(kickerUniqueIdentifier),
+			C.GoString(kickMessage),
+		)
+	}
+}
+
+//export onClientKickFromServerEvent
+func onClientKickFromServerEvent(serverConnectionHandlerID C.uint64, clientID C.anyID, oldChannelID C.uint64, newChannelID C.uint64, visibility C.int, kickerID C.anyID, kickerName *C.char, kickerUniqueIdentifier *C.char, kickMessage *C.char) {
+	if cb := loadCallbacks(); cb.ClientKickFromServer != nil {
+		cb.ClientKickFromServer(
+			ConnectionHandlerID(serverConnectionHandlerID),
+			ClientID(clientID),
+			ChannelID(oldChannelID),
+			ChannelID(newChannelID),
+			int(visibility),
+			ClientID(kickerID),
+			internCString(kickerName),
+			internCString(kickerUniqueIdentifier),
+			C.GoString(kickMessage),
+		)
+	}
+}
+
+//export onClientIDsEvent
+func onClientIDsEvent(serverConnectionHandlerID C.uint64, uniqueClientIdentifier *C.char, clientID C.anyID, clientName *C.char) {
+	if cb := loadCallbacks(); cb.ClientIDs != nil {
+		cb.ClientIDs(
+			ConnectionHandlerID(serverConnectionHandlerID),
+			internCString(uniqueClientIdentifier),
+			ClientID(clientID),
+			internCString(clientName),
+		)
+	}
+}
+
+//export onClientIDsFinishedEvent
+func onClientIDsFinishedEvent(serverConnectionHandlerID C.uint64) {
+	if cb := loadCallbacks(); cb.ClientIDsFinished != nil {
+		cb.ClientIDsFinished(
+			ConnectionHandlerID(serverConnectionHandlerID),
+		)
+	}
+}
+
+//export onServerEditedEvent
+func onServerEditedEvent(serverConnectionHandlerID C.uint64, editerID C.anyID, editerName *C.char, editerUniqueIdentifier *C.char) {
+	if cb := loadCallbacks(); cb.ServerEdited != nil {
+		cb.ServerEdited(
+			ConnectionHandlerID(serverConnectionHandlerID),
+			ClientID(editerID),
+			internCString(editerName),
+			internCString(editerUniqueIdentifier),
+		)
+	}
+}
+
+//export onServerUpdatedEvent
+func onServerUpdatedEvent(serverConnectionHandlerID C.uint64) {
+	if cb := loadCallbacks(); cb.ServerUpdated != nil {
+		cb.ServerUpdated(
+			ConnectionHandlerID(serverConnectionHandlerID),
+		)
+	}
+}
+
+//export onServerStopEvent
+func onServerStopEvent(serverConnectionHandlerID C.uint64, shutdownMessage *C.char) {
+	if cb := loadCallbacks(); cb.ServerStop != nil {
+		cb.ServerStop(
+			ConnectionHandlerID(serverConnectionHandlerID),
+			C.GoString(shutdownMessage),
+		)
+	}
+}
+
+//export onIgnoredWhisperEvent
+func onIgnoredWhisperEvent(serverConnectionHandlerID C.uint64, clientID C.anyID) {
+	if cb := loadCallbacks(); cb.IgnoredWhisper != nil {
+		cb.IgnoredWhisper(
+			ConnectionHandlerID(serverConnectionHandlerID),
+			ClientID(clientID),
+		)
+	}
+}
+
+//export onConnectionInfoEvent
+func onConnectionInfoEvent(serverConnectionHandlerID C.uint64, clientID C.anyID) {
+	if cb := loadCallbacks(); cb.ConnectionInfo != nil {
+		cb.ConnectionInfo(
+			ConnectionHandlerID(serverConnectionHandlerID),
+			ClientID(clientID),
+		)
+	}
+}
+
+//export onServerConnectionInfoEvent
+func onServerConnectionInfoEvent(serverConnectionHandlerID C.uint64) {
+	if cb := loadCallbacks(); cb.ServerConnectionInfo != nil {
+		cb.ServerConnectionInfo(
+			ConnectionHandlerID(serverConnectionHandlerID),
+		)
+	}
+}
+
+//export onChannelSubscribeEvent
+func onChannelSubscribeEvent(serverConnectionHandlerID C.uint64, channelID C.uint64) {
+	if cb := loadCallbacks(); cb.ChannelSubscribe != nil {
+		cb.ChannelSubscribe(
+			ConnectionHandlerID(serverConnectionHandlerID),
+			ChannelID(channelID),
+		)
+	}
+}
+
+//export onChannelSubscribeFinishedEvent
+func onChannelSubscribeFinishedEvent(serverConnectionHandlerID C.uint64) {
+	if cb := loadCallbacks(); cb.ChannelSubscribeFinished != nil {
+		cb.ChannelSubscribeFinished(
+			ConnectionHandlerID(serverConnectionHandlerID),
+		)
+	}
+}
+
+//export onChannelUnsubscribeEvent
+func onChannelUnsubscribeEvent(serverConnectionHandlerID C.uint64, channelID C.uint64) {
+	if cb := loadCallbacks(); cb.ChannelUnsubscribe != nil {
+		cb.ChannelUnsubscribe(
+			ConnectionHandlerID(serverConnectionHandlerID),
+			ChannelID(channelID),
+		)
+	}
+}
+
+//export onChannelUnsubscribeFinishedEvent
+func onChannelUnsubscribeFinishedEvent(serverConnectionHandlerID C.uint64) {
+	if cb := loadCallbacks(); cb.ChannelUnsubscribeFinished != nil {
+		cb.ChannelUnsubscribeFinished(
+			ConnectionHandlerID(serverConnectionHandlerID),
+		)
+	}
+}
+
+//export onChannelDescriptionUpdateEvent
+func onChannelDescriptionUpdateEvent(serverConnectionHandlerID C.uint64, channelID C.uint64) {
+	if cb := loadCallbacks(); cb.ChannelDescriptionUpdate != nil {
+		cb.ChannelDescriptionUpdate(
+			ConnectionHandlerID(serverConnectionHandlerID),
+			ChannelID(channelID),
+		)
+	}
+}
+
+//export onChannelPasswordChangedEvent
+func onChannelPasswordChangedEvent(serverConnectionHandlerID C.uint64, channelID C.uint64) {
+	if cb := loadCallbacks(); cb.ChannelPasswordChanged != nil {
+		cb.ChannelPasswordChanged(
+			ConnectionHandlerID(serverConnectionHandlerID),
+			ChannelID(channelID),
+		)
+	}
+}
+
+//export onPlaybackShutdownCompleteEvent
+func onPlaybackShutdownCompleteEvent(serverConnectionHandlerID C.uint64) {
+	if cb := loadCallbacks(); cb.PlaybackShutdownComplete != nil {
+		cb.PlaybackShutdownComplete(
+			ConnectionHandlerID(serverConnectionHandlerID),
+		)
+	}
+}
+
+//export onSoundDeviceListChangedEvent
+func onSoundDeviceListChangedEvent(modeID *C.char, playOrCap C.int) {
+	if cb := loadCallbacks(); cb.SoundDeviceListChanged != nil {
+		cb.SoundDeviceListChanged(
+			C.GoString(modeID),
+			int(playOrCap),
+		)
+	}
+}
+
+//export onUserLoggingMessageEvent
+func onUserLoggingMessageEvent(logmessage *C.char, logLevel C.int, logChannel *C.char, logID C.uint64, logTime *C.char, completeLogString *C.char) {
+	if cb := loadCallbacks(); cb.UserLoggingMessage != nil {
+		cb.UserLoggingMessage(
+			C.GoString(logmessage),
+			int(logLevel),
+			C.GoString(logChannel),
+			uint64(logID),
+			C.GoString(logTime),
+			C.GoString(completeLogString),
+		)
+	}
+}
+
+//export onProvisioningSlotRequestResultEvent
+func onProvisioningSlotRequestResultEvent(error C.uint, requestHandle C.uint64, connectionKey *C.char) {
+	if cb := loadCallbacks(); cb.ProvisioningSlotRequestResult != nil {
+		cb.ProvisioningSlotRequestResult(
+			Error(error),
+			uint64(requestHandle),
+			C.GoString(connectionKey),
+		)
+	}
+}
+
+//export onFileTransferStatusEvent
+func onFileTransferStatusEvent(transferID C.anyID, status C.uint, statusMessage *C.char, remotefileSize C.uint64, serverConnectionHandlerID C.uint64) {
+	if cb := loadCallbacks(); cb.FileTransferStatus != nil {
+		cb.FileTransferStatus(
+			uint16(transferID),
+			uint32(status),
+			C.GoString(statusMessage),
+			uint64(remotefileSize),
+			ConnectionHandlerID(serverConnectionHandlerID),
+		)
+	}
+}
+
+//export onFileListEvent
+func onFileListEvent(serverConnectionHandlerID C.uint64, channelID C.uint64, path *C.char, name *C.char, size C.uint64, datetime C.uint64, type_ C.int, incompletesize C.uint64, returnCode *C.char) {
+	if cb := loadCallbacks(); cb.FileList != nil {
+		cb.FileList(
+			ConnectionHandlerID(serverConnectionHandlerID),
+			ChannelID(channelID),
+			C.GoString(path),
+			C.GoString(name),
+			uint64(size),
+			uint64(datetime),
+			int(type_),
+			uint64(incompletesize),
+			C.GoString(returnCode),
+		)
+	}
+}
+
+//export onFileListFinishedEvent
+func onFileListFinishedEvent(serverConnectionHandlerID C.uint64, channelID C.uint64, path *C.char) {
+	if cb := loadCallbacks(); cb.FileListFinished != nil {
+		cb.FileListFinished(
+			ConnectionHandlerID(serverConnectionHandlerID),
+			ChannelID(channelID),
+			C.GoString(path),
+		)
+	}
+}
+
+//export onFileInfoEvent
+func onFileInfoEvent(serverConnectionHandlerID C.uint64, channelID C.uint64, name *C.char, size C.uint64, datetime C.uint64) {
+	if cb := loadCallbacks(); cb.FileInfo != nil {
+		cb.FileInfo(
+			ConnectionHandlerID(serverConnectionHandlerID),
+			ChannelID(channelID),
+			C.GoString(name),
+			uint64(size),
+			uint64(datetime),
+		)
+	}
+}
+
+//export onChatLoginTokenEvent
+func onChatLoginTokenEvent(serverConnectionHandlerID C.uint64, token *C.char) {
+	if cb := loadCallbacks(); cb.ChatLoginToken != nil {
+		cb.ChatLoginToken(
+			ConnectionHandlerID(serverConnectionHandlerID),
+			C.GoString(token),
+		)
+	}
+}
+
+//export onAuthenticationTokenEvent
+func onAuthenticationTokenEvent(serverConnectionHandlerID C.uint64, token *C.char) {
+	if cb := loadCallbacks(); cb.AuthenticationToken != nil {
+		cb.AuthenticationToken(
+			ConnectionHandlerID(serverConnectionHandlerID),
+			C.GoString(token),
+		)
+	}
+}
+
+// dispatchExtraEvent hands a queued event of a generated callback to cb
+func dispatchExtraEvent(cb *Callbacks, ev *C.struct_ts3sdk_event) {
+	switch ev.kind {
+	case C.TS3SDK_EVENT_CLIENT_MOVE_MOVED:
+		if cb.ClientMoveMoved != nil {
+			s := eventStrings(ev)
+			cb.ClientMoveMoved(ConnectionHandlerID(ev.serverConnectionHandlerID), ClientID(ev.clientID), ChannelID(ev.channelID), ChannelID(ev.otherChannelID), int(ev.value), ClientID(ev.invokerID), internBytes(s[0]), internBytes(s[1]), string(s[2]))
+		}
+	case C.TS3SDK_EVENT_CLIENT_KICK_FROM_CHANNEL:
+		if cb.ClientKickFromChannel != nil {
+			s := eventStrings(ev)
+			cb.ClientKickFromChannel(ConnectionHandlerID(ev.serverConnectionHandlerID), ClientID(ev.clientID), ChannelID(ev.channelID), ChannelID(ev.otherChannelID), int(ev.value), ClientID(ev.invokerID), internBytes(s[0]), internBytes(s[1]), string(s[2]))
+		}
+	case C.TS3SDK_EVENT_CLIENT_KICK_FROM_SERVER:
+		if cb.ClientKickFromServer != nil {
+			s := eventStrings(ev)
+			cb.ClientKickFromServer(ConnectionHandlerID(ev.serverConnectionHandlerID), ClientID(ev.clientID), ChannelID(ev.channelID), ChannelID(ev.otherChannelID), int(ev.value), ClientID(ev.invokerID), internBytes(s[0]), internBytes(s[1]), string(s[2]))
+		}
+	case C.TS3SDK_EVENT_CLIENT_IDS:
+		if cb.ClientIDs != nil {
+			s := eventStrings(ev)
+			cb.ClientIDs(ConnectionHandlerID(ev.serverConnectionHandlerID), internBytes(s[0]), ClientID(ev.clientID), internBytes(s[1]))
+		}
+	case C.TS3SDK_EVENT_CLIENT_IDS_FINISHED:
+		if cb.ClientIDsFinished != nil {
+			cb.ClientIDsFinished(ConnectionHandlerID(ev.serverConnectionHandlerID))
+		}
+	case C.TS3SDK_EVENT_SERVER_EDITED:
+		if cb.ServerEdited != nil {
+			s := eventStrings(ev)
+			cb.ServerEdited(ConnectionHandlerID(ev.serverConnectionHandlerID), ClientID(ev.clientID), internBytes(s[0]), internBytes(s[1]))
+		}
+	case C.TS3SDK_EVENT_SERVER_UPDATED:
+		if cb.ServerUpdated != nil {
+			cb.ServerUpdated(ConnectionHandlerID(ev.serverConnectionHandlerID))
+		}
+	case C.TS3SDK_EVENT_SERVER_STOP:
+		if cb.ServerStop != nil {
+			s := eventStrings(ev)
+			cb.ServerStop(ConnectionHandlerID(ev.serverConnectionHandlerID), string(s[0]))
+		}
+	case C.TS3SDK_EVENT_IGNORED_WHISPER:
+		if cb.IgnoredWhisper != nil {
+			cb.IgnoredWhisper(ConnectionHandlerID(ev.serverConnectionHandlerID), ClientID(ev.clientID))
+		}
+	case C.TS3SDK_EVENT_CONNECTION_INFO:
+		if cb.ConnectionInfo != nil {
+			cb.ConnectionInfo(ConnectionHandlerID(ev.serverConnectionHandlerID), ClientID(ev.clientID))
+		}
+	case C.TS3SDK_EVENT_SERVER_CONNECTION_INFO:
+		if cb.ServerConnectionInfo != nil {
+			cb.ServerConnectionInfo(ConnectionHandlerID(ev.serverConnectionHandlerID))
+		}
+	case C.TS3SDK_EVENT_CHANNEL_SUBSCRIBE:
+		if cb.ChannelSubscribe != nil {
+			cb.ChannelSubscribe(ConnectionHandlerID(ev.serverConnectionHandlerID), ChannelID(ev.channelID))
+		}
+	case C.TS3SDK_EVENT_CHANNEL_SUBSCRIBE_FINISHED:
+		if cb.ChannelSubscribeFinished != nil {
+			cb.ChannelSubscribeFinished(ConnectionHandlerID(ev.serverConnectionHandlerID))
+		}
+	case C.TS3SDK_EVENT_CHANNEL_UNSUBSCRIBE:
+		if cb.ChannelUnsubscribe != nil {
+			cb.ChannelUnsubscribe(ConnectionHandlerID(ev.serverConnectionHandlerID), ChannelID(ev.channelID))
+		}
+	case C.TS3SDK_EVENT_CHANNEL_UNSUBSCRIBE_FINISHED:
+		if cb.ChannelUnsubscribeFinished != nil {
+			cb.ChannelUnsubscribeFinished(ConnectionHandlerID(ev.serverConnectionHandlerID))
+		}
+	case C.TS3SDK_EVENT_CHANNEL_DESCRIPTION_UPDATE:
+		if cb.ChannelDescriptionUpdate != nil {
+			cb.ChannelDescriptionUpdate(ConnectionHandlerID(ev.serverConnectionHandlerID), ChannelID(ev.channelID))
+		}
+	case C.TS3SDK_EVENT_CHANNEL_PASSWORD_CHANGED:
+		if cb.ChannelPasswordChanged != nil {
+			cb.ChannelPasswordChanged(ConnectionHandlerID(ev.serverConnectionHandlerID), ChannelID(ev.channelID))
+		}
+	case C.TS3SDK_EVENT_PLAYBACK_SHUTDOWN_COMPLETE:
+		if cb.PlaybackShutdownComplete != nil {
+			cb.PlaybackShutdownComplete(ConnectionHandlerID(ev.serverConnectionHandlerID))
+		}
+	case C.TS3SDK_EVENT_SOUND_DEVICE_LIST_CHANGED:
+		if cb.SoundDeviceListChanged != nil {
+			s := eventStrings(ev)
+			cb.SoundDeviceListChanged(string(s[0]), int(ev.value))
+		}
+	case C.TS3SDK_EVENT_PROVISIONING_SLOT_REQUEST_RESULT:
+		if cb.ProvisioningSlotRequestResult != nil {
+			s := eventStrings(ev)
+			cb.ProvisioningSlotRequestResult(Error(ev.errorNumber), uint64(ev.channelID), string(s[0]))
+		}
+	case C.TS3SDK_EVENT_FILE_TRANSFER_STATUS:
+		if cb.FileTransferStatus != nil {
+			s := eventStrings(ev)
+			cb.FileTransferStatus(uint16(ev.clientID), uint32(ev.errorNumber), string(s[0]), uint64(ev.channelID), ConnectionHandlerID(ev.serverConnectionHandlerID))
+		}
+	case C.TS3SDK_EVENT_FILE_LIST:
+		if cb.FileList != nil {
+			s := eventStrings(ev)
+			cb.FileList(ConnectionHandlerID(ev.serverConnectionHandlerID), ChannelID(ev.channelID), string(s[0]), string(s[1]), uint64(ev.otherChannelID), uint64(ev.extra[0]), int(ev.value), uint64(ev.extra[1]), string(s[2]))
+		}
+	case C.TS3SDK_EVENT_FILE_LIST_FINISHED:
+		if cb.FileListFinished != nil {
+			s := eventStrings(ev)
+			cb.FileListFinished(ConnectionHandlerID(ev.serverConnectionHandlerID), ChannelID(ev.channelID), string(s[0]))
+		}
+	case C.TS3SDK_EVENT_FILE_INFO:
+		if cb.FileInfo != nil {
+			s := eventStrings(ev)
+			cb.FileInfo(ConnectionHandlerID(ev.serverConnectionHandlerID), ChannelID(ev.channelID), string(s[0]), uint64(ev.otherChannelID), uint64(ev.extra[0]))
+		}
+	case C.TS3SDK_EVENT_CHAT_LOGIN_TOKEN:
+		if cb.ChatLoginToken != nil {
+			s := eventStrings(ev)
+			cb.ChatLoginToken(ConnectionHandlerID(ev.serverConnectionHandlerID), string(s[0]))
+		}
+	case C.TS3SDK_EVENT_AUTHENTICATION_TOKEN:
+		if cb.AuthenticationToken != nil {
+			s := eventStrings(ev)
+			cb.AuthenticationToken(ConnectionHandlerID(ev.serverConnectionHandlerID), string(s[0]))
+		}
+	}
+}
+
+// routeExtraCallbacks returns callbacks that hand the generated events to route, by the
+// connection they belong to. Events without a connection go to connection 0.
+func routeExtraCallbacks(cb ExtraCallbacks, route func(ConnectionHandlerID, func())) ExtraCallbacks {
+	var routed ExtraCallbacks
+	if cb.ClientMoveMoved != nil {
+		routed.ClientMoveMoved = func(serverConnectionHandlerID ConnectionHandlerID, clientID ClientID, oldChannelID ChannelID, newChannelID ChannelID, visibility int, moverID ClientID, moverName string, moverUniqueIdentifier string, moveMessage string) {
+			route(serverConnectionHandlerID, func() {
+				cb.ClientMoveMoved(serverConnectionHandlerID, clientID, oldChannelID, newChannelID, visibility, moverID, moverName, moverUniqueIdentifier, moveMessage)
+			})
+		}
+	}
+	if cb.ClientKickFromChannel != nil {
+		routed.ClientKickFromChannel = func(serverConnectionHandlerID ConnectionHandlerID, clientID ClientID, oldChannelID ChannelID, newChannelID ChannelID, visibility int, kickerID ClientID, kickerName string, kickerUniqueIdentifier string, kickMessage string) {
+			route(serverConnectionHandlerID, func() {
+				cb.ClientKickFromChannel(serverConnectionHandlerID, clientID, oldChannelID, newChannelID, visibility, kickerID, kickerName, kickerUniqueIdentifier, kickMessage)
+			})
+		}
+	}
+	if cb.ClientKickFromServer != nil {
+		routed.ClientKickFromServer = func(serverConnectionHandlerID ConnectionHandlerID, clientID ClientID, oldChannelID ChannelID, newChannelID ChannelID, visibility int, kickerID ClientID, kickerName string, kickerUniqueIdentifier string, kickMessage string) {
+			route(serverConnectionHandlerID, func() {
+				cb.ClientKickFromServer(serverConnectionHandlerID, clientID, oldChannelID, newChannelID, visibility, kickerID, kickerName, kickerUniqueIdentifier, kickMessage)
+			})
+		}
+	}
+	if cb.ClientIDs != nil {
+		routed.ClientIDs = func(serverConnectionHandlerID ConnectionHandlerID, uniqueClientIdentifier string, clientID ClientID, clientName string) {
+			route(serverConnectionHandlerID, func() { cb.ClientIDs(serverConnectionHandlerID, uniqueClientIdentifier, clientID, clientName) })
+		}
+	}
+	if cb.ClientIDsFinished != nil {
+		routed.ClientIDsFinished = func(serverConnectionHandlerID ConnectionHandlerID) {
+			route(serverConnectionHandlerID, func() { cb.ClientIDsFinished(serverConnectionHandlerID) })
+		}
+	}
+	if cb.ServerEdited != nil {
+		routed.ServerEdited = func(serverConnectionHandlerID ConnectionHandlerID, editerID ClientID, editerName string, editerUniqueIdentifier string) {
+			route(serverConnectionHandlerID, func() { cb.ServerEdited(serverConnectionHandlerID, editerID, editerName, editerUniqueIdentifier) })
+		}
+	}
+	if cb.ServerUpdated != nil {
+		routed.ServerUpdated = func(serverConnectionHandlerID ConnectionHandlerID) {
+			route(serverConnectionHandlerID, func() { cb.ServerUpdated(serverConnectionHandlerID) })
+		}
+	}
+	if cb.ServerStop != nil {
+		routed.ServerStop = func(serverConnectionHandlerID ConnectionHandlerID, shutdownMessage string) {
+			route(serverConnectionHandlerID, func() { cb.ServerStop(serverConnectionHandlerID, shutdownMessage) })
+		}
+	}
+	if cb.IgnoredWhisper != nil {
+		routed.IgnoredWhisper = func(serverConnectionHandlerID ConnectionHandlerID, clientID ClientID) {
+			route(serverConnectionHandlerID, func() { cb.IgnoredWhisper(serverConnectionHandlerID, clientID) })
+		}
+	}
+	if cb.ConnectionInfo != nil {
+		routed.ConnectionInfo = func(serverConnectionHandlerID ConnectionHandlerID, clientID ClientID) {
+			route(serverConnectionHandlerID, func() { cb.ConnectionInfo(serverConnectionHandlerID, clientID) })
+		}
+	}
+	if cb.ServerConnectionInfo != nil {
+		routed.ServerConnectionInfo = func(serverConnectionHandlerID ConnectionHandlerID) {
+			route(serverConnectionHandlerID, func() { cb.ServerConnectionInfo(serverConnectionHandlerID) })
+		}
+	}
+	if cb.ChannelSubscribe != nil {
+		routed.ChannelSubscribe = func(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID) {
+			route(serverConnectionHandlerID, func() { cb.ChannelSubscribe(serverConnectionHandlerID, channelID) })
+		}
+	}
+	if cb.ChannelSubscribeFinished != nil {
+		routed.ChannelSubscribeFinished = func(serverConnectionHandlerID ConnectionHandlerID) {
+			route(serverConnectionHandlerID, func() { cb.ChannelSubscribeFinished(serverConnectionHandlerID) })
+		}
+	}
+	if cb.ChannelUnsubscribe != nil {
+		routed.ChannelUnsubscribe = func(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID) {
+			route(serverConnectionHandlerID, func() { cb.ChannelUnsubscribe(serverConnectionHandlerID, channelID) })
+		}
+	}
+	if cb.ChannelUnsubscribeFinished != nil {
+		routed.ChannelUnsubscribeFinished = func(serverConnectionHandlerID ConnectionHandlerID) {
+			route(serverConnectionHandlerID, func() { cb.ChannelUnsubscribeFinished(serverConnectionHandlerID) })
+		}
+	}
+	if cb.ChannelDescriptionUpdate != nil {
+		routed.ChannelDescriptionUpdate = func(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID) {
+			route(serverConnectionHandlerID, func() { cb.ChannelDescriptionUpdate(serverConnectionHandlerID, channelID) })
+		}
+	}
+	if cb.ChannelPasswordChanged != nil {
+		routed.ChannelPasswordChanged = func(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID) {
+			route(serverConnectionHandlerID, func() { cb.ChannelPasswordChanged(serverConnectionHandlerID, channelID) })
+		}
+	}
+	if cb.PlaybackShutdownComplete != nil {
+		routed.PlaybackShutdownComplete = func(serverConnectionHandlerID ConnectionHandlerID) {
+			route(serverConnectionHandlerID, func() { cb.PlaybackShutdownComplete(serverConnectionHandlerID) })
+		}
+	}
+	if cb.SoundDeviceListChanged != nil {
+		routed.SoundDeviceListChanged = func(modeID string, playOrCap int) {
+			route(0, func() { cb.SoundDeviceListChanged(modeID, playOrCap) })
+		}
+	}
+	if cb.UserLoggingMessage != nil {
+		routed.UserLoggingMessage = func(logmessage string, logLevel int, logChannel string, logID uint64, logTime string, completeLogString string) {
+			route(0, func() { cb.UserLoggingMessage(logmessage, logLevel, logChannel, logID, logTime, completeLogString) })
+		}
+	}
+	if cb.ProvisioningSlotRequestResult != nil {
+		routed.ProvisioningSlotRequestResult = func(error Error, requestHandle uint64, connectionKey string) {
+			route(0, func() { cb.ProvisioningSlotRequestResult(error, requestHandle, connectionKey) })
+		}
+	}
+	if cb.FileTransferStatus != nil {
+		routed.FileTransferStatus = func(transferID uint16, status uint32, statusMessage string, remotefileSize uint64, serverConnectionHandlerID ConnectionHandlerID) {
+			route(serverConnectionHandlerID, func() {
+				cb.FileTransferStatus(transferID, status, statusMessage, remotefileSize, serverConnectionHandlerID)
+			})
+		}
+	}
+	if cb.FileList != nil {
+		routed.FileList = func(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID, path string, name string, size uint64, datetime uint64, type_ int, incompletesize uint64, returnCode string) {
+			route(serverConnectionHandlerID, func() {
+				cb.FileList(serverConnectionHandlerID, channelID, path, name, size, datetime, type_, incompletesize, returnCode)
+			})
+		}
+	}
+	if cb.FileListFinished != nil {
+		routed.FileListFinished = func(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID, path string) {
+			route(serverConnectionHandlerID, func() { cb.FileListFinished(serverConnectionHandlerID, channelID, path) })
+		}
+	}
+	if cb.FileInfo != nil {
+		routed.FileInfo = func(serverConnectionHandlerID ConnectionHandlerID, channelID ChannelID, name string, size uint64, datetime uint64) {
+			route(serverConnectionHandlerID, func() { cb.FileInfo(serverConnectionHandlerID, channelID, name, size, datetime) })
+		}
+	}
+	if cb.ChatLoginToken != nil {
+		routed.ChatLoginToken = func(serverConnectionHandlerID ConnectionHandlerID, token string) {
+			route(serverConnectionHandlerID, func() { cb.ChatLoginToken(serverConnectionHandlerID, token) })
+		}
+	}
+	if cb.AuthenticationToken != nil {
+		routed.AuthenticationToken = func(serverConnectionHandlerID ConnectionHandlerID, token string) {
+			route(serverConnectionHandlerID, func() { cb.AuthenticationToken(serverConnectionHandlerID, token) })
+		}
+	}
+	return routed
+}
+
+// LocalTestMode is the C enum LocalTestMode
+type LocalTestMode int
+
+// LocalTestMode enum values
+const (
+	TestModeOff                   = LocalTestMode(C.TEST_MODE_OFF)
+	TestModeVoiceLocalOnly        = LocalTestMode(C.TEST_MODE_VOICE_LOCAL_ONLY)
+	TestModeVoiceLocalAndRemote   = LocalTestMode(C.TEST_MODE_VOICE_LOCAL_AND_REMOTE)
+	TestModeTalkStatusChangesOnly = LocalTestMode(C.TEST_MODE_TALK_STATUS_CHANGES_ONLY)
+)
+
+// TextMessageTargetMode is the C enum TextMessageTargetMode
+type TextMessageTargetMode int
+
+// TextMessageTargetMode enum values
+const (
+	TextmessagetargetClient  = TextMessageTargetMode(C.TextMessageTarget_CLIENT)
+	TextmessagetargetChannel = TextMessageTargetMode(C.TextMessageTarget_CHANNEL)
+	TextmessagetargetServer  = TextMessageTargetMode(C.TextMessageTarget_SERVER)
+	TextmessagetargetMax     = TextMessageTargetMode(C.TextMessageTarget_MAX)
+)
+
+// MuteInputStatus is the C enum MuteInputStatus
+type MuteInputStatus int
+
+// MuteInputStatus enum values
+const (
+	MuteinputNone  = MuteInputStatus(C.MUTEINPUT_NONE)
+	MuteinputMuted = MuteInputStatus(C.MUTEINPUT_MUTED)
+)
+
+// MuteOutputStatus is the C enum MuteOutputStatus
+type MuteOutputStatus int
+
+// MuteOutputStatus enum values
+const (
+	MuteoutputNone  = MuteOutputStatus(C.MUTEOUTPUT_NONE)
+	MuteoutputMuted = MuteOutputStatus(C.MUTEOUTPUT_MUTED)
+)
+
+// HardwareInputStatus is the C enum HardwareInputStatus
+type HardwareInputStatus int
+
+// HardwareInputStatus enum values
+const (
+	HardwareinputDisabled = HardwareInputStatus(C.HARDWAREINPUT_DISABLED)
+	HardwareinputEnabled  = HardwareInputStatus(C.HARDWAREINPUT_ENABLED)
+)
+
+// HardwareOutputStatus is the C enum HardwareOutputStatus
+type HardwareOutputStatus int
+
+// HardwareOutputStatus enum values
+const (
+	HardwareoutputDisabled = HardwareOutputStatus(C.HARDWAREOUTPUT_DISABLED)
+	HardwareoutputEnabled  = HardwareOutputStatus(C.HARDWAREOUTPUT_ENABLED)
+)
+
+// ProtocolEncryptionCipher is the C enum Protocol_Encryption_Cipher
+type ProtocolEncryptionCipher int
+
+// Protocol_Encryption_Cipher enum values
+const (
+	Aes128                            = ProtocolEncryptionCipher(C.AES_128)
+	Aes256                            = ProtocolEncryptionCipher(C.AES_256)
+	ProtocolEncryptionCipherEndMarker = ProtocolEncryptionCipher(C.PROTOCOL_ENCRYPTION_CIPHER_END_MARKER)
+)
+
+// ChannelProperties enum values
+const (
+	ChannelUniqueIdentifier = ChannelProperties(C.CHANNEL_UNIQUE_IDENTIFIER)
+)
+
+// VirtualServerProperties is the C enum VirtualServerProperties
+type VirtualServerProperties int
+
+// VirtualServerProperties enum values
+const (
+	VirtualserverUniqueIdentifier          = VirtualServerProperties(C.VIRTUALSERVER_UNIQUE_IDENTIFIER)
+	VirtualserverName                      = VirtualServerProperties(C.VIRTUALSERVER_NAME)
+	VirtualserverWelcomemessage            = VirtualServerProperties(C.VIRTUALSERVER_WELCOMEMESSAGE)
+	VirtualserverPlatform                  = VirtualServerProperties(C.VIRTUALSERVER_PLATFORM)
+	VirtualserverVersion                   = VirtualServerProperties(C.VIRTUALSERVER_VERSION)
+	VirtualserverMaxclients                = VirtualServerProperties(C.VIRTUALSERVER_MAXCLIENTS)
+	VirtualserverPassword                  = VirtualServerProperties(C.VIRTUALSERVER_PASSWORD)
+	VirtualserverClientsOnline             = VirtualServerProperties(C.VIRTUALSERVER_CLIENTS_ONLINE)
+	VirtualserverChannelsOnline            = VirtualServerProperties(C.VIRTUALSERVER_CHANNELS_ONLINE)
+	VirtualserverCreated                   = VirtualServerProperties(C.VIRTUALSERVER_CREATED)
+	VirtualserverUptime                    = VirtualServerProperties(C.VIRTUALSERVER_UPTIME)
+	VirtualserverCodecEncryptionMode       = VirtualServerProperties(C.VIRTUALSERVER_CODEC_ENCRYPTION_MODE)
+	VirtualserverEncryptionCiphers         = VirtualServerProperties(C.VIRTUALSERVER_ENCRYPTION_CIPHERS)
+	VirtualserverFilebase                  = VirtualServerProperties(C.VIRTUALSERVER_FILEBASE)
+	VirtualserverMaxDownloadTotalBandwidth = VirtualServerProperties(C.VIRTUALSERVER_MAX_DOWNLOAD_TOTAL_BANDWIDTH)
+	VirtualserverMaxUploadTotalBandwidth   = VirtualServerProperties(C.VIRTUALSERVER_MAX_UPLOAD_TOTAL_BANDWIDTH)
+	VirtualserverLogFiletransfer           = VirtualServerProperties(C.VIRTUALSERVER_LOG_FILETRANSFER)
+)
+
+// ConnectionProperties is the C enum ConnectionProperties
+type ConnectionProperties int
+
+// ConnectionProperties enum values
+const (
+	ConnectionPing                                 = ConnectionProperties(C.CONNECTION_PING)
+	ConnectionPingDeviation                        = ConnectionProperties(C.CONNECTION_PING_DEVIATION)
+	ConnectionConnectedTime                        = ConnectionProperties(C.CONNECTION_CONNECTED_TIME)
+	ConnectionIdleTime                             = ConnectionProperties(C.CONNECTION_IDLE_TIME)
+	ConnectionClientIp                             = ConnectionProperties(C.CONNECTION_CLIENT_IP)
+	ConnectionClientPort                           = ConnectionProperties(C.CONNECTION_CLIENT_PORT)
+	ConnectionServerIp                             = ConnectionProperties(C.CONNECTION_SERVER_IP)
+	ConnectionServerPort                           = ConnectionProperties(C.CONNECTION_SERVER_PORT)
+	ConnectionPacketsSentSpeech                    = ConnectionProperties(C.CONNECTION_PACKETS_SENT_SPEECH)
+	ConnectionPacketsSentKeepalive                 = ConnectionProperties(C.CONNECTION_PACKETS_SENT_KEEPALIVE)
+	ConnectionPacketsSentControl                   = ConnectionProperties(C.CONNECTION_PACKETS_SENT_CONTROL)
+	ConnectionPacketsSentTotal                     = ConnectionProperties(C.CONNECTION_PACKETS_SENT_TOTAL)
+	ConnectionBytesSentSpeech                      = ConnectionProperties(C.CONNECTION_BYTES_SENT_SPEECH)
+	ConnectionBytesSentKeepalive                   = ConnectionProperties(C.CONNECTION_BYTES_SENT_KEEPALIVE)
+	ConnectionBytesSentControl                     = ConnectionProperties(C.CONNECTION_BYTES_SENT_CONTROL)
+	ConnectionBytesSentTotal                       = ConnectionProperties(C.CONNECTION_BYTES_SENT_TOTAL)
+	ConnectionPacketsReceivedSpeech                = ConnectionProperties(C.CONNECTION_PACKETS_RECEIVED_SPEECH)
+	ConnectionPacketsReceivedKeepalive             = ConnectionProperties(C.CONNECTION_PACKETS_RECEIVED_KEEPALIVE)
+	ConnectionPacketsReceivedControl               = ConnectionProperties(C.CONNECTION_PACKETS_RECEIVED_CONTROL)
+	ConnectionPacketsReceivedTotal                 = ConnectionProperties(C.CONNECTION_PACKETS_RECEIVED_TOTAL)
+	ConnectionBytesReceivedSpeech                  = ConnectionProperties(C.CONNECTION_BYTES_RECEIVED_SPEECH)
+	ConnectionBytesReceivedKeepalive               = ConnectionProperties(C.CONNECTION_BYTES_RECEIVED_KEEPALIVE)
+	ConnectionBytesReceivedControl                 = ConnectionProperties(C.CONNECTION_BYTES_RECEIVED_CONTROL)
+	ConnectionBytesReceivedTotal                   = ConnectionProperties(C.CONNECTION_BYTES_RECEIVED_TOTAL)
+	ConnectionPacketlossSpeech                     = ConnectionProperties(C.CONNECTION_PACKETLOSS_SPEECH)
+	ConnectionPacketlossKeepalive                  = ConnectionProperties(C.CONNECTION_PACKETLOSS_KEEPALIVE)
+	ConnectionPacketlossControl                    = ConnectionProperties(C.CONNECTION_PACKETLOSS_CONTROL)
+	ConnectionPacketlossTotal                      = ConnectionProperties(C.CONNECTION_PACKETLOSS_TOTAL)
+	ConnectionServer2clientPacketlossSpeech        = ConnectionProperties(C.CONNECTION_SERVER2CLIENT_PACKETLOSS_SPEECH)
+	ConnectionServer2clientPacketlossKeepalive     = ConnectionProperties(C.CONNECTION_SERVER2CLIENT_PACKETLOSS_KEEPALIVE)
+	ConnectionServer2clientPacketlossControl       = ConnectionProperties(C.CONNECTION_SERVER2CLIENT_PACKETLOSS_CONTROL)
+	ConnectionServer2clientPacketlossTotal         = ConnectionProperties(C.CONNECTION_SERVER2CLIENT_PACKETLOSS_TOTAL)
+	ConnectionClient2serverPacketlossSpeech        = ConnectionProperties(C.CONNECTION_CLIENT2SERVER_PACKETLOSS_SPEECH)
+	ConnectionClient2serverPacketlossKeepalive     = ConnectionProperties(C.CONNECTION_CLIENT2SERVER_PACKETLOSS_KEEPALIVE)
+	ConnectionClient2serverPacketlossControl       = ConnectionProperties(C.CONNECTION_CLIENT2SERVER_PACKETLOSS_CONTROL)
+	ConnectionClient2serverPacketlossTotal         = ConnectionProperties(C.CONNECTION_CLIENT2SERVER_PACKETLOSS_TOTAL)
+	ConnectionBandwidthSentLastSecondSpeech        = ConnectionProperties(C.CONNECTION_BANDWIDTH_SENT_LAST_SECOND_SPEECH)
+	ConnectionBandwidthSentLastSecondKeepalive     = ConnectionProperties(C.CONNECTION_BANDWIDTH_SENT_LAST_SECOND_KEEPALIVE)
+	ConnectionBandwidthSentLastSecondControl       = ConnectionProperties(C.CONNECTION_BANDWIDTH_SENT_LAST_SECOND_CONTROL)
+	ConnectionBandwidthSentLastSecondTotal         = ConnectionProperties(C.CONNECTION_BANDWIDTH_SENT_LAST_SECOND_TOTAL)
+	ConnectionBandwidthSentLastMinuteSpeech        = ConnectionProperties(C.CONNECTION_BANDWIDTH_SENT_LAST_MINUTE_SPEECH)
+	ConnectionBandwidthSentLastMinuteKeepalive     = ConnectionProperties(C.CONNECTION_BANDWIDTH_SENT_LAST_MINUTE_KEEPALIVE)
+	ConnectionBandwidthSentLastMinuteControl       = ConnectionProperties(C.CONNECTION_BANDWIDTH_SENT_LAST_MINUTE_CONTROL)
+	ConnectionBandwidthSentLastMinuteTotal         = ConnectionProperties(C.CONNECTION_BANDWIDTH_SENT_LAST_MINUTE_TOTAL)
+	ConnectionBandwidthReceivedLastSecondSpeech    = ConnectionProperties(C.CONNECTION_BANDWIDTH_RECEIVED_LAST_SECOND_SPEECH)
+	ConnectionBandwidthReceivedLastSecondKeepalive = ConnectionProperties(C.CONNECTION_BANDWIDTH_RECEIVED_LAST_SECOND_KEEPALIVE)
+	ConnectionBandwidthReceivedLastSecondControl   = ConnectionProperties(C.CONNECTION_BANDWIDTH_RECEIVED_LAST_SECOND_CONTROL)
+	ConnectionBandwidthReceivedLastSecondTotal     = ConnectionProperties(C.CONNECTION_BANDWIDTH_RECEIVED_LAST_SECOND_TOTAL)
+	ConnectionBandwidthReceivedLastMinuteSpeech    = ConnectionProperties(C.CONNECTION_BANDWIDTH_RECEIVED_LAST_MINUTE_SPEECH)
+	ConnectionBandwidthReceivedLastMinuteKeepalive = ConnectionProperties(C.CONNECTION_BANDWIDTH_RECEIVED_LAST_MINUTE_KEEPALIVE)
+	ConnectionBandwidthReceivedLastMinuteControl   = ConnectionProperties(C.CONNECTION_BANDWIDTH_RECEIVED_LAST_MINUTE_CONTROL)
+	ConnectionBandwidthReceivedLastMinuteTotal     = ConnectionProperties(C.CONNECTION_BANDWIDTH_RECEIVED_LAST_MINUTE_TOTAL)
+	ConnectionFiletransferBandwidthSent            = ConnectionProperties(C.CONNECTION_FILETRANSFER_BANDWIDTH_SENT)
+	ConnectionFiletransferBandwidthReceived        = ConnectionProperties(C.CONNECTION_FILETRANSFER_BANDWIDTH_RECEIVED)
+	ConnectionFiletransferBytesReceivedTotal       = ConnectionProperties(C.CONNECTION_FILETRANSFER_BYTES_RECEIVED_TOTAL)
+	ConnectionFiletransferBytesSentTotal           = ConnectionProperties(C.CONNECTION_FILETRANSFER_BYTES_SENT_TOTAL)
+)
+
+// GroupWhisperType is the C enum GroupWhisperType
+type GroupWhisperType int
+
+// GroupWhisperType enum values
+const (
+	GroupwhispertypeServergroup      = GroupWhisperType(C.GROUPWHISPERTYPE_SERVERGROUP)
+	GroupwhispertypeChannelgroup     = GroupWhisperType(C.GROUPWHISPERTYPE_CHANNELGROUP)
+	GroupwhispertypeChannelcommander = GroupWhisperType(C.GROUPWHISPERTYPE_CHANNELCOMMANDER)
+	GroupwhispertypeAllclients       = GroupWhisperType(C.GROUPWHISPERTYPE_ALLCLIENTS)
+)
+
+// GroupWhisperTargetMode is the C enum GroupWhisperTargetMode
+type GroupWhisperTargetMode int
+
+// GroupWhisperTargetMode enum values
+const (
+	GroupwhispertargetmodeAll                   = GroupWhisperTargetMode(C.GROUPWHISPERTARGETMODE_ALL)
+	GroupwhispertargetmodeCurrentchannel        = GroupWhisperTargetMode(C.GROUPWHISPERTARGETMODE_CURRENTCHANNEL)
+	GroupwhispertargetmodeParentchannel         = GroupWhisperTargetMode(C.GROUPWHISPERTARGETMODE_PARENTCHANNEL)
+	GroupwhispertargetmodeAllparentchannels     = GroupWhisperTargetMode(C.GROUPWHISPERTARGETMODE_ALLPARENTCHANNELS)
+	GroupwhispertargetmodeChannelfamily         = GroupWhisperTargetMode(C.GROUPWHISPERTARGETMODE_CHANNELFAMILY)
+	GroupwhispertargetmodeAncestorchannelfamily = GroupWhisperTargetMode(C.GROUPWHISPERTARGETMODE_ANCESTORCHANNELFAMILY)
+	GroupwhispertargetmodeSubchannels           = GroupWhisperTargetMode(C.GROUPWHISPERTARGETMODE_SUBCHANNELS)
+)
+
+// MonoSoundDestination is the C enum MonoSoundDestination
+type MonoSoundDestination int
+
+// MonoSoundDestination enum values
+const (
+	MonoSoundDestinationAll               = MonoSoundDestination(C.MONO_SOUND_DESTINATION_ALL)
+	MonoSoundDestinationFrontCenter       = MonoSoundDestination(C.MONO_SOUND_DESTINATION_FRONT_CENTER)
+	MonoSoundDestinationFrontLeftAndRight = MonoSoundDestination(C.MONO_SOUND_DESTINATION_FRONT_LEFT_AND_RIGHT)
+)
+
+// SecuritySaltOptions is the C enum SecuritySaltOptions
+type SecuritySaltOptions int
+
+// SecuritySaltOptions enum values
+const (
+	SecuritySaltCheckNickname = SecuritySaltOptions(C.SECURITY_SALT_CHECK_NICKNAME)
+	SecuritySaltCheckMetaData = SecuritySaltOptions(C.SECURITY_SALT_CHECK_META_DATA)
+)
+
+// ClientCommand is the C enum ClientCommand
+type ClientCommand int
+
+// ClientCommand enum values
+const (
+	ClientCommandRequestconnectioninfo        = ClientCommand(C.CLIENT_COMMAND_requestConnectionInfo)
+	ClientCommandRequestclientmove            = ClientCommand(C.CLIENT_COMMAND_requestClientMove)
+	ClientCommandRequestxxmuteclients         = ClientCommand(C.CLIENT_COMMAND_requestXXMuteClients)
+	ClientCommandRequestclientkickfromxxx     = ClientCommand(C.CLIENT_COMMAND_requestClientKickFromXXX)
+	ClientCommandFlushchannelcreation         = ClientCommand(C.CLIENT_COMMAND_flushChannelCreation)
+	ClientCommandFlushchannelupdates          = ClientCommand(C.CLIENT_COMMAND_flushChannelUpdates)
+	ClientCommandRequestchannelmove           = ClientCommand(C.CLIENT_COMMAND_requestChannelMove)
+	ClientCommandRequestchanneldelete         = ClientCommand(C.CLIENT_COMMAND_requestChannelDelete)
+	ClientCommandRequestchanneldescription    = ClientCommand(C.CLIENT_COMMAND_requestChannelDescription)
+	ClientCommandRequestchannelxxsubscribexxx = ClientCommand(C.CLIENT_COMMAND_requestChannelXXSubscribeXXX)
+	ClientCommandRequestserverconnectioninfo  = ClientCommand(C.CLIENT_COMMAND_requestServerConnectionInfo)
+	ClientCommandRequestsendxxxtextmsg        = ClientCommand(C.CLIENT_COMMAND_requestSendXXXTextMsg)
+	ClientCommandFiletransfers                = ClientCommand(C.CLIENT_COMMAND_filetransfers)
+)
+
+// ACLType is the C enum ACLType
+type ACLType int
+
+// ACLType enum values
+const (
+	AclNone      = ACLType(C.ACL_NONE)
+	AclWhiteList = ACLType(C.ACL_WHITE_LIST)
+	AclBlackList = ACLType(C.ACL_BLACK_LIST)
+)
+
+// FTAction is the C enum FTAction
+type FTAction int
+
+// FTAction enum values
+const (
+	FtInitServer  = FTAction(C.FT_INIT_SERVER)
+	FtInitChannel = FTAction(C.FT_INIT_CHANNEL)
+	FtUpload      = FTAction(C.FT_UPLOAD)
+	FtDownload    = FTAction(C.FT_DOWNLOAD)
+	FtDelete      = FTAction(C.FT_DELETE)
+	FtCreatedir   = FTAction(C.FT_CREATEDIR)
+	FtRename      = FTAction(C.FT_RENAME)
+	FtFilelist    = FTAction(C.FT_FILELIST)
+	FtFileinfo    = FTAction(C.FT_FILEINFO)
+)
+
+// FileTransferState is the C enum FileTransferState
+type FileTransferState int
+
+// FileTransferState enum values
+const (
+	FiletransferInitialising = FileTransferState(C.FILETRANSFER_INITIALISING)
+	FiletransferActive       = FileTransferState(C.FILETRANSFER_ACTIVE)
+	FiletransferFinished     = FileTransferState(C.FILETRANSFER_FINISHED)
+)
+
+// FileTransferType is the C enum FileTransferType
+type FileTransferType int
+
+// FileTransferType enum values
+const (
+	FilelisttypeDirectory = FileTransferType(C.FileListType_Directory)
+	FilelisttypeFile      = FileTransferType(C.FileListType_File)
+)
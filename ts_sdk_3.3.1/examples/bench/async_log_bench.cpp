@@ -0,0 +1,170 @@
+/*
+ * Error logging from 8 threads through the repeater's Async_Log against the synchronous log_now().
+ *
+ * Every thread logs 50 bursts, 64 records per burst through log() and log_now() and 16 per burst
+ * through log_text(), whose queue is smaller, and rests 10 ms between bursts so the log thread keeps
+ * up. The bench reports the time a call takes on the calling thread. The SDK calls are stubbed: the
+ * error text is formatted into a fresh allocation as the client lib does and the log message is
+ * only counted, so the synchronous numbers are without the SDK's file I/O. Exits with 1 if a record
+ * is lost or an error text is looked up more than once per code.
+ */
+
+#include "../client_cpp_repeater/async_log.hpp"
+
+#include <teamspeak/clientlib.h>
+#include <teamspeak/public_errors.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace com::teamspeak;
+
+namespace
+{
+    constexpr auto kThreads = 8;
+    constexpr auto kBursts = 50;
+    constexpr auto kCodes = 4u;
+    constexpr auto kRest = std::chrono::milliseconds(10);
+
+    std::atomic<uint64_t> written{ 0 };
+    std::atomic<uint64_t> lookups{ 0 };
+
+    enum class Path { Log, Log_Text, Log_Now };
+
+    struct Result
+    {
+        double mean_ns = 0;
+        double worst_burst_ns = 0;  // per call, in the slowest burst
+        uint64_t calls = 0;
+    };
+
+    Result run(Path path, int burst)
+    {
+        auto& log = Async_Log::instance();
+        const auto text = std::string("connection ") + std::to_string(9987) + " lost its voice server";
+        auto burst_ns = std::vector<std::vector<double>>(kThreads);
+
+        auto threads = std::vector<std::thread>();
+        for (auto t = 0; t < kThreads; ++t)
+        {
+            threads.emplace_back([&, t]()
+                {
+                    for (auto b = 0; b < kBursts; ++b)
+                    {
+                        const auto start = std::chrono::steady_clock::now();
+                        for (auto i = 0; i < burst; ++i)
+                        {
+                            const auto error = ERROR_undefined + (i % kCodes);
+                            const auto connection_id = uint64_t(t + 1);
+                            switch (path)
+                            {
+                            case Path::Log:
+                                log.log(error, "Failed to send the whisper list", connection_id);
+                                break;
+                            case Path::Log_Text:
+                                log.log_text(error, text, connection_id);
+                                break;
+                            case Path::Log_Now:
+                                log.log_now(error, "Failed to send the whisper list", connection_id);
+                                break;
+                            }
+                        }
+                        const auto ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+                        burst_ns[t].push_back(ns);
+                        std::this_thread::sleep_for(kRest);
+                    }
+                });
+        }
+        for (auto& thread : threads)
+            thread.join();
+
+        auto result = Result();
+        auto total_ns = 0.0;
+        for (const auto& bursts : burst_ns)
+        {
+            for (const auto ns : bursts)
+            {
+                total_ns += ns;
+                result.worst_burst_ns = std::max(result.worst_burst_ns, ns / burst);
+            }
+        }
+        result.calls = uint64_t(kThreads) * kBursts * burst;
+        result.mean_ns = total_ns / result.calls;
+        return result;
+    }
+
+    void print(const char* name, const Result& result)
+    {
+        std::printf("%-10s %8.1f ns/call %10.1f ns/call in the slowest burst (%llu calls)\n",
+            name, result.mean_ns, result.worst_burst_ns, (unsigned long long)result.calls);
+    }
+}
+
+/* The client lib functions Async_Log calls */
+extern "C"
+{
+    unsigned int ts3client_logMessage(const char* logMessage, enum LogLevel severity, const char* channel, uint64 logID)
+    {
+        written.fetch_add(1, std::memory_order_relaxed);
+        return ERROR_ok;
+    }
+
+    unsigned int ts3client_getErrorMessage(unsigned int errorCode, char** error)
+    {
+        lookups.fetch_add(1, std::memory_order_relaxed);
+        if ((*error = static_cast<char*>(std::malloc(32))) == nullptr)
+            return ERROR_out_of_memory;
+        std::snprintf(*error, 32, "error %u", errorCode);
+        return ERROR_ok;
+    }
+
+    unsigned int ts3client_freeMemory(void* pointer)
+    {
+        std::free(pointer);
+        return ERROR_ok;
+    }
+}
+
+int main()
+{
+    auto& log = Async_Log::instance();
+    auto failed = false;
+
+    log.start();
+    const auto queued = run(Path::Log, 64);
+    const auto queued_text = run(Path::Log_Text, 16);
+    log.stop();
+
+    const auto stats = log.stats();
+    if (written.load() != stats.queued || stats.queued + stats.dropped != queued.calls + queued_text.calls)
+    {
+        std::printf("FAIL: %llu of %llu records written, %llu dropped\n", (unsigned long long)written.load(),
+            (unsigned long long)(queued.calls + queued_text.calls), (unsigned long long)stats.dropped);
+        failed = true;
+    }
+    if (lookups.load() != kCodes)
+    {
+        std::printf("FAIL: %llu error text lookups for %u codes\n", (unsigned long long)lookups.load(), kCodes);
+        failed = true;
+    }
+
+    written = 0;
+    const auto now = run(Path::Log_Now, 64);
+    if (written.load() != now.calls)
+    {
+        std::printf("FAIL: %llu of %llu records written by log_now\n", (unsigned long long)written.load(), (unsigned long long)now.calls);
+        failed = true;
+    }
+
+    std::printf("%d threads, bursts of 64 (log_text 16), %llu records dropped\n", kThreads, (unsigned long long)stats.dropped);
+    print("log", queued);
+    print("log_text", queued_text);
+    print("log_now", now);
+    return failed ? 1 : 0;
+}
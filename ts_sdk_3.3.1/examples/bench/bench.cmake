@@ -0,0 +1,108 @@
+# Accuracy checks and benchmarks of the sample code, off by default.
+# Configure with -DTS_SAMPLES_BENCH=ON, and -DCMAKE_BUILD_TYPE=Release for meaningful numbers.
+# They only need the SDK headers, not its libraries.
+# Targets with checks are registered with ctest, all of them print their numbers when run.
+
+enable_testing()
+find_package(Threads REQUIRED)
+
+set(TS_BENCH_DIR "${CMAKE_CURRENT_LIST_DIR}")
+set(TS_BENCH_INCLUDE_DIR "${CMAKE_CURRENT_LIST_DIR}/../../include")
+
+function(ts_add_bench name)
+    add_executable(${name} ${ARGN})
+    target_include_directories(${name} PRIVATE "${TS_BENCH_INCLUDE_DIR}")
+    target_link_libraries(${name} "${CMAKE_THREAD_LIBS_INIT}")
+    if (UNIX AND NOT APPLE)
+        target_link_libraries(${name} m)
+    endif()
+    set_target_properties(${name}
+        PROPERTIES
+        CXX_STANDARD 17
+        RUNTIME_OUTPUT_DIRECTORY "${CMAKE_BINARY_DIR}/bench"
+    )
+endfunction()
+
+ts_add_bench(ts_bench_resampler
+    "${TS_BENCH_DIR}/resampler_bench.c"
+    "${TS_BENCH_DIR}/../common/pacer.h"
+    "${TS_BENCH_DIR}/../common/pacer.c"
+    "${TS_BENCH_DIR}/../common/resampler.h"
+    "${TS_BENCH_DIR}/../common/resampler.c"
+)
+add_test(NAME resampler COMMAND ts_bench_resampler)
+
+ts_add_bench(ts_bench_mixer
+    "${TS_BENCH_DIR}/mixer_bench.cpp"
+    "${TS_BENCH_DIR}/../client_cpp_repeater/mixer.hpp"
+    "${TS_BENCH_DIR}/../client_cpp_repeater/mixer.cpp"
+)
+add_test(NAME mixer COMMAND ts_bench_mixer)
+
+ts_add_bench(ts_bench_reconnect
+    "${TS_BENCH_DIR}/reconnect_bench.cpp"
+    "${TS_BENCH_DIR}/../client_cpp_repeater/reconnect_scheduler.hpp"
+    "${TS_BENCH_DIR}/../client_cpp_repeater/reconnect_scheduler.cpp"
+    "${TS_BENCH_DIR}/../client_cpp_repeater/timer_wheel.hpp"
+    "${TS_BENCH_DIR}/../client_cpp_repeater/timer_wheel.cpp"
+    "${TS_BENCH_DIR}/../common/pacer.h"
+    "${TS_BENCH_DIR}/../common/pacer.c"
+)
+add_test(NAME reconnect COMMAND ts_bench_reconnect)
+
+ts_add_bench(ts_bench_whisper_join
+    "${TS_BENCH_DIR}/whisper_join_bench.cpp"
+    "${TS_BENCH_DIR}/../client_cpp_whisperer/whisper_targets.hpp"
+    "${TS_BENCH_DIR}/../client_cpp_whisperer/whisper_targets.cpp"
+)
+add_test(NAME whisper_join COMMAND ts_bench_whisper_join)
+
+ts_add_bench(ts_bench_whisper_plan
+    "${TS_BENCH_DIR}/whisper_plan_bench.cpp"
+    "${TS_BENCH_DIR}/../client_cpp_whisperer/whisper_planner.hpp"
+    "${TS_BENCH_DIR}/../client_cpp_whisperer/whisper_planner.cpp"
+    "${TS_BENCH_DIR}/../client_cpp_whisperer/whisper_targets.hpp"
+    "${TS_BENCH_DIR}/../client_cpp_whisperer/whisper_targets.cpp"
+)
+add_test(NAME whisper_plan COMMAND ts_bench_whisper_plan)
+
+ts_add_bench(ts_bench_downmix
+    "${TS_BENCH_DIR}/downmix_bench.c"
+    "${TS_BENCH_DIR}/../common/downmix.h"
+    "${TS_BENCH_DIR}/../common/downmix.c"
+    "${TS_BENCH_DIR}/../common/pacer.h"
+    "${TS_BENCH_DIR}/../common/pacer.c"
+)
+add_test(NAME downmix COMMAND ts_bench_downmix)
+
+ts_add_bench(ts_bench_async_log
+    "${TS_BENCH_DIR}/async_log_bench.cpp"
+    "${TS_BENCH_DIR}/../client_cpp_repeater/async_log.hpp"
+    "${TS_BENCH_DIR}/../client_cpp_repeater/async_log.cpp"
+    "${TS_BENCH_DIR}/../client_cpp_repeater/mpsc_queue.hpp"
+    "${TS_BENCH_DIR}/../common/pacer.h"
+    "${TS_BENCH_DIR}/../common/pacer.c"
+)
+add_test(NAME async_log COMMAND ts_bench_async_log)
+
+ts_add_bench(ts_bench_silence_gate
+    "${TS_BENCH_DIR}/silence_gate_bench.c"
+    "${TS_BENCH_DIR}/../client_customdevice/wave.h"
+    "${TS_BENCH_DIR}/../client_customdevice/wave.c"
+    "${TS_BENCH_DIR}/../common/pacer.h"
+    "${TS_BENCH_DIR}/../common/pacer.c"
+    "${TS_BENCH_DIR}/../common/silence_gate.h"
+    "${TS_BENCH_DIR}/../common/silence_gate.c"
+)
+add_test(NAME silence_gate COMMAND ts_bench_silence_gate "${TS_BENCH_DIR}/../client_customdevice/welcome_to_teamspeak.wav")
+
+ts_add_bench(ts_bench_recorder
+    "${TS_BENCH_DIR}/recorder_bench.c"
+    "${TS_BENCH_DIR}/../client/recorder.h"
+    "${TS_BENCH_DIR}/../client/recorder.c"
+    "${TS_BENCH_DIR}/../common/downmix.h"
+    "${TS_BENCH_DIR}/../common/downmix.c"
+    "${TS_BENCH_DIR}/../common/pacer.h"
+    "${TS_BENCH_DIR}/../common/pacer.c"
+)
+add_test(NAME recorder COMMAND ts_bench_recorder)
@@ -0,0 +1,216 @@
+/*
+ * Accuracy checks and throughput of common/downmix.c.
+ *
+ * Every kernel the CPU can run is checked against a reference computed from the coefficients, for
+ * 1 to 8 channels, random fill masks and frame counts, in place and for writes past the output.
+ * Then the kernels and the recorder's old downmix loop are timed on 480 frame blocks. Exits with
+ * 1 if a check fails.
+ */
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <teamspeak/public_definitions.h>
+
+#include "../common/downmix.h"
+#include "../common/pacer.h"
+
+#define LEFT_SPEAKERS  (SPEAKER_FRONT_LEFT  | SPEAKER_FRONT_CENTER | SPEAKER_BACK_LEFT  | SPEAKER_FRONT_LEFT_OF_CENTER  | SPEAKER_BACK_CENTER | SPEAKER_SIDE_LEFT  | SPEAKER_TOP_CENTER | SPEAKER_TOP_FRONT_LEFT  | SPEAKER_TOP_FRONT_CENTER | SPEAKER_TOP_BACK_LEFT  | SPEAKER_TOP_BACK_CENTER)
+#define RIGHT_SPEAKERS (SPEAKER_FRONT_RIGHT | SPEAKER_FRONT_CENTER | SPEAKER_BACK_RIGHT | SPEAKER_FRONT_RIGHT_OF_CENTER | SPEAKER_BACK_CENTER | SPEAKER_SIDE_RIGHT | SPEAKER_TOP_CENTER | SPEAKER_TOP_FRONT_RIGHT | SPEAKER_TOP_FRONT_CENTER | SPEAKER_TOP_BACK_RIGHT | SPEAKER_TOP_BACK_CENTER)
+
+#define MAX_FRAMES 4096
+#define BLOCK_FRAMES 480
+#define BENCH_BLOCKS 20000
+#define GUARD 0x5555
+
+/* the usual layout of each channel count */
+static const unsigned int layouts[9][8] = {
+    { 0 },
+    { SPEAKER_FRONT_CENTER },
+    { SPEAKER_FRONT_LEFT, SPEAKER_FRONT_RIGHT },
+    { SPEAKER_FRONT_LEFT, SPEAKER_FRONT_RIGHT, SPEAKER_FRONT_CENTER },
+    { SPEAKER_FRONT_LEFT, SPEAKER_FRONT_RIGHT, SPEAKER_BACK_LEFT, SPEAKER_BACK_RIGHT },
+    { SPEAKER_FRONT_LEFT, SPEAKER_FRONT_RIGHT, SPEAKER_FRONT_CENTER, SPEAKER_BACK_LEFT, SPEAKER_BACK_RIGHT },
+    { SPEAKER_FRONT_LEFT, SPEAKER_FRONT_RIGHT, SPEAKER_FRONT_CENTER, SPEAKER_LOW_FREQUENCY, SPEAKER_BACK_LEFT, SPEAKER_BACK_RIGHT },
+    { SPEAKER_FRONT_LEFT, SPEAKER_FRONT_RIGHT, SPEAKER_FRONT_CENTER, SPEAKER_LOW_FREQUENCY, SPEAKER_BACK_LEFT, SPEAKER_BACK_RIGHT, SPEAKER_BACK_CENTER },
+    { SPEAKER_FRONT_LEFT, SPEAKER_FRONT_RIGHT, SPEAKER_FRONT_CENTER, SPEAKER_LOW_FREQUENCY, SPEAKER_BACK_LEFT, SPEAKER_BACK_RIGHT, SPEAKER_SIDE_LEFT, SPEAKER_SIDE_RIGHT },
+};
+
+static short in[MAX_FRAMES * 8];
+static short inPlace[MAX_FRAMES * 8];
+static short expected[MAX_FRAMES * 2];
+static short out[MAX_FRAMES * 2 + 16];
+
+/* The recorder's loop before the downmix module: picks the channels per call, divides per frame */
+static void oldDownmix(const short* samples, int frames, int channels, const unsigned int* speakers, unsigned int fillMask, short* result) {
+    int left[8], right[8];
+    int leftCount = 0, rightCount = 0;
+    int frame, i, sum;
+
+    for (i = 0; i < channels; ++i) {
+        if ((fillMask & (1u << i)) == 0)
+            continue;
+        if ((speakers[i] & LEFT_SPEAKERS) != 0)
+            left[leftCount++] = i;
+        if ((speakers[i] & RIGHT_SPEAKERS) != 0)
+            right[rightCount++] = i;
+    }
+    for (frame = 0; frame < frames; ++frame, samples += channels, result += 2) {
+        sum = 0;
+        for (i = 0; i < leftCount; ++i)
+            sum += samples[left[i]];
+        if (leftCount > 1)
+            sum /= leftCount;
+        result[0] = (short)(sum > SHRT_MAX ? SHRT_MAX : sum < SHRT_MIN ? SHRT_MIN : sum);
+
+        sum = 0;
+        for (i = 0; i < rightCount; ++i)
+            sum += samples[right[i]];
+        if (rightCount > 1)
+            sum /= rightCount;
+        result[1] = (short)(sum > SHRT_MAX ? SHRT_MAX : sum < SHRT_MIN ? SHRT_MIN : sum);
+    }
+}
+
+/* independent of the kernels: sum, round and saturate every output sample on its own */
+static void reference(const struct Downmix* downmix, int frames, short* result) {
+    int frame, channel, i;
+
+    for (frame = 0; frame < frames; ++frame) {
+        for (channel = 0; channel < downmix->outChannels; ++channel) {
+            long sum = 0;
+            for (i = 0; i < downmix->channels; ++i)
+                sum += (long)downmix->coefficients[channel][i] * in[frame * downmix->channels + i];
+            sum = (sum + (1 << (DOWNMIX_COEFFICIENT_BITS - 1))) >> DOWNMIX_COEFFICIENT_BITS;
+            result[frame * downmix->outChannels + channel] = (short)(sum > SHRT_MAX ? SHRT_MAX : sum < SHRT_MIN ? SHRT_MIN : sum);
+        }
+    }
+}
+
+static int checkKernels(void) {
+    struct Downmix downmix;
+    DownmixKernel kernels[DOWNMIX_MAX_KERNELS];
+    int failures = 0;
+    int outChannels, channels, round, count, k, i, frames;
+    unsigned int fillMask;
+
+    for (outChannels = 1; outChannels <= 2; ++outChannels) {
+        for (channels = 1; channels <= 8; ++channels) {
+            for (round = 0; round < 200; ++round) {
+                fillMask = rand() % 4 == 0 ? (unsigned int)rand() : (1u << channels) - 1;
+                if (channels >= 6 && round % 2)
+                    fillMask &= ~8u; /* no LFE data */
+                frames = rand() % 300;
+
+                downmixInit(&downmix, outChannels);
+                downmixConfigure(&downmix, channels, layouts[channels], fillMask);
+                reference(&downmix, frames, expected);
+                count = downmixKernels(&downmix, kernels);
+                for (k = 0; k < count; ++k) {
+                    downmix.kernel = kernels[k];
+                    for (i = 0; i < frames * outChannels + 16; ++i)
+                        out[i] = GUARD;
+                    downmixProcess(&downmix, in, frames, out);
+                    if (memcmp(out, expected, sizeof(short) * frames * outChannels) != 0 || out[frames * outChannels] != GUARD) {
+                        if (++failures <= 5)
+                            printf("FAILED: %s kernel, %d to %d channels, mask %#x, %d frames\n", downmixKernelName(&downmix), channels, outChannels, fillMask, frames);
+                    }
+                    if (outChannels <= channels) {
+                        memcpy(inPlace, in, sizeof(short) * frames * channels);
+                        downmixProcess(&downmix, inPlace, frames, inPlace);
+                        if (memcmp(inPlace, expected, sizeof(short) * frames * outChannels) != 0 && ++failures <= 5)
+                            printf("FAILED: %s kernel in place, %d to %d channels, %d frames\n", downmixKernelName(&downmix), channels, outChannels, frames);
+                    }
+                }
+            }
+        }
+    }
+    return failures;
+}
+
+/* difference to the old loop, which truncated where the new one rounds */
+static void compareOld(void) {
+    struct Downmix downmix;
+    int channels, i, maxDiff;
+
+    for (channels = 2; channels <= 8; channels += 2) {
+        downmixInit(&downmix, 2);
+        downmixConfigure(&downmix, channels, layouts[channels], (1u << channels) - 1);
+        downmixProcess(&downmix, in, MAX_FRAMES, out);
+        oldDownmix(in, MAX_FRAMES, channels, layouts[channels], (1u << channels) - 1, expected);
+        maxDiff = 0;
+        for (i = 0; i < MAX_FRAMES * 2; ++i) {
+            if (abs(out[i] - expected[i]) > maxDiff)
+                maxDiff = abs(out[i] - expected[i]);
+        }
+        printf("%d channels to stereo: at most %d LSB off the old loop\n", channels, maxDiff);
+    }
+}
+
+/* called through this, so the compiler can't fold the constant layouts of bench() into the old loop, the recorder got them at run time */
+static void (*volatile oldLoop)(const short*, int, int, const unsigned int*, unsigned int, short*) = oldDownmix;
+
+static void printRate(const char* name, uint64_t ns) {
+    printf("  %s %.0f", name, (double)BENCH_BLOCKS * BLOCK_FRAMES * 1000.0 / (double)ns);
+}
+
+static void bench(int channels, int outChannels, const char* name) {
+    struct Downmix downmix;
+    DownmixKernel kernels[DOWNMIX_MAX_KERNELS];
+    unsigned int fillMask = (1u << channels) - 1;
+    uint64_t start;
+    int count, k, i;
+
+    if (channels >= 6)
+        fillMask &= ~8u;
+    downmixInit(&downmix, outChannels);
+    downmixConfigure(&downmix, channels, layouts[channels], fillMask);
+    printf("%-15s", name);
+    if (outChannels == 2) {
+        start = pacerNowNs();
+        for (i = 0; i < BENCH_BLOCKS; ++i)
+            oldLoop(in + (i & 7), BLOCK_FRAMES, channels, layouts[channels], fillMask, out);
+        printRate("old", pacerNowNs() - start);
+    }
+    count = downmixKernels(&downmix, kernels);
+    for (k = 0; k < count; ++k) {
+        downmix.kernel = kernels[k];
+        start = pacerNowNs();
+        for (i = 0; i < BENCH_BLOCKS; ++i)
+            downmixProcess(&downmix, in + (i & 7), BLOCK_FRAMES, out);
+        printRate(downmixKernelName(&downmix), pacerNowNs() - start);
+    }
+    printf("\n");
+}
+
+int main(void) {
+    struct Downmix downmix;
+    uint64_t start;
+    int failures, i;
+
+    srand(1);
+    /* full scale samples to hit the saturation, small ones for the rounding */
+    for (i = 0; i < MAX_FRAMES * 8; ++i)
+        in[i] = rand() & 1 ? (short)(rand() % 65536 - 32768) : (short)(rand() % 2000 - 1000);
+
+    failures = checkKernels();
+    compareOld();
+
+    printf("\nMframes/s in %d frame blocks:\n", BLOCK_FRAMES);
+    bench(4, 2, "quad to stereo");
+    bench(6, 2, "5.1 to stereo");
+    bench(8, 2, "7.1 to stereo");
+    bench(8, 1, "7.1 to mono");
+
+    downmixInit(&downmix, 2);
+    start = pacerNowNs();
+    for (i = 0; i < 1000000; ++i)
+        downmixConfigure(&downmix, 8, layouts[8], 0xf7);
+    printf("downmixConfigure with an unchanged layout: %.1f ns\n", (double)(pacerNowNs() - start) / 1e6);
+
+    if (failures > 0)
+        printf("%d checks failed\n", failures);
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,77 @@
+/*
+ * Throughput of the repeater's saturating mixer, client_cpp_repeater/mixer.cpp.
+ *
+ * Mixes 2 to 32 random 960 sample frames, one 20 ms period at 48 kHz, with every kernel the CPU
+ * can run and checks each kernel's output against the scalar one. Exits with 1 if they differ.
+ */
+
+#include "../client_cpp_repeater/mixer.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace com::teamspeak;
+
+namespace
+{
+    constexpr auto kFrameSamples = size_t{ 960 };
+    constexpr auto kMaxInputs = size_t{ 32 };
+    constexpr auto kRounds = 20000;
+
+    void mix_all(const Mix_Kernel& kernel, int16_t* dst, const std::vector<std::vector<int16_t>>& inputs, size_t count)
+    {
+        std::memset(dst, 0, kFrameSamples * sizeof(int16_t));
+        for (auto i = size_t{ 0 }; i < count; ++i)
+            kernel.mix(dst, inputs[i].data(), kFrameSamples);
+    }
+}
+
+int main()
+{
+    auto random = std::mt19937(20);
+    auto sample = std::uniform_int_distribution<int>(INT16_MIN, INT16_MAX);
+    auto inputs = std::vector<std::vector<int16_t>>(kMaxInputs, std::vector<int16_t>(kFrameSamples));
+    for (auto& input : inputs)
+        for (auto& s : input)
+            s = static_cast<int16_t>(sample(random));
+
+    const auto kernels = mix_kernels();
+    auto expected = std::vector<int16_t>(kFrameSamples);
+    auto out = std::vector<int16_t>(kFrameSamples);
+    auto failed = false;
+
+    // full scale noise saturates a lot, a good test of the edge cases
+    mix_all(kernels.front(), expected.data(), inputs, kMaxInputs);
+    for (auto&& kernel : kernels)
+    {
+        mix_all(kernel, out.data(), inputs, kMaxInputs);
+        if (out != expected)
+        {
+            std::printf("FAILED: %s output differs from scalar over %zu inputs\n", kernel.name, kMaxInputs);
+            failed = true;
+        }
+    }
+
+    std::printf("mix_saturating picks %s, ns per %zu sample frame:\n", mix_kernel_name(), kFrameSamples);
+    std::printf("  inputs");
+    for (auto&& kernel : kernels)
+        std::printf(" %9s", kernel.name);
+    std::printf("\n");
+    for (auto count : { size_t{ 2 }, size_t{ 8 }, size_t{ 32 } })
+    {
+        std::printf("  %6zu", count);
+        for (auto&& kernel : kernels)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (auto round = 0; round < kRounds; ++round)
+                mix_all(kernel, out.data(), inputs, count);
+            const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            std::printf(" %9.0f", elapsed / kRounds);
+        }
+        std::printf("\n");
+    }
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,116 @@
+/*
+ * Reconnect storm simulation of the repeater's Reconnect_Scheduler and a check of its Timer_Wheel.
+ *
+ * 1000 handlers lose their server at once, it is back after 30 s and every handshake takes 300 ms.
+ * The scheduler's advance() is driven in virtual time, one 10 ms tick at a time, and the bench
+ * reports when the last handler is back, the attempts it took and the peak connect rate. The wheel
+ * check fires 200k random timers of up to 100k ticks and exits with 1 if one fires off its tick.
+ */
+
+#include "../client_cpp_repeater/reconnect_scheduler.hpp"
+#include "../client_cpp_repeater/timer_wheel.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <vector>
+
+using namespace com::teamspeak;
+
+namespace
+{
+    constexpr auto kHandlers = uint64_t{ 1000 };
+    constexpr auto kDownTicks = uint64_t{ 3000 };     // the server is gone for 30 s
+    constexpr auto kHandshakeTicks = uint64_t{ 30 };  // 300 ms until a connect succeeds or fails
+
+    void simulate_storm()
+    {
+        auto now = uint64_t{ 0 };
+        auto handshakes = std::multimap<uint64_t, uint64_t>();  // end tick, connection
+        auto connects_per_second = std::map<uint64_t, int>();
+        auto scheduler = Reconnect_Scheduler(Reconnect_Scheduler::Options(), [&](uint64_t connection_id)
+            {
+                handshakes.emplace(now + kHandshakeTicks, connection_id);
+                ++connects_per_second[now / 100];
+                return 0u;
+            });
+
+        for (auto id = uint64_t{ 1 }; id <= kHandlers; ++id)
+            scheduler.disconnected(id);
+
+        auto established = uint64_t{ 0 };
+        auto last_established = uint64_t{ 0 };
+        const auto start = std::chrono::steady_clock::now();
+        while (established < kHandlers && now < 100000)
+        {
+            ++now;
+            while (!handshakes.empty() && handshakes.begin()->first <= now)
+            {
+                const auto connection_id = handshakes.begin()->second;
+                handshakes.erase(handshakes.begin());
+                if (now < kDownTicks)
+                {
+                    scheduler.disconnected(connection_id);
+                }
+                else
+                {
+                    scheduler.established(connection_id);
+                    ++established;
+                    last_established = now;
+                }
+            }
+            scheduler.advance(1);
+        }
+        const auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+        auto peak = 0;
+        for (auto&& [second, connects] : connects_per_second)
+            peak = std::max(peak, connects);
+        const auto stats = scheduler.stats();
+        std::printf("%llu handlers, server back after %.0f s, %.0f ms handshakes:\n",
+            static_cast<unsigned long long>(kHandlers), kDownTicks / 100.0, kHandshakeTicks * 10.0);
+        std::printf("  all back after %.2f s, %.2f attempts per handler (immediate reconnects: %llu), %llu deferred by the cap\n",
+            last_established / 100.0, static_cast<double>(stats.attempts) / kHandlers,
+            static_cast<unsigned long long>(kDownTicks / kHandshakeTicks), static_cast<unsigned long long>(stats.deferred));
+        std::printf("  at most %d connects per second, %.2f us per tick\n", peak, elapsed / now);
+    }
+
+    bool check_wheel()
+    {
+        auto wheel = Timer_Wheel();
+        auto random = std::mt19937_64(1);
+        auto due = std::vector<uint64_t>(200000);
+        auto wrong = 0;
+        const auto expired = [&](uint64_t id)
+            {
+                if (due[id] != wheel.now())
+                    ++wrong;
+            };
+
+        for (auto id = uint64_t{ 0 }; id < due.size(); ++id)
+        {
+            // interleave the adds with runs of ticks, so timers land at every offset of every level
+            if (id % 2)
+            {
+                for (auto ticks = random() % 50; ticks > 0; --ticks)
+                    wheel.tick(expired);
+            }
+            const auto delay = 1 + random() % 100000;
+            due[id] = wheel.now() + delay;
+            wheel.add(delay, id);
+        }
+        while (wheel.size() > 0)
+            wheel.tick(expired);
+
+        std::printf("timer wheel: %zu timers, %d fired off their tick\n", due.size(), wrong);
+        return wrong == 0;
+    }
+}
+
+int main()
+{
+    simulate_storm();
+    return check_wheel() ? 0 : 1;
+}
@@ -0,0 +1,303 @@
+/*
+ * The client sample's recording callback before and after the recorder module.
+ *
+ * The old onEditMixedPlaybackVoiceDataEvent, which allocated, downmixed and wrote to the file on
+ * the playback thread, and recorderWrite are driven with the same 480 frame blocks every 10 ms,
+ * as the client lib calls the callback, for a stereo and a 5.1 layout with all channels filled.
+ * Every call is timed from the outside and the bench prints the time per callback of both as
+ * histograms side by side. Exits with 1 if the two recordings differ in length or a sample of
+ * them by more than 1, or the recorder dropped frames.
+ */
+
+#ifdef _WIN32
+#define _CRT_SECURE_NO_WARNINGS
+#pragma warning(disable : 4996)
+#endif
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <teamspeak/public_definitions.h>
+
+#include "../client/recorder.h"
+#include "../common/pacer.h"
+
+#define OLD_FILE "recorder_bench_old.wav"
+#define NEW_FILE "recorder_bench_new.wav"
+#define CALLBACKS 250
+#define FRAMES 480
+#define MAX_CHANNELS 6
+
+struct OldWaveHeader {
+    /* Riff chunk */
+    char riffId[4];
+    unsigned int len;
+    char riffType[4];
+
+    /* Format chunk */
+    char fmtId[4];  // 'fmt '
+    unsigned int fmtLen;
+    unsigned short formatTag;
+    unsigned short channels;
+    unsigned int samplesPerSec;
+    unsigned int avgBytesPerSec;
+    unsigned short blockAlign;
+    unsigned short bitsPerSample;
+
+    /* Data chunk */
+    char dataId[4];  // 'data'
+    unsigned int dataLen;
+};
+
+/* The sample's recording before the recorder module, as it was */
+static int recordSound = 0;
+
+static void oldCallback(uint64 serverConnectionHandlerID, short* samples, int sampleCount, int channels, const unsigned int* channelSpeakerArray, unsigned int* channelFillMask){
+    #define OUTPUTCHANNELS 2
+    static FILE *pfile = NULL;
+    static struct OldWaveHeader header = { {'R','I','F','F'}, 0, {'W','A','V','E'}, {'f','m','t',' '}, 16, 1, 2, 48000, 48000*(16/2)*2, (16/2)*2, 16, {'d','a','t','a'}, 0 };
+
+    int currentSampleMix[OUTPUTCHANNELS]; /*a per channel/sample mix buffer*/
+    int channelCount[OUTPUTCHANNELS] = {0,0}; /*how many input channels does the output channel contain */
+    
+    int currentInChannel;
+    int currentOutChannel;
+    int currentSample;
+
+    /*for clipping*/
+    short shortval;
+    int   intval;
+
+    short* outputBuffer;
+
+    int leftChannelMask  = SPEAKER_FRONT_LEFT  | SPEAKER_FRONT_CENTER | SPEAKER_BACK_LEFT  | SPEAKER_FRONT_LEFT_OF_CENTER  | SPEAKER_BACK_CENTER | SPEAKER_SIDE_LEFT  | SPEAKER_TOP_CENTER | SPEAKER_TOP_FRONT_LEFT  | SPEAKER_TOP_FRONT_CENTER | SPEAKER_TOP_BACK_LEFT  | SPEAKER_TOP_BACK_CENTER;
+    int rightChannelMask = SPEAKER_FRONT_RIGHT | SPEAKER_FRONT_CENTER | SPEAKER_BACK_RIGHT | SPEAKER_FRONT_RIGHT_OF_CENTER | SPEAKER_BACK_CENTER | SPEAKER_SIDE_RIGHT | SPEAKER_TOP_CENTER | SPEAKER_TOP_FRONT_RIGHT | SPEAKER_TOP_FRONT_CENTER | SPEAKER_TOP_BACK_RIGHT | SPEAKER_TOP_BACK_CENTER;
+    
+    /*detect state changes*/
+    if (recordSound && (pfile == NULL)){
+        /*start recording*/
+        header.len = 0;
+        header.dataLen = 0;
+        if((pfile = fopen(OLD_FILE, "wb")) == NULL) return;
+        fwrite(&header, sizeof(struct OldWaveHeader), 1, pfile);
+    } else if (!recordSound && (pfile != NULL)){
+        /*stop recording*/
+        header.len = sizeof(struct OldWaveHeader)+header.dataLen - 8;
+        fseek (pfile, 0, SEEK_SET);
+        fwrite(&header, sizeof(struct OldWaveHeader), 1, pfile);
+        fclose(pfile);
+        pfile = NULL;
+    }
+
+    /*if there is nothing to do, quit*/
+    if (pfile == NULL || sampleCount == 0 || channels == 0) return;
+
+    /* initialize channel mixing */
+    currentInChannel = 0;
+    /*loop over all possible speakers*/
+    for (currentInChannel=0; currentInChannel < channels; ++currentInChannel) {
+        /*if the speaker has actual data*/
+        if ((*channelFillMask & (1<<currentInChannel)) != 0){
+            /*add to the outChannelSpeakerSet*/
+            if ((channelSpeakerArray[currentInChannel] & leftChannelMask) != 0) channelCount[0]++;
+            if ((channelSpeakerArray[currentInChannel] & rightChannelMask) != 0) channelCount[1]++;
+        }
+    }
+
+    /*get the outbut buffer*/
+    outputBuffer = (short*) malloc( sizeof(short)*sampleCount*2 /*output channels*/);
+
+    /* hint: if channelCount is 0 for all channels, we could write a zero buffer and quit here */
+
+    /*mix the samples*/
+    for (currentSample = 0; currentSample < sampleCount; currentSample++){
+        currentSampleMix[0] = currentSampleMix[1] = 0;
+        
+        /*loop over all channels in this frame */
+        for(currentInChannel =0; currentInChannel < channels; currentInChannel++){
+            if ((channelSpeakerArray[currentInChannel] & leftChannelMask)  != 0) currentSampleMix[0] += samples[ (currentSample*channels)+currentInChannel ];
+            if ((channelSpeakerArray[currentInChannel] & rightChannelMask) != 0) currentSampleMix[1] += samples[ (currentSample*channels)+currentInChannel ];
+        }
+        
+        /*collected all samples, store mixed sample */
+        for (currentOutChannel = 0; currentOutChannel < OUTPUTCHANNELS; currentOutChannel++){
+            if (channelCount[currentOutChannel] == 0){
+                outputBuffer[ (currentSample*OUTPUTCHANNELS) + currentOutChannel] = 0;
+            } else {
+                /*clip*/
+                intval = currentSampleMix[currentOutChannel]/channelCount[currentOutChannel];
+                if (intval >= SHRT_MAX) shortval = SHRT_MAX;
+                else if (intval <= SHRT_MIN) shortval = SHRT_MIN;
+                else shortval = (short) intval;
+                /*store*/
+                outputBuffer[ (currentSample*OUTPUTCHANNELS) + currentOutChannel] = shortval;
+            }
+        }
+    }
+
+    /*write data & update header */
+    fwrite(outputBuffer, sampleCount*sizeof(short)*OUTPUTCHANNELS, 1, pfile);
+    header.dataLen += sampleCount*sizeof(short)*OUTPUTCHANNELS;
+
+    /*free buffer*/
+    free(outputBuffer);
+}
+
+
+struct Layout {
+    const char* name;
+    int channels;
+    unsigned int speakers[MAX_CHANNELS];
+};
+
+static const struct Layout layouts[] = {
+    { "stereo", 2, { SPEAKER_FRONT_LEFT, SPEAKER_FRONT_RIGHT } },
+    { "5.1", 6, { SPEAKER_FRONT_LEFT, SPEAKER_FRONT_RIGHT, SPEAKER_FRONT_CENTER, SPEAKER_LOW_FREQUENCY, SPEAKER_BACK_LEFT, SPEAKER_BACK_RIGHT } },
+};
+
+struct Timing {
+    uint64_t totalNs;
+    uint64_t maxNs;
+    unsigned int histogram[RECORDER_HISTOGRAM_BUCKETS];
+};
+
+/* Same buckets as the recorder's own histogram */
+static void addTiming(struct Timing* timing, uint64_t ns) {
+    uint64_t us = ns / 1000u;
+    int bucket = 0;
+
+    while (bucket < RECORDER_HISTOGRAM_BUCKETS - 1 && us >= ((uint64_t)1 << bucket))
+        ++bucket;
+    ++timing->histogram[bucket];
+    timing->totalNs += ns;
+    if (ns > timing->maxNs)
+        timing->maxNs = ns;
+}
+
+static void printTimings(const char* name, const struct Timing* old, const struct Timing* new) {
+    int i;
+
+    printf("%s, %d callbacks of %d frames:\n", name, CALLBACKS, FRAMES);
+    printf("                   old callback  recorderWrite\n");
+    printf("    average us  %14.1f %14.1f\n", (double)old->totalNs / CALLBACKS / 1000.0, (double)new->totalNs / CALLBACKS / 1000.0);
+    printf("    worst us    %14.1f %14.1f\n", (double)old->maxNs / 1000.0, (double)new->maxNs / 1000.0);
+    for (i = 0; i < RECORDER_HISTOGRAM_BUCKETS; ++i) {
+        if (old->histogram[i] == 0 && new->histogram[i] == 0)
+            continue;
+        if (i == RECORDER_HISTOGRAM_BUCKETS - 1)
+            printf("    >= %6u us %14u %14u\n", 1u << (i - 1), old->histogram[i], new->histogram[i]);
+        else
+            printf("    <  %6u us %14u %14u\n", 1u << i, old->histogram[i], new->histogram[i]);
+    }
+}
+
+/* Reads the audio of a recording, returns the number of samples or -1 */
+static long readRecording(const char* filename, short** data) {
+    FILE* f = fopen(filename, "rb");
+    long bytes;
+
+    *data = NULL;
+    if (f == NULL)
+        return -1;
+    fseek(f, 0, SEEK_END);
+    bytes = ftell(f) - (long)sizeof(struct OldWaveHeader);
+    if (bytes < 0 || (*data = (short*)malloc(bytes > 0 ? (size_t)bytes : 1)) == NULL) {
+        fclose(f);
+        return -1;
+    }
+    fseek(f, sizeof(struct OldWaveHeader), SEEK_SET);
+    if (bytes > 0 && fread(*data, (size_t)bytes, 1, f) != 1)
+        bytes = -1;
+    fclose(f);
+    return bytes < 0 ? -1 : bytes / (long)sizeof(short);
+}
+
+/* Returns 1 if both recordings have the same length and differ by at most 1 per sample */
+static int compareRecordings(const char* name) {
+    short* old;
+    short* new;
+    long oldSamples = readRecording(OLD_FILE, &old);
+    long newSamples = readRecording(NEW_FILE, &new);
+    int maxDifference = 0;
+    long i;
+    int ok;
+
+    for (i = 0; i < oldSamples && i < newSamples; ++i) {
+        int difference = abs(old[i] - new[i]);
+        if (difference > maxDifference)
+            maxDifference = difference;
+    }
+    ok = oldSamples == (long)CALLBACKS * FRAMES * RECORDER_CHANNELS && newSamples == oldSamples && maxDifference <= 1;
+    if (!ok)
+        printf("FAIL: %s recorded %ld and %ld samples, expected %ld, off by up to %d\n", name, oldSamples, newSamples, (long)CALLBACKS * FRAMES * RECORDER_CHANNELS, maxDifference);
+    free(old);
+    free(new);
+    return ok;
+}
+
+static int run(const struct Layout* layout, struct Recorder* recorder) {
+    static short samples[FRAMES * MAX_CHANNELS];
+    struct Timing old, new;
+    struct Pacer pacer;
+    unsigned int fillMask = (1u << layout->channels) - 1;
+    uint64_t start;
+    int i, ok;
+
+    memset(&old, 0, sizeof(old));
+    memset(&new, 0, sizeof(new));
+    srand(1);
+    for (i = 0; i < FRAMES * layout->channels; ++i)
+        samples[i] = (short)(rand() % 40000 - 20000);
+
+    /* the old callback opens the file on its first call after recordSound is set */
+    recordSound = 1;
+    pacerInit(&pacer, 10);
+    for (i = 0; i < CALLBACKS; ++i) {
+        pacerWait(&pacer);
+        start = pacerNowNs();
+        oldCallback(1, samples, FRAMES, layout->channels, layout->speakers, &fillMask);
+        addTiming(&old, pacerNowNs() - start);
+    }
+    /* and closes it on the first call after it is cleared */
+    recordSound = 0;
+    oldCallback(1, NULL, 0, 0, NULL, NULL);
+
+    if (!recorderStart(recorder, NEW_FILE)) {
+        printf("FAIL: could not start recording to %s\n", NEW_FILE);
+        return 0;
+    }
+    pacerInit(&pacer, 10);
+    for (i = 0; i < CALLBACKS; ++i) {
+        pacerWait(&pacer);
+        start = pacerNowNs();
+        recorderWrite(recorder, samples, FRAMES, layout->channels, layout->speakers, fillMask);
+        addTiming(&new, pacerNowNs() - start);
+    }
+    recorderStop(recorder);
+
+    printTimings(layout->name, &old, &new);
+    ok = compareRecordings(layout->name);
+    if (recorder->droppedFrames != 0) {
+        printf("FAIL: the recorder dropped %llu frames\n", (unsigned long long)recorder->droppedFrames);
+        ok = 0;
+    }
+    return ok;
+}
+
+int main(void) {
+    struct Recorder recorder;
+    size_t i;
+    int ok = 1;
+
+    if (!recorderInit(&recorder))
+        return 1;
+    for (i = 0; i < sizeof(layouts) / sizeof(layouts[0]); ++i)
+        ok &= run(&layouts[i], &recorder);
+    recorderFree(&recorder);
+
+    remove(OLD_FILE);
+    remove(NEW_FILE);
+    return ok ? 0 : 1;
+}
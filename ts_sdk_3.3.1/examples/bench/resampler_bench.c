@@ -0,0 +1,248 @@
+/*
+ * Accuracy checks and throughput of common/resampler.c.
+ *
+ * Converts sines between the rates the samples meet and measures the SNR against a sine fitted
+ * to the output, checks that converting in odd sized blocks or into a small output buffer gives
+ * the same samples as one call and that resamplerFlush brings the output up to the length of the
+ * input, and times 20 ms blocks. Exits with 1 if a check fails.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../common/pacer.h"
+#include "../common/resampler.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define SECONDS 2
+#define MIN_SNR_DB 85.0
+#define BENCH_BLOCKS 5000
+
+static int failures = 0;
+
+static void check(int ok, const char* what) {
+    if (!ok) {
+        printf("FAILED: %s\n", what);
+        ++failures;
+    }
+}
+
+/* frames of a sine at -6 dBFS, the same signal on every channel */
+static short* makeSine(int rate, int channels, double frequency, int frames) {
+    short* samples = (short*)malloc(sizeof(short) * frames * channels);
+    int i, ch;
+
+    if (!samples)
+        exit(1);
+    for (i = 0; i < frames; ++i) {
+        short v = (short)lrint(16384.0 * sin(2.0 * M_PI * frequency * i / rate));
+        for (ch = 0; ch < channels; ++ch)
+            samples[i * channels + ch] = v;
+    }
+    return samples;
+}
+
+/* converts all frames in blocks of blockFrames into an output of outCapacity frames per call, returns the output frames */
+static int convert(struct Resampler* r, const short* in, int inChannels, int frames, int blockFrames, short* out, int outChannels, int outCapacity) {
+    int written = 0;
+
+    while (frames > 0) {
+        int block = frames < blockFrames ? frames : blockFrames;
+        int produced = resamplerProcess(r, in, &block, out + written * outChannels, outCapacity);
+
+        if (produced < 0)
+            return -1;
+        written += produced;
+        in += block * inChannels;
+        frames -= block;
+    }
+    return written;
+}
+
+/* SNR in dB of the first channel against the best fitting sine of the frequency, skipping the filter's settling */
+static double snr(const short* samples, int channels, int frames, int rate, double frequency) {
+    double ss = 0.0, cc = 0.0, sc = 0.0, ys = 0.0, yc = 0.0;
+    double a, b, det, signal = 0.0, noise = 0.0;
+    int start = frames / 10;
+    int end = frames - frames / 10;
+    int i;
+
+    for (i = start; i < end; ++i) {
+        double s = sin(2.0 * M_PI * frequency * i / rate);
+        double c = cos(2.0 * M_PI * frequency * i / rate);
+        double y = samples[i * channels];
+        ss += s * s;
+        cc += c * c;
+        sc += s * c;
+        ys += y * s;
+        yc += y * c;
+    }
+    det = ss * cc - sc * sc;
+    a = (ys * cc - yc * sc) / det;
+    b = (yc * ss - ys * sc) / det;
+    for (i = start; i < end; ++i) {
+        double fit = a * sin(2.0 * M_PI * frequency * i / rate) + b * cos(2.0 * M_PI * frequency * i / rate);
+        double e = samples[i * channels] - fit;
+        signal += fit * fit;
+        noise += e * e;
+    }
+    return 10.0 * log10(signal / (noise > 0.0 ? noise : 1e-9));
+}
+
+static void checkRate(int inRate, int inChannels, int outRate, int outChannels) {
+    int frames = inRate * SECONDS;
+    double frequency = 997.0;
+    short* in = makeSine(inRate, inChannels, frequency, frames);
+    struct Resampler* whole = resamplerCreate(inRate, inChannels, outRate, outChannels);
+    struct Resampler* blocks = resamplerCreate(inRate, inChannels, outRate, outChannels);
+    int capacity = resamplerMaxOutput(whole, frames + resamplerDelay(whole));
+    short* expected = (short*)malloc(sizeof(short) * capacity * outChannels);
+    short* out = (short*)malloc(sizeof(short) * capacity * outChannels);
+    int expectedFrames, outFrames, consumed = frames;
+    int flushed, outFlushed;
+    long long idealFrames;
+    char what[128];
+    double db;
+
+    if (!whole || !blocks || !expected || !out)
+        exit(1);
+
+    expectedFrames = resamplerProcess(whole, in, &consumed, expected, capacity);
+    snprintf(what, sizeof(what), "%d Hz x%d -> %d Hz x%d consumes all input", inRate, inChannels, outRate, outChannels);
+    check(consumed == frames, what);
+
+    db = snr(expected, outChannels, expectedFrames, outRate, frequency);
+    printf("%6d Hz x%d -> %6d Hz x%d: %d frames, SNR %.1f dB\n", inRate, inChannels, outRate, outChannels, expectedFrames, db);
+    snprintf(what, sizeof(what), "%d Hz -> %d Hz SNR %.1f dB", inRate, outRate, db);
+    check(db >= MIN_SNR_DB, what);
+
+    /* 7 frame blocks, every block gets room for its whole output */
+    outFrames = convert(blocks, in, inChannels, frames, 7, out, outChannels, capacity);
+    snprintf(what, sizeof(what), "%d Hz -> %d Hz in 7 frame blocks", inRate, outRate);
+    check(outFrames == expectedFrames && memcmp(out, expected, sizeof(short) * outFrames * outChannels) == 0, what);
+
+    /* with the tail flushed the output covers the input and the filter delay, the same in blocks */
+    flushed = resamplerFlush(whole, expected + expectedFrames * outChannels, capacity - expectedFrames);
+    outFlushed = resamplerFlush(blocks, out + outFrames * outChannels, capacity - outFrames);
+    idealFrames = (long long)(frames + resamplerDelay(whole)) * outRate / inRate;
+    snprintf(what, sizeof(what), "%d Hz -> %d Hz flushes %d + %d frames, about %lld", inRate, outRate, expectedFrames, flushed, idealFrames);
+    check(flushed >= 0 && expectedFrames + flushed >= idealFrames - 1 && expectedFrames + flushed <= idealFrames + 1, what);
+    snprintf(what, sizeof(what), "%d Hz -> %d Hz flush after 7 frame blocks", inRate, outRate);
+    check(outFlushed == flushed && memcmp(out, expected, sizeof(short) * (outFrames + outFlushed) * outChannels) == 0, what);
+
+    resamplerDestroy(whole);
+    resamplerDestroy(blocks);
+    free(expected);
+    free(out);
+    free(in);
+}
+
+/*
+ * Input beyond the history cap into an output too small for it. The input left over is passed
+ * again, and what is buffered once all input is in comes out of calls without input.
+ */
+static void checkSmallOutput(void) {
+    int frames = 8000 * 30;
+    short* in = makeSine(8000, 1, 997.0, frames);
+    struct Resampler* whole = resamplerCreate(8000, 1, 48000, 1);
+    struct Resampler* pieces = resamplerCreate(8000, 1, 48000, 1);
+    int capacity = resamplerMaxOutput(whole, frames + resamplerDelay(whole));
+    short* expected = (short*)malloc(sizeof(short) * capacity);
+    short* out = (short*)malloc(sizeof(short) * capacity);
+    int expectedFrames = 0, outFrames = 0, offset = 0, produced = 1;
+
+    if (!whole || !pieces || !expected || !out)
+        exit(1);
+
+    /* reference in blocks that fit the history */
+    expectedFrames = convert(whole, in, 1, frames, 480, expected, 1, capacity);
+
+    while (offset < frames || produced > 0) {
+        int consumed = frames - offset;
+        int room = capacity - outFrames < 4096 ? capacity - outFrames : 4096;
+
+        produced = resamplerProcess(pieces, in + offset, &consumed, out + outFrames, room);
+        if (produced < 0 || (produced == 0 && consumed == 0 && offset < frames))
+            break;
+        outFrames += produced;
+        offset += consumed;
+    }
+    printf("8000 Hz -> 48000 Hz, %d frames into 4096 frame outputs: %d frames\n", frames, outFrames);
+    check(outFrames == expectedFrames && memcmp(out, expected, sizeof(short) * outFrames) == 0, "small output buffers lose no input");
+
+    resamplerDestroy(whole);
+    resamplerDestroy(pieces);
+    free(expected);
+    free(out);
+    free(in);
+}
+
+/* a tone above the output's Nyquist frequency must not alias into it */
+static void checkAliasing(void) {
+    int frames = 48000 * SECONDS;
+    short* in = makeSine(48000, 1, 6000.0, frames);
+    struct Resampler* r = resamplerCreate(48000, 1, 8000, 1);
+    int capacity = resamplerMaxOutput(r, frames);
+    short* out = (short*)malloc(sizeof(short) * capacity);
+    int outFrames, i, peak = 0;
+
+    if (!r || !out)
+        exit(1);
+    outFrames = resamplerProcess(r, in, &frames, out, capacity);
+    for (i = outFrames / 10; i < outFrames; ++i)
+        peak = abs(out[i]) > peak ? abs(out[i]) : peak;
+    printf(" 48000 Hz -> 8000 Hz, 6 kHz tone: peak %d\n", peak);
+    check(peak <= 8, "6 kHz suppressed when converting to 8 kHz");
+
+    resamplerDestroy(r);
+    free(out);
+    free(in);
+}
+
+static void bench(int inRate, int inChannels, int outRate, int outChannels) {
+    int blockFrames = inRate / 50;
+    short* in = makeSine(inRate, inChannels, 997.0, blockFrames);
+    struct Resampler* r = resamplerCreate(inRate, inChannels, outRate, outChannels);
+    int capacity = resamplerMaxOutput(r, blockFrames);
+    short* out = (short*)malloc(sizeof(short) * capacity * outChannels);
+    uint64_t start;
+    int i;
+
+    if (!r || !out)
+        exit(1);
+    start = pacerNowNs();
+    for (i = 0; i < BENCH_BLOCKS; ++i) {
+        int consumed = blockFrames;
+        resamplerProcess(r, in, &consumed, out, capacity);
+    }
+    printf("%6d Hz x%d -> %6d Hz x%d: %.1f us per 20 ms block\n", inRate, inChannels, outRate, outChannels, (double)(pacerNowNs() - start) / BENCH_BLOCKS / 1000.0);
+
+    resamplerDestroy(r);
+    free(out);
+    free(in);
+}
+
+int main(void) {
+    checkRate(44100, 2, 48000, 2);
+    checkRate(8000, 1, 48000, 1);
+    checkRate(96000, 2, 48000, 2);
+    checkRate(48000, 1, 8000, 1);
+    checkRate(22050, 1, 48000, 1);
+    checkRate(96000, 6, 48000, 2);
+    checkSmallOutput();
+    checkAliasing();
+
+    printf("\nthroughput:\n");
+    bench(44100, 2, 48000, 1);
+    bench(96000, 6, 48000, 2);
+    bench(48000, 2, 44100, 2);
+
+    if (failures > 0)
+        printf("%d checks failed\n", failures);
+    return failures > 0 ? 1 : 0;
+}
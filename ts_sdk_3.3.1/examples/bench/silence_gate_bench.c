@@ -0,0 +1,128 @@
+/*
+ * The capture silence gate of common/silence_gate.c over a checked in recording.
+ *
+ * The wave given on the command line, by default client_customdevice's welcome_to_teamspeak.wav, is
+ * cut into 20 ms frames as the custom device sample streams them. The bench runs silenceGateProcess
+ * over them once and prints the share of frames that are gated, once more with a second of silence
+ * after the recording, which the gate has to close on. Then it times silenceGateMeasure and
+ * silenceGateProcess per frame next to a plain loop over the samples. Exits with 1 if the wave can't
+ * be read, the gate stays open through the silence or silenceGateMeasure disagrees with the plain
+ * loop on a frame of the wave or on full scale and misaligned input.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../client_customdevice/wave.h"
+#include "../common/pacer.h"
+#include "../common/silence_gate.h"
+
+#define BENCH_FRAMES 200000
+#define SILENT_FRAMES 50
+
+/* silenceGateMeasure without SSE2, one sample at a time */
+static void plainMeasure(const short* samples, int count, uint64_t* sumSquares, int* peak) {
+    uint64_t sum = 0;
+    int maximum = 0;
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        int s = samples[i];
+        int magnitude = s < 0 ? -s : s;
+
+        sum += (uint64_t)(s * s);
+        if (magnitude > maximum)
+            maximum = magnitude;
+    }
+    *sumSquares = sum;
+    *peak = maximum > 32767 ? 32767 : maximum;
+}
+
+/* Exits with 1 if silenceGateMeasure and plainMeasure differ on count samples */
+static int checkMeasure(const short* samples, int count, const char* what) {
+    uint64_t sum, expectedSum;
+    int peak, expectedPeak;
+
+    silenceGateMeasure(samples, count, &sum, &peak);
+    plainMeasure(samples, count, &expectedSum, &expectedPeak);
+    if (sum != expectedSum || peak != expectedPeak) {
+        printf("FAIL: %s of %d samples measured %llu/%d, expected %llu/%d\n", what, count,
+               (unsigned long long)sum, peak, (unsigned long long)expectedSum, expectedPeak);
+        return 0;
+    }
+    return 1;
+}
+
+static volatile uint64_t sink;
+
+int main(int argc, char** argv) {
+    const char* path = argc > 1 ? argv[1] : "welcome_to_teamspeak.wav";
+    struct SilenceGate gate;
+    short* wave = NULL;
+    short* silence;
+    short fullScale[67];
+    int freq, channels, samples;
+    int frameSamples, frames, frame, i, ok = 1;
+    uint64_t start, measureNs, plainNs, processNs;
+
+    if (!readWave(path, &freq, &channels, &wave, &samples))
+        return 1;
+    frameSamples = freq * 20 / 1000 * channels;
+    frames = samples * channels / frameSamples;
+
+    for (frame = 0; frame < frames; ++frame)
+        ok &= checkMeasure(wave + frame * frameSamples, frameSamples, "wave frame");
+    for (i = 0; i < 67; ++i)
+        fullScale[i] = (short)(i & 1 ? -32768 : 32767);
+    for (i = 0; i < 8; ++i)
+        ok &= checkMeasure(fullScale + i, 67 - i, "full scale");
+
+    silenceGateInit(&gate, SILENCE_GATE_OPEN_DB, SILENCE_GATE_CLOSE_DB, SILENCE_GATE_HANGOVER);
+    for (frame = 0; frame < frames; ++frame)
+        silenceGateProcess(&gate, wave + frame * frameSamples, frameSamples);
+    printf("%s: %d Hz, %d channel(s), %d frames of 20 ms\n", path, freq, channels, frames);
+    silenceGatePrintStats(&gate, "gate");
+
+    if ((silence = (short*)calloc(frameSamples, sizeof(short))) == NULL)
+        return 1;
+    for (frame = 0; frame < SILENT_FRAMES; ++frame)
+        silenceGateProcess(&gate, silence, frameSamples);
+    silenceGatePrintStats(&gate, "gate with 1 s of silence after");
+    if (gate.gatedFrames == 0) {
+        printf("FAIL: the gate stayed open through %d silent frames\n", SILENT_FRAMES);
+        ok = 0;
+    }
+    free(silence);
+
+    start = pacerNowNs();
+    for (i = 0; i < BENCH_FRAMES; ++i) {
+        uint64_t sum;
+        int peak;
+        silenceGateMeasure(wave + (i % frames) * frameSamples, frameSamples, &sum, &peak);
+        sink += sum + peak;
+    }
+    measureNs = pacerNowNs() - start;
+
+    start = pacerNowNs();
+    for (i = 0; i < BENCH_FRAMES; ++i) {
+        uint64_t sum;
+        int peak;
+        plainMeasure(wave + (i % frames) * frameSamples, frameSamples, &sum, &peak);
+        sink += sum + peak;
+    }
+    plainNs = pacerNowNs() - start;
+
+    silenceGateInit(&gate, SILENCE_GATE_OPEN_DB, SILENCE_GATE_CLOSE_DB, SILENCE_GATE_HANGOVER);
+    start = pacerNowNs();
+    for (i = 0; i < BENCH_FRAMES; ++i)
+        sink += silenceGateProcess(&gate, wave + (i % frames) * frameSamples, frameSamples);
+    processNs = pacerNowNs() - start;
+
+    printf("silenceGateMeasure %8.1f ns/frame\n", (double)measureNs / BENCH_FRAMES);
+    printf("plain loop         %8.1f ns/frame\n", (double)plainNs / BENCH_FRAMES);
+    printf("silenceGateProcess %8.1f ns/frame\n", (double)processNs / BENCH_FRAMES);
+
+    free(wave);
+    return ok ? 0 : 1;
+}
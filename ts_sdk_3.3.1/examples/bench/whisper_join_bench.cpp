@@ -0,0 +1,122 @@
+/*
+ * Replay of a 5000 client join storm against the whisperer's Whisper_Targets.
+ *
+ * The old path rebuilt the whisper list on every join: it refetched the client list, copied it,
+ * erased our own id and logged every id. It is replayed here with the SDK calls stubbed, against
+ * the incremental update of Whisper_Targets, including reading every list that is sent. Exits with
+ * 1 if the targets end up different from the clients that joined.
+ */
+
+#include "../client_cpp_whisperer/whisper_targets.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace com::teamspeak;
+
+namespace
+{
+    constexpr auto kClients = 5000;
+    constexpr auto kOwnId = anyID{ 1 };
+
+    size_t sent_lists = 0;
+    size_t sent_ids = 0;
+    size_t log_bytes = 0;
+
+    /* stands in for ts3client_requestClientSetWhisperList, reads the list like the SDK would */
+    void send(const anyID* client_ids)
+    {
+        ++sent_lists;
+        for (; *client_ids; ++client_ids)
+            ++sent_ids;
+    }
+
+    double elapsed_ms(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    void replay_rebuild(const std::vector<anyID>& joins)
+    {
+        auto server = std::vector<anyID>{ kOwnId };
+        for (auto client_id : joins)
+        {
+            server.push_back(client_id);
+            // ts3client_getClientList hands out a copy
+            auto fetched = std::vector<anyID>(server.begin(), server.end());
+            auto targets = std::vector<anyID>();
+            for (auto id : fetched)
+                targets.push_back(id);
+            if (auto it = std::find(targets.begin(), targets.end(), kOwnId); it != targets.end())
+                targets.erase(it);
+            targets.push_back(0);
+
+            auto log = std::string("Whisperlist set to ");
+            for (auto id : targets)
+                log += std::to_string(id);
+            log_bytes += log.size();
+            send(targets.data());
+        }
+    }
+
+    void replay_incremental(Whisper_Targets& targets, const std::vector<anyID>& joins)
+    {
+        for (auto client_id : joins)
+        {
+            if (!targets.add(client_id))
+                continue;
+            auto log = std::string("Whisperlist set to ") + std::to_string(targets.size()) + " clients";
+            log_bytes += log.size();
+            send(targets.data());
+        }
+    }
+}
+
+int main()
+{
+    auto joins = std::vector<anyID>(kClients);
+    for (auto i = 0; i < kClients; ++i)
+        joins[i] = static_cast<anyID>(kOwnId + 1 + i);
+    std::shuffle(joins.begin(), joins.end(), std::mt19937(7));
+
+    auto start = std::chrono::steady_clock::now();
+    replay_rebuild(joins);
+    const auto rebuild_ms = elapsed_ms(start);
+    const auto rebuild_lists = sent_lists;
+    const auto rebuild_ids = sent_ids;
+    sent_lists = sent_ids = 0;
+
+    auto targets = Whisper_Targets();
+    targets.reset(kOwnId, nullptr);
+    start = std::chrono::steady_clock::now();
+    replay_incremental(targets, joins);
+    const auto incremental_ms = elapsed_ms(start);
+
+    auto expected = joins;
+    std::sort(expected.begin(), expected.end());
+    const auto correct = targets.size() == expected.size() && std::equal(expected.begin(), expected.end(), targets.data()) && targets.data()[targets.size()] == 0;
+
+    // one update on its own: a duplicate add and a remove per client
+    start = std::chrono::steady_clock::now();
+    auto changes = size_t{ 0 };
+    for (auto client_id : joins)
+        changes += targets.add(client_id);
+    for (auto client_id : joins)
+        changes += targets.remove(client_id);
+    const auto update_ns = elapsed_ms(start) * 1e6 / (2 * kClients);
+
+    std::printf("%d shuffled joins:\n", kClients);
+    std::printf("  rebuild:     %.1f ms, %zu lists of %zu ids in total\n", rebuild_ms, rebuild_lists, rebuild_ids);
+    std::printf("  incremental: %.1f ms, %zu lists of %zu ids in total\n", incremental_ms, sent_lists, sent_ids);
+    std::printf("  one update:  %.0f ns on average\n", update_ns);
+    if (!correct || changes != static_cast<size_t>(kClients) || !targets.empty())
+    {
+        std::printf("FAILED: the targets don't match the clients that joined and left\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,127 @@
+/*
+ * Channel tree benchmark of the whisperer's Whisper_Planner.
+ *
+ * Clients sit in channels picked from a Zipf distribution, a few big channels and a long tail,
+ * we sit in channel 5. 50000 events move them between channels or make them leave and join again.
+ * For each tree the bench compares listing every client by id, the whisperer's old approach, with
+ * the planner's channel targets: how many lists change and how big they are. Exits with 1 if the
+ * plan at the end doesn't match one computed from scratch.
+ */
+
+#include "../client_cpp_whisperer/whisper_planner.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace com::teamspeak;
+
+namespace
+{
+    constexpr auto kEvents = 50000;
+    constexpr auto kOwnId = anyID{ 1 };
+    constexpr auto kOwnChannelId = uint64{ 5 };
+
+    bool plan_matches(const Whisper_Planner& planner, const std::vector<uint64>& channel_of)
+    {
+        auto channels = std::set<uint64>();
+        auto clients = std::set<anyID>();
+        for (auto client_id = size_t{ kOwnId + 1 }; client_id < channel_of.size(); ++client_id)
+        {
+            if (channel_of[client_id] == kOwnChannelId)
+                clients.insert(static_cast<anyID>(client_id));
+            else
+                channels.insert(channel_of[client_id]);
+        }
+        return channels.size() == planner.channel_count() && std::equal(channels.begin(), channels.end(), planner.channels())
+            && clients.size() == planner.client_count() && std::equal(clients.begin(), clients.end(), planner.clients());
+    }
+
+    bool run(int channel_count, int client_count)
+    {
+        auto random = std::mt19937(42);
+        auto weights = std::vector<double>(channel_count);
+        for (auto i = 0; i < channel_count; ++i)
+            weights[i] = 1.0 / (i + 1);
+        auto pick_channel = std::discrete_distribution<int>(weights.begin(), weights.end());
+        const auto random_channel = [&]() { return uint64{ 1 } + pick_channel(random); };
+
+        auto planner = Whisper_Planner();
+        planner.reset(kOwnId, kOwnChannelId);
+        auto by_id = Whisper_Targets();  // every visible client listed by id
+        by_id.reset(kOwnId, nullptr);
+        auto channel_of = std::vector<uint64>(client_count + kOwnId + 1, 0);
+        for (auto client_id = size_t{ kOwnId + 1 }; client_id < channel_of.size(); ++client_id)
+        {
+            channel_of[client_id] = random_channel();
+            planner.move(static_cast<anyID>(client_id), 0, channel_of[client_id]);
+            by_id.add(static_cast<anyID>(client_id));
+        }
+        planner.move(kOwnId, 0, kOwnChannelId);
+
+        auto pick_client = std::uniform_int_distribution<int>(kOwnId + 1, client_count + kOwnId);
+        auto pick_event = std::uniform_int_distribution<int>(0, 9);
+        auto planner_lists = size_t{ 0 };
+        auto by_id_lists = size_t{ 0 };
+        auto planner_bytes = 0.0;
+        auto by_id_bytes = 0.0;
+        const auto start = std::chrono::steady_clock::now();
+        for (auto event = 0; event < kEvents; ++event)
+        {
+            const auto client_id = static_cast<anyID>(pick_client(random));
+            auto planner_changed = false;
+            auto by_id_changed = false;
+            if (pick_event(random) < 6)
+            {
+                // hops to another channel, stays visible
+                const auto to = random_channel();
+                planner_changed = planner.move(client_id, channel_of[client_id], to);
+                channel_of[client_id] = to;
+            }
+            else
+            {
+                // reconnects: leaves the server and joins again somewhere
+                planner_changed = planner.move(client_id, channel_of[client_id], 0);
+                by_id_changed = by_id.remove(client_id);
+                channel_of[client_id] = random_channel();
+                planner_changed |= planner.move(client_id, 0, channel_of[client_id]);
+                by_id_changed |= by_id.add(client_id);
+            }
+
+            if (planner_changed)
+            {
+                ++planner_lists;
+                planner_bytes += sizeof(uint64) * planner.channel_count() + sizeof(anyID) * planner.client_count();
+            }
+            if (by_id_changed)
+            {
+                ++by_id_lists;
+                by_id_bytes += sizeof(anyID) * by_id.size();
+            }
+        }
+        const auto ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / kEvents;
+
+        std::printf("%5d channels %5d clients: by id %5zu lists of %5.0f B | planner %5zu lists of %5.0f B (%zu channels, %zu clients), %.0f ns per event\n",
+            channel_count, client_count, by_id_lists, by_id_lists ? by_id_bytes / by_id_lists : 0.0,
+            planner_lists, planner_lists ? planner_bytes / planner_lists : 0.0, planner.channel_count(), planner.client_count(), ns);
+
+        if (!plan_matches(planner, channel_of))
+        {
+            std::printf("FAILED: the plan doesn't match the channel tree\n");
+            return false;
+        }
+        return true;
+    }
+}
+
+int main()
+{
+    std::printf("%d events, the times include listing by id:\n", kEvents);
+    auto ok = run(20, 500);
+    ok = run(200, 5000) && ok;
+    ok = run(1000, 5000) && ok;
+    return ok ? 0 : 1;
+}
@@ -22,6 +22,8 @@
 #include <teamspeak/public_errors.h>
 #include <teamspeak/clientlib.h>
 
+#include "recorder.h"
+
 #define DEFAULT_VIRTUAL_SERVER 1
 #define NAME_BUFSIZE 1024
 #define CHANNEL_PASSWORD_BUFSIZE 1024
@@ -36,12 +38,8 @@
 #define SLEEP(x) usleep(x*1000)
 #endif
 
-/* This is a global variable to indicate if sound needs to be recorded.
-   Normally one would have thread synchronization with locks etc. for 
-   thread safety. In the intterest of simplicity, this sample uses the
-   most simple way to safely record, using this variable
-*/
-int recordSound = 0;
+/* Records the mixed playback to a wave file, started and stopped from the main thread */
+struct Recorder recorder;
 
 /* For voice activation detection demo */
 uint64 vadTestscHandlerID;
@@ -55,28 +53,6 @@ int vadTestTalkStatus = 0;
  * Please note that you have to do the same on the server demo too */
 /* #define CUSTOM_PASSWORDS */
 
-/* a struct used for sound recording */
-struct WaveHeader {
-    /* Riff chunk */
-    char riffId[4];  
-    unsigned int len;
-    char riffType[4];  
-
-    /* Format chunk */
-    char fmtId[4];  // 'fmt '
-    unsigned int fmtLen;
-    unsigned short formatTag;
-    unsigned short channels;
-    unsigned int samplesPerSec;
-    unsigned int avgBytesPerSec;
-    unsigned short blockAlign;
-    unsigned short bitsPerSample;
-
-    /* Data chunk */
-    char dataId[4];  // 'data'
-    unsigned int dataLen;
-};
-
 /*
  * Callback for connection status change.
  * Connection status switches through the states STATUS_DISCONNECTED, STATUS_CONNECTING, STATUS_CONNECTED and STATUS_CONNECTION_ESTABLISHED.
@@ -342,99 +318,13 @@ void onCustomPacketDecryptEvent(char** dataReceived, unsigned int* dataReceivedS
  * -In the interrest of optimizations, a channel only contains data, if there is sound data for it. For example:
  * in 5.1 or 7.1 we (almost) never have data for the subwoofer. Teamspeak then leaves the data in this channel
  * undefined. This is more efficient for mixing.
- * This implementation will record sound to a 2 channel (stereo) wave file. This sample assumes there is only
+ * This implementation records sound to a 2 channel (stereo) wave file. This sample assumes there is only
  * 1 connection to a server
- * Hint: Normally you would want to defer the writing to an other thread because this callback is very time sensitive
+ * The callback is very time sensitive, so it only downmixes into the recorder's ring, a writer thread
+ * writes it to the file.
  */
 void onEditMixedPlaybackVoiceDataEvent(uint64 serverConnectionHandlerID, short* samples, int sampleCount, int channels, const unsigned int* channelSpeakerArray, unsigned int* channelFillMask){
-    #define OUTPUTCHANNELS 2
-    static FILE *pfile = NULL;
-    static struct WaveHeader header = { {'R','I','F','F'}, 0, {'W','A','V','E'}, {'f','m','t',' '}, 16, 1, 2, 48000, 48000*(16/2)*2, (16/2)*2, 16, {'d','a','t','a'}, 0 };
-
-    int currentSampleMix[OUTPUTCHANNELS]; /*a per channel/sample mix buffer*/
-    int channelCount[OUTPUTCHANNELS] = {0,0}; /*how many input channels does the output channel contain */
-    
-    int currentInChannel;
-    int currentOutChannel;
-    int currentSample;
-
-    /*for clipping*/
-    short shortval;
-    int   intval;
-
-    short* outputBuffer;
-
-    int leftChannelMask  = SPEAKER_FRONT_LEFT  | SPEAKER_FRONT_CENTER | SPEAKER_BACK_LEFT  | SPEAKER_FRONT_LEFT_OF_CENTER  | SPEAKER_BACK_CENTER | SPEAKER_SIDE_LEFT  | SPEAKER_TOP_CENTER | SPEAKER_TOP_FRONT_LEFT  | SPEAKER_TOP_FRONT_CENTER | SPEAKER_TOP_BACK_LEFT  | SPEAKER_TOP_BACK_CENTER;
-    int rightChannelMask = SPEAKER_FRONT_RIGHT | SPEAKER_FRONT_CENTER | SPEAKER_BACK_RIGHT | SPEAKER_FRONT_RIGHT_OF_CENTER | SPEAKER_BACK_CENTER | SPEAKER_SIDE_RIGHT | SPEAKER_TOP_CENTER | SPEAKER_TOP_FRONT_RIGHT | SPEAKER_TOP_FRONT_CENTER | SPEAKER_TOP_BACK_RIGHT | SPEAKER_TOP_BACK_CENTER;
-    
-    /*detect state changes*/
-    if (recordSound && (pfile == NULL)){
-        /*start recording*/
-        header.len = 0;
-        header.dataLen = 0;
-        if((pfile = fopen("recordedvoices.wav", "wb")) == NULL) return;
-        fwrite(&header, sizeof(struct WaveHeader), 1, pfile);
-    } else if (!recordSound && (pfile != NULL)){
-        /*stop recording*/
-        header.len = sizeof(struct WaveHeader)+header.dataLen - 8;
-        fseek (pfile, 0, SEEK_SET);
-        fwrite(&header, sizeof(struct WaveHeader), 1, pfile);
-        fclose(pfile);
-        pfile = NULL;
-    }
-
-    /*if there is nothing to do, quit*/
-    if (pfile == NULL || sampleCount == 0 || channels == 0) return;
-
-    /* initialize channel mixing */
-    currentInChannel = 0;
-    /*loop over all possible speakers*/
-    for (currentInChannel=0; currentInChannel < channels; ++currentInChannel) {
-        /*if the speaker has actual data*/
-        if ((*channelFillMask & (1<<currentInChannel)) != 0){
-            /*add to the outChannelSpeakerSet*/
-            if ((channelSpeakerArray[currentInChannel] & leftChannelMask) != 0) channelCount[0]++;
-            if ((channelSpeakerArray[currentInChannel] & rightChannelMask) != 0) channelCount[1]++;
-        }
-    }
-
-    /*get the outbut buffer*/
-    outputBuffer = (short*) malloc( sizeof(short)*sampleCount*2 /*output channels*/);
-
-    /* hint: if channelCount is 0 for all channels, we could write a zero buffer and quit here */
-
-    /*mix the samples*/
-    for (currentSample = 0; currentSample < sampleCount; currentSample++){
-        currentSampleMix[0] = currentSampleMix[1] = 0;
-        
-        /*loop over all channels in this frame */
-        for(currentInChannel =0; currentInChannel < channels; currentInChannel++){
-            if ((channelSpeakerArray[currentInChannel] & leftChannelMask)  != 0) currentSampleMix[0] += samples[ (currentSample*channels)+currentInChannel ];
-            if ((channelSpeakerArray[currentInChannel] & rightChannelMask) != 0) currentSampleMix[1] += samples[ (currentSample*channels)+currentInChannel ];
-        }
-        
-        /*collected all samples, store mixed sample */
-        for (currentOutChannel = 0; currentOutChannel < OUTPUTCHANNELS; currentOutChannel++){
-            if (channelCount[currentOutChannel] == 0){
-                outputBuffer[ (currentSample*OUTPUTCHANNELS) + currentOutChannel] = 0;
-            } else {
-                /*clip*/
-                intval = currentSampleMix[currentOutChannel]/channelCount[currentOutChannel];
-                if (intval >= SHRT_MAX) shortval = SHRT_MAX;
-                else if (intval <= SHRT_MIN) shortval = SHRT_MIN;
-                else shortval = (short) intval;
-                /*store*/
-                outputBuffer[ (currentSample*OUTPUTCHANNELS) + currentOutChannel] = shortval;
-            }
-        }
-    }
-
-    /*write data & update header */
-    fwrite(outputBuffer, sampleCount*sizeof(short)*OUTPUTCHANNELS, 1, pfile);
-    header.dataLen += sampleCount*sizeof(short)*OUTPUTCHANNELS;
-
-    /*free buffer*/
-    free(outputBuffer);
+    recorderWrite(&recorder, samples, sampleCount, channels, channelSpeakerArray, *channelFillMask);
 }
 
 #ifdef CUSTOM_PASSWORDS
@@ -1193,8 +1083,11 @@ void configureMicrophone() {
 void toggleRecordSound(uint64 serverConnectionHandlerID){
     unsigned int error;
 
-    if (!recordSound){
-        recordSound = 1;
+    if (!recorderIsActive(&recorder)){
+        if (!recorderStart(&recorder, "recordedvoices.wav")) {
+            printf("Error opening recordedvoices.wav\n");
+            return;
+        }
         if((error = ts3client_startVoiceRecording(serverConnectionHandlerID)) != ERROR_ok){
             char* errormsg;
             if(ts3client_getErrorMessage(error, &errormsg) == ERROR_ok) {
@@ -1205,7 +1098,7 @@ void toggleRecordSound(uint64 serverConnectionHandlerID){
         }
         printf("Started recording sound to wav\n");
     } else {
-        recordSound = 0;
+        recorderStop(&recorder);
         if((error = ts3client_stopVoiceRecording(serverConnectionHandlerID)) != ERROR_ok){
             char* errormsg;
             if(ts3client_getErrorMessage(error, &errormsg) == ERROR_ok) {
@@ -1369,6 +1262,12 @@ int main(int argc, char* argv[]) {
 #endif
     funcs.onCustom3dRolloffCalculationClientEvent = onCustom3dRolloffCalculationClientEvent;
 
+    /* The recording ring is allocated once here, the playback callback must not allocate */
+    if (!recorderInit(&recorder)) {
+        printf("Failed to allocate the recorder\n");
+        return 1;
+    }
+
     /* Initialize client lib with callbacks */
     /* Resource path points to the SDK\bin directory to locate the soundbackends folder when running from Visual Studio. */
     /* If you want to run directly from the SDK\bin directory, use an empty string instead to locate the soundbackends folder in the current directory. */
@@ -1613,9 +1512,9 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
-    /* This is a small hack, to close an open recording sound file */
-    recordSound = 0;
-    onEditMixedPlaybackVoiceDataEvent(DEFAULT_VIRTUAL_SERVER, NULL, 0, 0, NULL, NULL);
+    /* Finish an open recording, the client lib doesn't call back anymore */
+    recorderFree(&recorder);
+    recorderPrintStats(&recorder);
 
     return 0;
 }
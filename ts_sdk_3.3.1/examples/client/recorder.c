@@ -0,0 +1,277 @@
+#ifdef _WIN32
+#define _CRT_SECURE_NO_WARNINGS
+#pragma warning(disable : 4996)
+#else
+#define _POSIX_C_SOURCE 200112L
+#include <sched.h>
+#endif
+#include <stdlib.h>
+#include <string.h>
+
+#include "recorder.h"
+
+#define FRAME_BYTES (RECORDER_CHANNELS * sizeof(short))
+
+struct WaveHeader {
+    /* Riff chunk */
+    char riffId[4];
+    unsigned int len;
+    char riffType[4];
+
+    /* Format chunk */
+    char fmtId[4];  // 'fmt '
+    unsigned int fmtLen;
+    unsigned short formatTag;
+    unsigned short channels;
+    unsigned int samplesPerSec;
+    unsigned int avgBytesPerSec;
+    unsigned short blockAlign;
+    unsigned short bitsPerSample;
+
+    /* Data chunk */
+    char dataId[4];  // 'data'
+    unsigned int dataLen;
+};
+
+/* Sequentially consistent loads and stores of the fields shared between the threads */
+#ifdef _WIN32
+static unsigned int atomicLoad(const volatile unsigned int* value) {
+    return (unsigned int)InterlockedCompareExchange((volatile LONG*)value, 0, 0);
+}
+
+static void atomicStore(volatile unsigned int* value, unsigned int newValue) {
+    InterlockedExchange((volatile LONG*)value, (LONG)newValue);
+}
+
+static void yieldThread(void) {
+    SwitchToThread();
+}
+#else
+static unsigned int atomicLoad(const volatile unsigned int* value) {
+    return __atomic_load_n(value, __ATOMIC_SEQ_CST);
+}
+
+static void atomicStore(volatile unsigned int* value, unsigned int newValue) {
+    __atomic_store_n(value, newValue, __ATOMIC_SEQ_CST);
+}
+
+static void yieldThread(void) {
+    sched_yield();
+}
+#endif
+
+static void record(unsigned int* histogram, uint64_t ns) {
+    uint64_t us = ns / 1000u;
+    int bucket = 0;
+
+    while (bucket < RECORDER_HISTOGRAM_BUCKETS - 1 && us >= ((uint64_t)1 << bucket))
+        ++bucket;
+    ++histogram[bucket];
+}
+
+static void writeHeader(struct Recorder* recorder) {
+    struct WaveHeader header = { {'R','I','F','F'}, 0, {'W','A','V','E'}, {'f','m','t',' '}, 16, 1, RECORDER_CHANNELS, RECORDER_RATE, RECORDER_RATE * FRAME_BYTES, FRAME_BYTES, 16, {'d','a','t','a'}, 0 };
+
+    header.dataLen = recorder->dataLen;
+    header.len = sizeof(struct WaveHeader) + header.dataLen - 8;
+    fseek(recorder->file, 0, SEEK_SET);
+    fwrite(&header, sizeof(struct WaveHeader), 1, recorder->file);
+    fseek(recorder->file, 0, SEEK_END);
+    fflush(recorder->file);
+}
+
+/* Writes the ring out in whole blocks, or everything in it if all is set */
+static void drain(struct Recorder* recorder, int all) {
+    unsigned int tail = recorder->tail;
+    unsigned int fill = atomicLoad(&recorder->head) - tail;
+    unsigned int offset;
+    unsigned int frames;
+    uint64_t start;
+    uint64_t elapsed;
+
+    if (fill > recorder->maxFill)
+        recorder->maxFill = fill;
+
+    while (fill >= RECORDER_BLOCK_FRAMES || (all && fill > 0)) {
+        /* the tail only moves by whole blocks until the final drain, so a block never wraps around */
+        offset = tail % RECORDER_RING_FRAMES;
+        frames = fill < RECORDER_BLOCK_FRAMES ? fill : RECORDER_BLOCK_FRAMES;
+        if (frames > RECORDER_RING_FRAMES - offset)
+            frames = RECORDER_RING_FRAMES - offset;
+
+        start = pacerNowNs();
+        fwrite(recorder->ring + (size_t)offset * RECORDER_CHANNELS, frames * FRAME_BYTES, 1, recorder->file);
+        elapsed = pacerNowNs() - start;
+        if (elapsed > recorder->maxWriteNs)
+            recorder->maxWriteNs = elapsed;
+        ++recorder->blocks;
+        recorder->dataLen += frames * FRAME_BYTES;
+
+        /* hands the space back to the callback */
+        tail += frames;
+        fill -= frames;
+        atomicStore(&recorder->tail, tail);
+    }
+}
+
+static void runWriter(struct Recorder* recorder) {
+    struct Pacer pacer;
+    unsigned int periods = 0;
+
+    pacerInit(&pacer, RECORDER_WRITER_PERIOD_MS);
+    while (atomicLoad(&recorder->running)) {
+        periods += pacerWait(&pacer);
+        drain(recorder, 0);
+        if (periods * RECORDER_WRITER_PERIOD_MS >= RECORDER_HEADER_INTERVAL_MS) {
+            periods = 0;
+            writeHeader(recorder);
+        }
+    }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI writerThread(LPVOID recorder) {
+    runWriter((struct Recorder*)recorder);
+    return 0;
+}
+#else
+static void* writerThread(void* recorder) {
+    runWriter((struct Recorder*)recorder);
+    return NULL;
+}
+#endif
+
+int recorderInit(struct Recorder* recorder) {
+    memset(recorder, 0, sizeof(*recorder));
+    downmixInit(&recorder->downmix, RECORDER_CHANNELS);
+    recorder->ring = (short*)malloc((size_t)RECORDER_RING_FRAMES * FRAME_BYTES);
+    if (recorder->ring == NULL)
+        return 0;
+    /* fault the pages in now instead of on the audio thread */
+    memset(recorder->ring, 0, (size_t)RECORDER_RING_FRAMES * FRAME_BYTES);
+    return 1;
+}
+
+void recorderFree(struct Recorder* recorder) {
+    recorderStop(recorder);
+    free(recorder->ring);
+    recorder->ring = NULL;
+}
+
+int recorderStart(struct Recorder* recorder, const char* filename) {
+    if (recorder->file != NULL)
+        return 1;
+
+    if ((recorder->file = fopen(filename, "wb")) == NULL)
+        return 0;
+    /* the writer hands over whole blocks, buffering them again would only copy them */
+    setvbuf(recorder->file, NULL, _IONBF, 0);
+    recorder->dataLen = 0;
+    writeHeader(recorder);
+
+    recorder->head = 0;
+    recorder->tail = 0;
+    atomicStore(&recorder->running, 1);
+#ifdef _WIN32
+    if ((recorder->thread = CreateThread(NULL, 0, writerThread, recorder, 0, NULL)) == NULL) {
+#else
+    if (pthread_create(&recorder->thread, NULL, writerThread, recorder) != 0) {
+#endif
+        fclose(recorder->file);
+        recorder->file = NULL;
+        return 0;
+    }
+
+    atomicStore(&recorder->active, 1);
+    return 1;
+}
+
+void recorderStop(struct Recorder* recorder) {
+    if (recorder->file == NULL)
+        return;
+
+    /* after this no callback writes to the ring anymore, see recorderWrite */
+    atomicStore(&recorder->active, 0);
+    while (atomicLoad(&recorder->producing))
+        yieldThread();
+
+    atomicStore(&recorder->running, 0);
+#ifdef _WIN32
+    WaitForSingleObject(recorder->thread, INFINITE);
+    CloseHandle(recorder->thread);
+#else
+    pthread_join(recorder->thread, NULL);
+#endif
+
+    drain(recorder, 1);
+    writeHeader(recorder);
+    fclose(recorder->file);
+    recorder->file = NULL;
+}
+
+int recorderIsActive(const struct Recorder* recorder) {
+    return atomicLoad(&recorder->active) != 0;
+}
+
+void recorderWrite(struct Recorder* recorder, const short* samples, int sampleCount, int channels, const unsigned int* channelSpeakerArray, unsigned int channelFillMask) {
+    unsigned int head;
+    unsigned int frames;
+    unsigned int offset;
+    unsigned int part;
+    uint64_t start;
+    uint64_t elapsed;
+
+    if (!atomicLoad(&recorder->active) || sampleCount <= 0 || channels <= 0)
+        return;
+
+    /* recorderStop clears active and then waits for producing to clear, so either it sees us here or we see it stopped */
+    atomicStore(&recorder->producing, 1);
+    if (!atomicLoad(&recorder->active)) {
+        atomicStore(&recorder->producing, 0);
+        return;
+    }
+
+    start = pacerNowNs();
+
+    downmixConfigure(&recorder->downmix, channels, channelSpeakerArray, channelFillMask);
+
+    head = recorder->head;
+    frames = (unsigned int)sampleCount;
+    if (frames > RECORDER_RING_FRAMES - (head - atomicLoad(&recorder->tail))) {
+        /* the writer is behind, never wait for it here */
+        recorder->droppedFrames += frames;
+    } else {
+        offset = head % RECORDER_RING_FRAMES;
+        part = frames < RECORDER_RING_FRAMES - offset ? frames : RECORDER_RING_FRAMES - offset;
+        downmixProcess(&recorder->downmix, samples, (int)part, recorder->ring + (size_t)offset * RECORDER_CHANNELS);
+        if (part < frames)
+            downmixProcess(&recorder->downmix, samples + (size_t)part * channels, (int)(frames - part), recorder->ring);
+        /* publishes the frames to the writer */
+        atomicStore(&recorder->head, head + frames);
+    }
+
+    elapsed = pacerNowNs() - start;
+    ++recorder->calls;
+    if (elapsed > recorder->maxCallNs)
+        recorder->maxCallNs = elapsed;
+    record(recorder->callHistogram, elapsed);
+
+    atomicStore(&recorder->producing, 0);
+}
+
+void recorderPrintStats(const struct Recorder* recorder) {
+    int i;
+
+    printf("recorder: %llu callbacks, worst %.1f us, %llu frames dropped\n", (unsigned long long)recorder->calls, (double)recorder->maxCallNs / 1000.0, (unsigned long long)recorder->droppedFrames);
+    printf("  %llu blocks written, worst %.1f us, ring filled up to %u of %u frames\n", (unsigned long long)recorder->blocks, (double)recorder->maxWriteNs / 1000.0, recorder->maxFill, RECORDER_RING_FRAMES);
+    printf("  %llu layout changes, last one mixed by the %s kernel\n", (unsigned long long)recorder->downmix.layoutChanges, downmixKernelName(&recorder->downmix));
+    printf("  time per callback:\n");
+    for (i = 0; i < RECORDER_HISTOGRAM_BUCKETS; ++i) {
+        if (recorder->callHistogram[i] == 0)
+            continue;
+        if (i == RECORDER_HISTOGRAM_BUCKETS - 1)
+            printf("    >= %6u us: %u\n", 1u << (i - 1), recorder->callHistogram[i]);
+        else
+            printf("    <  %6u us: %u\n", 1u << i, recorder->callHistogram[i]);
+    }
+}
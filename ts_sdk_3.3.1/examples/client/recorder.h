@@ -0,0 +1,88 @@
+#ifndef RECORDER_H
+#define RECORDER_H
+
+/*
+ * Records the mixed playback to a stereo wave file without blocking the audio thread.
+ *
+ * The playback callback only downmixes into a ring that is allocated once up front and publishes
+ * the new write position, it never allocates, locks or touches the file. A writer thread drains
+ * the ring in whole blocks and rewrites the wave header every RECORDER_HEADER_INTERVAL_MS, so a
+ * recording cut short by a crash is still playable up to about then. If the writer falls behind
+ * so far that the ring is full, the callback drops its frames and counts them instead of waiting.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#include "../common/downmix.h"
+#include "../common/pacer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RECORDER_CHANNELS 2
+#define RECORDER_RATE 48000
+#define RECORDER_RING_FRAMES (1u << 18)  /* 1 MiB, about 5.5 s of audio */
+#define RECORDER_BLOCK_FRAMES (1u << 14) /* 64 KiB written at a time */
+#define RECORDER_WRITER_PERIOD_MS 50
+#define RECORDER_HEADER_INTERVAL_MS 1000
+
+/* histogram bucket i counts callbacks below 2^i microseconds, the last one everything above */
+#define RECORDER_HISTOGRAM_BUCKETS 12
+
+struct Recorder {
+    short* ring;                     /* RECORDER_RING_FRAMES interleaved frames */
+
+    /* frame counters, running freely and wrapping, the ring position is counter % RECORDER_RING_FRAMES */
+    volatile unsigned int head;      /* written by the callback */
+    volatile unsigned int tail;      /* written by the writer thread */
+    volatile unsigned int active;    /* set while the callback may write */
+    volatile unsigned int producing; /* set while the callback is inside recorderWrite */
+    volatile unsigned int running;   /* cleared to stop the writer thread */
+    struct Downmix downmix;          /* only used by the callback */
+
+    FILE* file;
+    unsigned int dataLen;            /* bytes of audio in the file, only touched by the writer */
+#ifdef _WIN32
+    HANDLE thread;
+#else
+    pthread_t thread;
+#endif
+
+    /* written by the callback */
+    uint64_t calls;
+    uint64_t droppedFrames;          /* frames lost to a full ring */
+    uint64_t maxCallNs;
+    unsigned int callHistogram[RECORDER_HISTOGRAM_BUCKETS];
+    /* written by the writer thread */
+    uint64_t blocks;                 /* block writes */
+    unsigned int maxFill;            /* most frames waiting in the ring */
+    uint64_t maxWriteNs;             /* longest block write */
+};
+
+/* Allocates the ring, returns 0 on failure */
+int recorderInit(struct Recorder* recorder);
+void recorderFree(struct Recorder* recorder);
+
+/* Main thread. Open the file and start the writer, or drain the ring, finish the file and stop it. */
+int recorderStart(struct Recorder* recorder, const char* filename);
+void recorderStop(struct Recorder* recorder);
+int recorderIsActive(const struct Recorder* recorder);
+
+/* Playback thread. Downmixes the frames to stereo into the ring if recording, arguments as passed to onEditMixedPlaybackVoiceDataEvent. */
+void recorderWrite(struct Recorder* recorder, const short* samples, int sampleCount, int channels, const unsigned int* channelSpeakerArray, unsigned int channelFillMask);
+
+void recorderPrintStats(const struct Recorder* recorder);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RECORDER_H */
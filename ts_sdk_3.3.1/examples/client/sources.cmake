@@ -2,4 +2,10 @@ message("generating TeamSpeak SDK sample ${TS_SDK_SAMPLE}")
 
 set (TS_SAMPLE_SRC
     "${CMAKE_CURRENT_LIST_DIR}/main.c"
+    "${CMAKE_CURRENT_LIST_DIR}/recorder.h"
+    "${CMAKE_CURRENT_LIST_DIR}/recorder.c"
+    "${CMAKE_CURRENT_LIST_DIR}/../common/downmix.h"
+    "${CMAKE_CURRENT_LIST_DIR}/../common/downmix.c"
+    "${CMAKE_CURRENT_LIST_DIR}/../common/pacer.h"
+    "${CMAKE_CURRENT_LIST_DIR}/../common/pacer.c"
 )
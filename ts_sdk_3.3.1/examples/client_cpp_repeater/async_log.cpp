@@ -0,0 +1,154 @@
+#include "async_log.hpp"
+
+#include "../common/pacer.h"
+
+#include <teamspeak/clientlib.h>
+#include <teamspeak/public_errors.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace com::teamspeak
+{
+    /*static*/ Async_Log& Async_Log::instance()
+    {
+        static auto result = Async_Log();
+        return result;
+    }
+
+    Async_Log::~Async_Log()
+    {
+        stop();
+    }
+
+    bool Async_Log::enter()
+    {
+        // pairs with stop(): either it sees us in _producers and waits, or we see the log stopped
+        _producers.fetch_add(1);
+        if (_running.load())
+            return true;
+        leave();
+        return false;
+    }
+
+    void Async_Log::log(uint32_t error, const char* message, uint64_t connection_id)
+    {
+        if (!enter())
+        {
+            log_now(error, message, connection_id);
+            return;
+        }
+
+        if (_queue.push(Record{ error, connection_id, message }))
+            _queued.fetch_add(1, std::memory_order_relaxed);
+        else
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+        leave();
+    }
+
+    void Async_Log::log_text(uint32_t error, std::string_view message, uint64_t connection_id)
+    {
+        if (!enter())
+        {
+            log_now(error, std::string(message).c_str(), connection_id);
+            return;
+        }
+
+        auto record = Text_Record{ error, connection_id, {} };
+        const auto length = std::min(message.size(), max_text - 1);
+        std::memcpy(record.message, message.data(), length);
+        record.message[length] = '\0';
+        if (_text_queue.push(record))
+            _queued.fetch_add(1, std::memory_order_relaxed);
+        else
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+        leave();
+    }
+
+    void Async_Log::log_now(uint32_t error, const char* message, uint64_t connection_id)
+    {
+        auto lock = std::lock_guard(_write_mutex);
+        write_locked(error, message, connection_id);
+    }
+
+    void Async_Log::start()
+    {
+        if (_running.exchange(true))
+            return;
+
+        _thread = std::thread([this]()
+            {
+                auto pacer = Pacer();
+                pacerInit(&pacer, 10);
+                while (_running)
+                {
+                    pacerWait(&pacer);
+                    drain();
+                }
+            });
+    }
+
+    void Async_Log::stop()
+    {
+        if (!_running.exchange(false))
+            return;
+        if (_thread.joinable())
+            _thread.join();
+
+        // a log() that saw the log running may still be pushing
+        while (_producers.load(std::memory_order_acquire) != 0)
+            std::this_thread::yield();
+        drain();
+        if (const auto dropped = _dropped.load(std::memory_order_relaxed); dropped > 0)
+        {
+            auto msg = std::to_string(dropped) + " error log records dropped, the log queue was full";
+            ts3client_logMessage(msg.c_str(), LogLevel_WARNING, "", 0);
+        }
+    }
+
+    size_t Async_Log::drain()
+    {
+        auto lock = std::lock_guard(_write_mutex);
+        auto count = _queue.consume([this](const Record& record)
+            {
+                write_locked(record.error, record.message, record.connection_id);
+            });
+        count += _text_queue.consume([this](const Text_Record& record)
+            {
+                write_locked(record.error, record.message, record.connection_id);
+            });
+        return count;
+    }
+
+    void Async_Log::write_locked(uint32_t error, const char* message, uint64_t connection_id)
+    {
+        auto it = _error_texts.find(error);
+        if (it == _error_texts.end())
+        {
+            auto text = std::string();
+            char* errormsg = nullptr;
+            if (ts3client_getErrorMessage(error, &errormsg) == ERROR_ok)
+            {
+                text = errormsg;
+                ts3client_freeMemory(errormsg);
+            }
+            it = _error_texts.emplace(error, std::move(text)).first;
+        }
+
+        if (it->second.empty())
+        {
+            ts3client_logMessage(message, LogLevel_ERROR, "", connection_id);
+            return;
+        }
+        auto error_msg = std::string(message) + " " + it->second;
+        ts3client_logMessage(error_msg.c_str(), LogLevel_ERROR, "", connection_id);
+    }
+
+    Async_Log::Stats Async_Log::stats() const
+    {
+        auto result = Stats();
+        result.queued = _queued.load(std::memory_order_relaxed);
+        result.dropped = _dropped.load(std::memory_order_relaxed);
+        return result;
+    }
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "mpsc_queue.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+namespace com::teamspeak
+{
+    /*
+    * Error log that keeps formatting off the calling thread.
+    *
+    * log() only queues a small record, the error code, the connection and a pointer to a message
+    * with static storage duration, e.g. a string literal. A background thread turns the records into
+    * text and hands them to ts3client_logMessage, the SDK's error texts are looked up once per code.
+    * Messages built at runtime go through log_text(), which copies them into a second, smaller queue
+    * of fixed size records, so records of the two may be written out of order.
+    * Before start() and after stop() records are written right away on the calling thread. stop()
+    * waits for the log() calls that saw the log running before its final drain, nothing is lost.
+    */
+    class Async_Log
+    {
+    public:
+        static Async_Log& instance();
+        ~Async_Log();
+
+        /* Any thread. message must outlive the log, if the queue is full the record is dropped and counted. */
+        void log(uint32_t error, const char* message, uint64_t connection_id);
+        /* Any thread. Copies message, up to max_text - 1 characters of it, for messages that are built at runtime. */
+        void log_text(uint32_t error, std::string_view message, uint64_t connection_id);
+        /* Any thread. Formats and writes on the calling thread. */
+        void log_now(uint32_t error, const char* message, uint64_t connection_id);
+
+        static constexpr size_t max_text = 240;
+
+        /* Starts the background thread, the client lib must be initialized by then */
+        void start();
+        /* Stops the background thread and writes what is still queued */
+        void stop();
+
+        struct Stats
+        {
+            uint64_t queued = 0;
+            uint64_t dropped = 0;  // queue full
+        };
+        Stats stats() const;
+
+    private:
+        struct Record
+        {
+            uint32_t error;
+            uint64_t connection_id;
+            const char* message;
+        };
+
+        struct Text_Record
+        {
+            uint32_t error;
+            uint64_t connection_id;
+            char message[max_text];
+        };
+
+        Async_Log() = default;
+
+        /* Counts the caller in _producers, returns false if the log isn't running and the caller should write right away */
+        bool enter();
+        void leave() { _producers.fetch_sub(1, std::memory_order_release); }
+        size_t drain();
+        /* Formats and writes a record, the caller holds _write_mutex */
+        void write_locked(uint32_t error, const char* message, uint64_t connection_id);
+
+        Mpsc_Queue<Record, 4096> _queue;
+        Mpsc_Queue<Text_Record, 256> _text_queue;
+        alignas(64) std::atomic<uint64_t> _queued{ 0 };
+        std::atomic<uint64_t> _dropped{ 0 };
+
+        std::mutex _write_mutex;  // guards the cache, only taken by the log thread while it runs
+        std::unordered_map<uint32_t, std::string> _error_texts;
+
+        std::atomic<bool> _running{ false };
+        std::atomic<int> _producers{ 0 };  // log() and log_text() calls between their _running check and the push
+        std::thread _thread;
+    };
+}
@@ -58,16 +58,20 @@ namespace com::teamspeak
 
     void Connection_Handler::on_connect_status_change(ConnectStatus status, uint32_t error)
     {
-        if (TS_Client::_do_autoreconnect && ConnectStatus::STATUS_DISCONNECTED == status)
-        {
-            // TODO: maybe should be timer-delayed?
-            connect();
-        }
+        auto&& reconnects = TS_Client::ts_client->_reconnects;
+        if (!TS_Client::_do_autoreconnect || !reconnects)
+            return;
+
+        /* Never reconnect from within the callback, the scheduler backs off and spreads the attempts */
+        if (ConnectStatus::STATUS_DISCONNECTED == status)
+            reconnects->disconnected(_connection_id);
+        else if (ConnectStatus::STATUS_CONNECTION_ESTABLISHED == status)
+            reconnects->established(_connection_id);
     }
 
     uint32_t Connection_Handler::open_audio(Audio_IO audio_io, std::string_view mode, std::string_view device_id)
     {
-        if (Audio_IO::Capture == audio_io)
+        if (Audio_IO::Playback == audio_io)
         {
             if (auto error = ts3client_openPlaybackDevice(_connection_id, mode.data(), device_id.data()); error != ERROR_ok)
             {
@@ -75,7 +79,7 @@ namespace com::teamspeak
                 return error;
             }
         }
-        else if (Audio_IO::Playback == audio_io)
+        else if (Audio_IO::Capture == audio_io)
         {
             if (auto error = ts3client_openCaptureDevice(_connection_id, mode.data(), device_id.data()); error != ERROR_ok)
             {
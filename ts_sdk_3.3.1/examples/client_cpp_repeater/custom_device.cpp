@@ -5,11 +5,14 @@
 #include <teamspeak/clientlib.h>
 #include <teamspeak/public_errors.h>
 
+#include <utility>
+
 namespace com::teamspeak
 {
-    Custom_Device::Custom_Device(uint32_t& error)
+    Custom_Device::Custom_Device(std::string device_id, uint32_t& error)
+        : _device_id(std::move(device_id))
     {
-        error = ts3client_registerCustomDevice(custom_device, custom_device, 48000, 1, 48000, 1);
+        error = ts3client_registerCustomDevice(_device_id.c_str(), _device_id.c_str(), 48000, 1, 48000, 1);
         if (error != ERROR_ok)
         {
             print_error(error, "Error creating custom device.", 0);
@@ -19,7 +22,7 @@ namespace com::teamspeak
     Custom_Device::~Custom_Device()
     {
         /* Unregister the custom device. This automatically closes the device.*/
-        if (auto error = ts3client_unregisterCustomDevice(custom_device); error != ERROR_ok)
+        if (auto error = ts3client_unregisterCustomDevice(_device_id.c_str()); error != ERROR_ok)
         {
             printf("Error unregistering custom device: %d\n", error);
         }
@@ -1,16 +1,18 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
 
 namespace com::teamspeak
 {
     class Custom_Device
     {
     public:
-        Custom_Device(uint32_t& error);
+        Custom_Device(std::string device_id, uint32_t& error);
         ~Custom_Device();
 
         static constexpr const char* custom_mode = "custom";
-        static constexpr const char* custom_device = "loopback";
+
+        const std::string _device_id;
     };
 }
@@ -0,0 +1,61 @@
+#include "event_queue.hpp"
+
+namespace com::teamspeak
+{
+    bool Event_Queue::post(const Event& event)
+    {
+        if (!_queue.push(event))
+        {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        _posted.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void Event_Queue::post_reliable(const Event& event)
+    {
+        /* while reliable events wait in the overflow list, later ones go there too to keep their order */
+        if (!_overflow_pending.load(std::memory_order_acquire) && _queue.push(event))
+        {
+            _posted.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        {
+            auto lock = std::lock_guard(_overflow_mutex);
+            _overflow.push_back(event);
+            _overflow_pending.store(true, std::memory_order_release);
+        }
+        _posted.fetch_add(1, std::memory_order_relaxed);
+        _overflowed.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void Event_Queue::record_residency(Clock::duration duration)
+    {
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+        _callbacks.fetch_add(1, std::memory_order_relaxed);
+
+        auto max = _max_residency_ns.load(std::memory_order_relaxed);
+        while (ns > max && !_max_residency_ns.compare_exchange_weak(max, ns, std::memory_order_relaxed))
+        {}
+
+        auto bucket = size_t{ 0 };
+        for (auto rest = ns; rest > 0 && bucket + 1 < _residency_histogram.size(); rest >>= 1)
+            ++bucket;
+        _residency_histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Event_Queue::Stats Event_Queue::stats() const
+    {
+        auto result = Stats();
+        result.posted = _posted.load(std::memory_order_relaxed);
+        result.dropped = _dropped.load(std::memory_order_relaxed);
+        result.overflowed = _overflowed.load(std::memory_order_relaxed);
+        result.callbacks = _callbacks.load(std::memory_order_relaxed);
+        result.max_residency = std::chrono::nanoseconds(_max_residency_ns.load(std::memory_order_relaxed));
+        for (auto i = size_t{ 0 }; i < _residency_histogram.size(); ++i)
+            result.residency_histogram[i] = _residency_histogram[i].load(std::memory_order_relaxed);
+        return result;
+    }
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "mpsc_queue.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace com::teamspeak
+{
+    enum class Event_Type : uint8_t
+    {
+        Connect_Status,
+        Client_Move,
+        Talk_Status,
+        Server_Error,
+        Ignored_Whisper
+    };
+
+    /* A callback's arguments, copied so the callback can return right away. Plain data, strings are truncated. */
+    struct Event
+    {
+        Event_Type type;
+        uint16_t client_id;
+        int32_t status;          // ConnectStatus, TalkStatus or Visibility
+        uint32_t error;
+        uint64_t connection_id;
+        uint64_t old_channel_id;
+        uint64_t new_channel_id;
+        char message[128];
+        char extra_message[96];
+    };
+
+    /*
+    * Queue of events, posted from the SDK callback threads and processed on one worker thread.
+    * post() neither allocates nor locks, if the queue is full the event is dropped and counted.
+    * post_reliable() is for the few events that must not get lost, it falls back to a locked
+    * overflow list while the queue is full.
+    *
+    * It also records how long the callbacks stayed in user code, see Residency_Timer.
+    */
+    class Event_Queue
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+        static constexpr size_t capacity = 1024;  // a power of two
+
+        /* Any thread. Returns false if the queue was full. */
+        bool post(const Event& event);
+
+        /*
+        * Any thread. Never drops the event: if the queue is full, or earlier reliable events still wait
+        * in the overflow list, it is appended there, which allocates and locks. Reliable events are
+        * processed in the order they were posted.
+        */
+        void post_reliable(const Event& event);
+
+        /* Consumer thread. Calls f(event) for every queued event, then for the overflow list, and returns their number. */
+        template<typename F>
+        size_t consume(F&& f)
+        {
+            auto count = _queue.consume(f);
+            if (!_overflow_pending.load(std::memory_order_acquire))
+                return count;
+
+            {
+                auto lock = std::lock_guard(_overflow_mutex);
+                _overflow.swap(_overflow_taken);
+                _overflow_pending.store(false, std::memory_order_release);
+            }
+            for (const auto& event : _overflow_taken)
+                f(event);
+            count += _overflow_taken.size();
+            _overflow_taken.clear();  // keeps the capacity for the next swap
+            return count;
+        }
+
+        /* Any thread. Records that a callback spent duration in user code. */
+        void record_residency(Clock::duration duration);
+
+        struct Stats
+        {
+            uint64_t posted = 0;
+            uint64_t dropped = 0;  // queue full
+            uint64_t overflowed = 0;  // reliable events that went to the overflow list
+            uint64_t callbacks = 0;
+            Clock::duration max_residency{};
+            std::array<uint64_t, 24> residency_histogram{};  // callbacks by residency, bucket n counts [2^(n-1), 2^n) ns
+        };
+        /* Safe to call from any thread, the values are read individually */
+        Stats stats() const;
+
+    private:
+        Mpsc_Queue<Event, capacity> _queue;
+
+        std::mutex _overflow_mutex;
+        std::vector<Event> _overflow;  // guarded by _overflow_mutex
+        std::vector<Event> _overflow_taken;  // consumer thread
+        std::atomic<bool> _overflow_pending{ false };  // _overflow isn't empty
+
+        alignas(64) std::atomic<uint64_t> _posted{ 0 };
+        std::atomic<uint64_t> _dropped{ 0 };
+        std::atomic<uint64_t> _overflowed{ 0 };
+        std::atomic<uint64_t> _callbacks{ 0 };
+        std::atomic<int64_t> _max_residency_ns{ 0 };
+        std::array<std::atomic<uint64_t>, 24> _residency_histogram{};
+    };
+
+    /* Times the enclosing callback into queue, from construction to the end of the scope */
+    class Residency_Timer
+    {
+    public:
+        explicit Residency_Timer(Event_Queue& queue) : _queue(queue), _start(Event_Queue::Clock::now()) {}
+        ~Residency_Timer() { _queue.record_residency(Event_Queue::Clock::now() - _start); }
+
+        Residency_Timer(const Residency_Timer&) = delete;
+        Residency_Timer& operator=(const Residency_Timer&) = delete;
+
+    private:
+        Event_Queue& _queue;
+        Event_Queue::Clock::time_point _start;
+    };
+}
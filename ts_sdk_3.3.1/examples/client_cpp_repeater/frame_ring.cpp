@@ -0,0 +1,76 @@
+#include "frame_ring.hpp"
+
+namespace com::teamspeak
+{
+    namespace
+    {
+        size_t round_up_pow2(size_t n)
+        {
+            size_t result = 1;
+            while (result < n)
+                result <<= 1;
+            return result;
+        }
+    }
+
+    Frame_Ring::Frame_Ring(size_t depth)
+        : _slots(std::make_unique<Slot[]>(round_up_pow2(depth > 0 ? depth : 1)))
+        , _mask(round_up_pow2(depth > 0 ? depth : 1) - 1)
+    {}
+
+    bool Frame_Ring::push(const Frame& frame)
+    {
+        const auto head = _head.load(std::memory_order_relaxed);
+        if (head - _tail_cache > _mask)
+        {
+            _tail_cache = _tail.load(std::memory_order_acquire);
+            if (head - _tail_cache > _mask)
+            {
+                _overflows.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        }
+
+        auto& slot = _slots[head & _mask];
+        slot.frame = frame;
+        slot.pushed = Clock::now();
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool Frame_Ring::pop(Frame& frame)
+    {
+        const auto tail = _tail.load(std::memory_order_relaxed);
+        if (tail == _head_cache)
+        {
+            _head_cache = _head.load(std::memory_order_acquire);
+            if (tail == _head_cache)
+            {
+                _underflows.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        }
+
+        const auto& slot = _slots[tail & _mask];
+        frame = slot.frame;
+        const auto latency = (Clock::now() - slot.pushed).count();
+        _tail.store(tail + 1, std::memory_order_release);
+
+        _frames.fetch_add(1, std::memory_order_relaxed);
+        _total_latency.fetch_add(latency, std::memory_order_relaxed);
+        if (latency > _max_latency.load(std::memory_order_relaxed))
+            _max_latency.store(latency, std::memory_order_relaxed);  // only the consumer writes it
+        return true;
+    }
+
+    Frame_Ring::Stats Frame_Ring::stats() const
+    {
+        auto result = Stats();
+        result.frames = _frames.load(std::memory_order_relaxed);
+        result.overflows = _overflows.load(std::memory_order_relaxed);
+        result.underflows = _underflows.load(std::memory_order_relaxed);
+        result.total_latency = Clock::duration(_total_latency.load(std::memory_order_relaxed));
+        result.max_latency = Clock::duration(_max_latency.load(std::memory_order_relaxed));
+        return result;
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace com::teamspeak
+{
+    /*
+    * Wait-free single producer / single consumer ring of 20ms audio frames.
+    * push() must only be called from one thread and pop() from one other thread.
+    */
+    class Frame_Ring
+    {
+    public:
+        // 48000 Hz, 1ch, 20ms -> 960 samples
+        static constexpr size_t frame_samples = 960;
+        using Frame = std::array<int16_t, frame_samples>;
+        using Clock = std::chrono::steady_clock;
+
+        /* depth is rounded up to a power of two */
+        explicit Frame_Ring(size_t depth);
+
+        /* Producer side. Returns false and counts an overflow if the ring is full, the frame is dropped then. */
+        bool push(const Frame& frame);
+        /* Consumer side. Returns false and counts an underflow if the ring is empty. */
+        bool pop(Frame& frame);
+
+        size_t capacity() const { return _mask + 1; }
+
+        struct Stats
+        {
+            uint64_t frames = 0;
+            uint64_t overflows = 0;
+            uint64_t underflows = 0;
+            Clock::duration total_latency{};  // time frames spent in the ring
+            Clock::duration max_latency{};
+        };
+        /* Safe to call from any thread, the values are read individually */
+        Stats stats() const;
+
+    private:
+        struct Slot
+        {
+            Frame frame;
+            Clock::time_point pushed;
+        };
+
+        std::unique_ptr<Slot[]> _slots;
+        const size_t _mask;
+
+        // producer and consumer indices on their own cache lines, each side caches the other's index
+        alignas(64) std::atomic<size_t> _head{ 0 };  // written by the producer
+        size_t _tail_cache = 0;
+        std::atomic<uint64_t> _overflows{ 0 };
+
+        alignas(64) std::atomic<size_t> _tail{ 0 };  // written by the consumer
+        size_t _head_cache = 0;
+        std::atomic<uint64_t> _frames{ 0 };
+        std::atomic<uint64_t> _underflows{ 0 };
+        std::atomic<int64_t> _total_latency{ 0 };
+        std::atomic<int64_t> _max_latency{ 0 };
+    };
+}
@@ -1,5 +1,7 @@
 #include "helpers.hpp"
 
+#include "async_log.hpp"
+
 #include <teamspeak/clientlib.h>
 #include <teamspeak/public_errors.h>
 
@@ -18,15 +20,15 @@ namespace com::teamspeak {
         if (error == ERROR_ok)
             return;
 
-        char* errormsg = nullptr;
-        if (ts3client_getErrorMessage(error, &errormsg) == ERROR_ok)
-        {
-            auto error_msg = msg + " " + std::string(errormsg);
-            ts3client_freeMemory(errormsg);
-            ts3client_logMessage(error_msg.c_str(), LogLevel_ERROR, "", connection_id);
+        Async_Log::instance().log_text(error, msg, connection_id);
+    }
+
+    void log_error(uint32_t error, const char* static_msg, uint64_t connection_id)
+    {
+        if (error == ERROR_ok)
             return;
-        }
-        ts3client_logMessage(msg.c_str(), LogLevel_ERROR, "", connection_id);
+
+        Async_Log::instance().log(error, static_msg, connection_id);
     }
 
     auto create_identity() -> std::string
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
@@ -11,7 +12,17 @@ enum Audio_IO : uint8_t
     Capture
 };
 
+/* Logs msg with the error's text unless error is ERROR_ok. Copies msg into the log queue, use it for messages built at runtime. */
 void print_error(uint32_t error, const std::string& msg, uint64_t connection_id = 0);
+/* Only queues a record for the background log thread, static_msg must outlive the log */
+void log_error(uint32_t error, const char* static_msg, uint64_t connection_id);
+/* print_error for string literals, takes the log_error path */
+template<size_t N>
+void print_error(uint32_t error, const char (&msg)[N], uint64_t connection_id = 0)
+{
+    log_error(error, msg, connection_id);
+}
+
 auto create_identity()->std::string;
 
 }
@@ -14,7 +14,12 @@
 #endif
 #include <stdio.h>
 
+#include "async_log.hpp"
 #include "custom_device.hpp"
+#include "frame_ring.hpp"
+#include "mixer.hpp"
+#include "../common/pacer.h"
+#include "../common/silence_gate.h"
 #include "helpers.hpp"
 #include "ts_client.hpp"
 
@@ -22,9 +27,13 @@
 #include <teamspeak/public_errors.h>
 #include <teamspeak/clientlib.h>
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <map>
 #include <thread>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #ifdef _WIN32
@@ -34,11 +43,16 @@
 #define SLEEP(x) usleep(x*1000)
 #endif
 
+struct Server_Address {
+    std::string ip = "";
+    uint16_t port = 0;
+};
+
 struct Opts {
-    std::string from_ip = "";
-    uint16_t from_port = 0;
-    std::string to_ip = "";
-    uint16_t to_port = 0;
+    std::vector<Server_Address> sources;
+    std::vector<Server_Address> destinations;
+    size_t ring_depth = 4; // frames of 20ms buffered between listeners and broadcasters
+    bool split_speakers = false; // also queue every speaker's decoded audio separately
 };
 
 namespace {
@@ -70,7 +84,37 @@ namespace {
 
     void print_usage()
     {
-        std::cout << "usage: from_id from_port to_id to_port" << std::endl;
+        std::cout << "usage: from_id from_port to_id to_port [to_id to_port ...] [ring_depth]" << std::endl;
+        std::cout << "       from_id from_port [from_id from_port ...] -- to_id to_port [to_id to_port ...] [ring_depth]" << std::endl;
+        std::cout << "       --speakers anywhere also queues the audio of every speaker separately" << std::endl;
+    }
+
+    bool parse_number(const char* arg, unsigned long& result)
+    {
+        try
+        {
+            result = std::stoul(arg);
+            return true;
+        }
+        catch (std::exception& e)
+        {
+            return false;
+        }
+    }
+
+    /* Parses "id port" pairs from argv[begin] up to argv[end], a single argument left over is returned in rest */
+    bool parse_addresses(char** argv, int begin, int end, std::vector<Server_Address>& result, const char*& rest)
+    {
+        auto port = 0ul;
+        auto i = begin;
+        for (; i + 1 < end; i += 2)
+        {
+            if (!parse_number(argv[i + 1], port))
+                return false;
+            result.push_back(Server_Address{ std::string(argv[i]), static_cast<uint16_t>(port) });
+        }
+        rest = i < end ? argv[i] : nullptr;
+        return true;
     }
 }
 
@@ -78,46 +122,51 @@ int main(int argc, char** argv)
 {
     // TODO: Decide on a proper header only options parser
     auto opts = Opts();
-    if (argc != 5)
+    {
+        auto kept = 1;
+        for (auto i = 1; i < argc; ++i)
+        {
+            if (std::string_view(argv[i]) == "--speakers")
+                opts.split_speakers = true;
+            else
+                argv[kept++] = argv[i];
+        }
+        argc = kept;
+    }
+    if (argc < 5)
     {
         print_usage();
         return -1;
     }
-    for (auto i = decltype(argc){1}; i < argc; ++i)
+    // source pairs up to "--" (just the first pair without it), then destination pairs, then an optional ring depth
+    auto separator = std::find_if(argv + 1, argv + argc, [](const char* arg) { return std::string_view(arg) == "--"; }) - argv;
+    auto sources_end = separator < argc ? static_cast<int>(separator) : 3;
+    auto destinations_begin = separator < argc ? sources_end + 1 : 3;
+    const char* rest = nullptr;
+    if (!parse_addresses(argv, 1, sources_end, opts.sources, rest) || rest ||
+        !parse_addresses(argv, destinations_begin, argc, opts.destinations, rest) ||
+        opts.sources.empty() || opts.destinations.empty())
     {
-        switch (i)
+        print_usage();
+        return -1;
+    }
+    if (rest)
+    {
+        auto number = 0ul;
+        if (!parse_number(rest, number))
         {
-        case 1:
-            opts.from_ip = std::string(argv[i]);
-            break;
-        case 2:
-            try
-            {
-                opts.from_port = std::stoul(argv[i]);
-            }
-            catch (std::exception& e)
-            {
-                print_usage();
-                return -1;
-            }
-            break;
-        case 3:
-            opts.to_ip = std::string(argv[i]);
-            break;
-        case 4:
-            try
-            {
-                opts.to_port = std::stoul(argv[i]);
-            }
-            catch (std::exception& e)
-            {
-                print_usage();
-                return -1;
-            }
-            break;
+            print_usage();
+            return -1;
         }
+        opts.ring_depth = number;
     }
-    std::cout << "listening to " << opts.from_ip.c_str() << ":" << opts.from_port << ", sending to " << opts.to_ip.c_str() << ":" << opts.to_port << std::endl;
+    std::cout << "listening to";
+    for (auto&& source : opts.sources)
+        std::cout << " " << source.ip.c_str() << ":" << source.port;
+    std::cout << ", sending to";
+    for (auto&& destination : opts.destinations)
+        std::cout << " " << destination.ip.c_str() << ":" << destination.port;
+    std::cout << std::endl;
 
     using namespace com::teamspeak;
 
@@ -137,84 +186,182 @@ int main(int argc, char** argv)
         ts_client->_identity = identity;
     }
 
+    if (opts.split_speakers)
+        ts_client->_speakers = std::make_unique<Speaker_Queues>();
+
     // We'll recycle them in case of disconnect, hence spawn these only once
+
+    /* Every listener gets its own playback device, their frames are mixed into one */
+    for (auto&& source : opts.sources)
     {
+        auto index = ts_client->_listeners.size();
+
+        auto error = uint32_t{ ERROR_ok };
+        auto device = std::make_unique<Custom_Device>("listen_" + std::to_string(index), error);
+        if (ERROR_ok != error)
+            return 1;
+
         auto connection = Connection_Handler::create();
         if (!connection)
             return 1;
 
-        ts_client->_connections[Audio_IO::Playback].swap(connection);
+        connection->open_audio(Audio_IO::Playback, Custom_Device::custom_mode, device->_device_id);
+        connection->_connection_data = Connection_Handler::Connection_Data{
+            source.ip,
+            source.port,
+            "repeater-listener-" + std::to_string(index),
+            ts_client->_identity
+        };
+
+        ts_client->_listen_devices.push_back(std::move(device));
+        ts_client->_listeners.push_back(std::move(connection));
     }
 
+    /* Every broadcaster gets its own capture device, all of them are fed the same frames */
+    for (auto&& destination : opts.destinations)
     {
+        auto index = ts_client->_broadcasters.size();
+
+        auto error = uint32_t{ ERROR_ok };
+        auto device = std::make_unique<Custom_Device>("broadcast_" + std::to_string(index), error);
+        if (ERROR_ok != error)
+            return 1;
+
         auto connection = Connection_Handler::create();
         if (!connection)
             return 1;
 
-        ts_client->_connections[Audio_IO::Capture].swap(connection);
+        connection->open_audio(Audio_IO::Capture, Custom_Device::custom_mode, device->_device_id);
+        connection->_connection_data = Connection_Handler::Connection_Data{
+            destination.ip,
+            destination.port,
+            "repeater-broadcaster-" + std::to_string(index),
+            ts_client->_identity
+        };
+
+        ts_client->_broadcast_devices.push_back(std::move(device));
+        ts_client->_broadcasters.push_back(std::move(connection));
     }
 
+    /* Lost connections are reconnected from the scheduler's thread, with backoff */
+    ts_client->_reconnects = std::make_unique<Reconnect_Scheduler>(Reconnect_Scheduler::Options(), [](uint64_t connection_id)
+        {
+            auto* connection = TS_Client::ts_client->find_connection(connection_id);
+            return connection ? connection->connect() : uint32_t{ ERROR_ok };
+        });
+    ts_client->_reconnects->start();
+
+    for (auto&& connection_listen : ts_client->_listeners)
+        connection_listen->connect();
+    for (auto&& connection_broadcast : ts_client->_broadcasters)
+        connection_broadcast->connect();
 
-    auto&& connection_listen = ts_client->_connections[Audio_IO::Playback];
-    auto&& connection_broadcast = ts_client->_connections[Audio_IO::Capture];
+    /*
+    * The listeners' playback is drained and the broadcasters' capture is fed on separate threads,
+    * joined by a ring of 20ms frames, so a stall on one side doesn't block the other.
+    */
+    auto ring = Frame_Ring(opts.ring_depth);
+    std::cout << "buffering up to " << ring.capacity() << " frames" << std::endl;
 
-    connection_listen->open_audio(Audio_IO::Playback, Custom_Device::custom_mode, Custom_Device::custom_device);
-    connection_broadcast->open_audio(Audio_IO::Capture, Custom_Device::custom_mode, Custom_Device::custom_device);
+    auto drain_pacer = Pacer();
+    auto feed_pacer = Pacer();
+    pacerInit(&drain_pacer, 20); // audio buffer size in our opus is 20ms
+    pacerInit(&feed_pacer, 20);
 
-    connection_listen->_connection_data = Connection_Handler::Connection_Data{
-        opts.from_ip,
-        opts.from_port,
-        "repeater-listener",
-        ts_client->_identity
-    };
-    connection_listen->connect();
-    connection_broadcast->_connection_data = Connection_Handler::Connection_Data{
-        opts.to_ip,
-        opts.to_port,
-        "repeater-broadcaster",
-        ts_client->_identity
-    };
-    connection_broadcast->connect();
+    std::cout << "mixing " << ts_client->_listen_devices.size() << " sources with the " << mix_kernel_name() << " kernel" << std::endl;
 
-    // 48000 kHz, 1ch, 20ms -> 960 samples
-    auto playback_buffer = std::array<int16_t, 960>();
-    auto custom_audio_thread = std::thread([&playback_buffer]()
+    auto drain_thread = std::thread([&ring, &drain_pacer, &ts_client]()
         {
+            auto input = Frame_Ring::Frame();
+            auto mix = Frame_Ring::Frame();
             while (!TS_Client::ts_client->_shutting_down)
             {
-                for (;;)
+                // one frame per source and due 20ms period, several after a late wakeup
+                for (auto due = pacerWait(&drain_pacer); due > 0; --due)
                 {
-                    /* Get playback data from the client lib */
-                    if (auto error_playback = ts3client_acquireCustomPlaybackData(Custom_Device::custom_device, playback_buffer.data(), playback_buffer.size()); error_playback != ERROR_ok)
+                    auto sources_mixed = 0;
+                    for (auto&& device : ts_client->_listen_devices)
                     {
-                        if (ERROR_sound_no_data == error_playback)
+                        /* Get playback data from the client lib */
+                        if (auto error_playback = ts3client_acquireCustomPlaybackData(device->_device_id.c_str(), input.data(), input.size()); error_playback != ERROR_ok)
                         {
-                            /* Not an error. The client lib has no playback data available.
-                            Depending on your custom sound API, either pause playback for
-                            performance optimization or send a buffer of zeros. */
-
-                            // we're doing a no-op here
+                            if (ERROR_sound_no_data != error_playback)
+                            {
+                                /* Error occured */
+                                print_error(error_playback, "Failed to get playback data", 0);
+                            }
+                            /* Not an error otherwise. The client lib has no playback data available,
+                            the source is silent and left out of the mix. */
+                            continue;
                         }
+
+                        // the first source is copied, the others are summed onto it saturating at the int16 range
+                        if (sources_mixed++ == 0)
+                            mix = input;
                         else
-                        {
-                            /* Error occured */
-                            print_error(error_playback, "Failed to get playback data", 0);
-                        }
-                        break; // break draining (inner loop)
+                            mix_saturating(mix.data(), input.data(), mix.size());
                     }
-                    else
+
+                    // hand the mix to the capture side. If the ring is full the frame is dropped and counted.
+                    if (sources_mixed > 0)
+                        ring.push(mix);
+                }
+            }
+        });
+
+    /*
+    * Per-speaker consumer. This sample only counts what every speaker sent, this is the place to
+    * route, mute or record individual speakers.
+    */
+    auto speaker_samples = std::map<std::pair<uint64_t, uint16_t>, uint64_t>();
+    auto speaker_thread = std::thread([&ts_client, &speaker_samples]()
+        {
+            if (!ts_client->_speakers)
+                return;
+
+            auto pacer = Pacer();
+            pacerInit(&pacer, 20);
+            while (!TS_Client::ts_client->_shutting_down)
+            {
+                pacerWait(&pacer);
+                ts_client->_speakers->consume([&speaker_samples](uint64_t connection_id, uint16_t client_id, const int16_t* /*samples*/, size_t count)
                     {
-                        // we got playback data, loop it back to capture
-                        /* Stream your capture data to the client lib */
-                        if (auto error_capture = ts3client_processCustomCaptureData(Custom_Device::custom_device, playback_buffer.data(), playback_buffer.size()); ERROR_ok != error_capture)
-                        {
+                        speaker_samples[{ connection_id, client_id }] += count;
+                    });
+            }
+        });
+
+    // time spent handing frames to the broadcasters' capture devices
+    auto fan_out_time = std::chrono::steady_clock::duration{};
+    auto fan_out_frames = uint64_t{ 0 };
+
+    // silent mixes aren't handed to the broadcasters, their encoders idle instead
+    auto gate = SilenceGate();
+    silenceGateInit(&gate, SILENCE_GATE_OPEN_DB, SILENCE_GATE_CLOSE_DB, SILENCE_GATE_HANGOVER);
+
+    auto feed_thread = std::thread([&ring, &feed_pacer, &gate, &fan_out_time, &fan_out_frames, &ts_client]()
+        {
+            auto frame = Frame_Ring::Frame();
+            while (!TS_Client::ts_client->_shutting_down)
+            {
+                // one frame per due 20ms period, several after a late wakeup
+                for (auto due = pacerWait(&feed_pacer); due > 0; --due)
+                {
+                    if (!ring.pop(frame))
+                        break;
+                    if (!silenceGateProcess(&gate, frame.data(), static_cast<int>(frame.size())))
+                        continue;
+
+                    /* Stream your capture data to the client lib, the same frame to every destination */
+                    auto start = std::chrono::steady_clock::now();
+                    for (auto&& device : ts_client->_broadcast_devices)
+                    {
+                        if (auto error_capture = ts3client_processCustomCaptureData(device->_device_id.c_str(), frame.data(), frame.size()); ERROR_ok != error_capture)
                             print_error(error_capture, "Failed to process capture data", 0);
-                            break; // break draining (inner loop)
-                        }
                     }
+                    fan_out_time += std::chrono::steady_clock::now() - start;
+                    ++fan_out_frames;
                 }
-                using namespace std::chrono_literals;
-                std::this_thread::sleep_for(0.02s); // audio buffer size in our opus is 20ms
             }
         });
 
@@ -226,8 +373,57 @@ int main(int argc, char** argv)
 
     /* Disconnect from servers */
     ts_client->_shutting_down = true;
-    custom_audio_thread.join();
-    connection_listen->disconnect();
-    connection_broadcast->disconnect();
+    {
+        auto reconnect_stats = ts_client->_reconnects->stats();
+        std::cout << "reconnect attempts: " << reconnect_stats.attempts << ", " << reconnect_stats.deferred << " deferred by the concurrency cap" << std::endl;
+        ts_client->_reconnects->stop();  // callbacks may still report, nothing reconnects anymore
+    }
+    {
+        auto event_stats = ts_client->_events.stats();
+        std::cout << "callbacks: " << event_stats.callbacks << ", longest in user code "
+            << std::chrono::duration<double, std::micro>(event_stats.max_residency).count() << " us; events posted "
+            << event_stats.posted << ", dropped " << event_stats.dropped << " (queue full), "
+            << event_stats.overflowed << " status changes kept in the overflow list" << std::endl;
+        std::cout << "callback residency:";
+        for (auto i = size_t{ 0 }; i < event_stats.residency_histogram.size(); ++i)
+        {
+            if (event_stats.residency_histogram[i] > 0)
+                std::cout << " <" << (uint64_t{ 1 } << i) << "ns:" << event_stats.residency_histogram[i];
+        }
+        std::cout << std::endl;
+
+        auto log_stats = Async_Log::instance().stats();
+        std::cout << "error log: " << log_stats.queued << " records queued, " << log_stats.dropped << " dropped (queue full)" << std::endl;
+    }
+    drain_thread.join();
+    feed_thread.join();
+    speaker_thread.join();
+
+    auto stats = ring.stats();
+    auto average_ms = stats.frames ? std::chrono::duration<double, std::milli>(stats.total_latency).count() / stats.frames : 0.0;
+    std::cout << "repeated " << stats.frames << " frames, " << stats.overflows << " dropped (ring full), "
+        << stats.underflows << " ticks without a frame, added latency avg " << average_ms << " ms, max "
+        << std::chrono::duration<double, std::milli>(stats.max_latency).count() << " ms" << std::endl;
+    if (fan_out_frames > 0)
+    {
+        auto per_frame_us = std::chrono::duration<double, std::micro>(fan_out_time).count() / fan_out_frames;
+        std::cout << "fan-out to " << ts_client->_broadcast_devices.size() << " destinations: " << per_frame_us << " us per frame, "
+            << per_frame_us / ts_client->_broadcast_devices.size() << " us per destination" << std::endl;
+    }
+    pacerPrintStats(&drain_pacer, "playback drain");
+    pacerPrintStats(&feed_pacer, "capture feed");
+    silenceGatePrintStats(&gate, "capture feed");
+    if (ts_client->_speakers)
+    {
+        for (auto&& [speaker, samples] : speaker_samples)
+            std::cout << "speaker " << speaker.second << " on connection " << speaker.first << ": " << samples / 48 << " ms of audio" << std::endl;
+        std::cout << "speaker chunks dropped: " << ts_client->_speakers->overflows() << " (queue full), "
+            << ts_client->_speakers->no_queue() << " (no free queue)" << std::endl;
+    }
+
+    for (auto&& connection_listen : ts_client->_listeners)
+        connection_listen->disconnect();
+    for (auto&& connection_broadcast : ts_client->_broadcasters)
+        connection_broadcast->disconnect();
     return 0;
 }
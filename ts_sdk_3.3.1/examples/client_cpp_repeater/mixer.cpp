@@ -0,0 +1,133 @@
+#include "mixer.hpp"
+
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define MIXER_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+// MSVC compiles AVX2 intrinsics without extra flags, GCC and Clang need the function to be marked
+#if defined(MIXER_X86) && (defined(__GNUC__) || defined(__clang__))
+#define MIXER_TARGET(x) __attribute__((target(x)))
+#else
+#define MIXER_TARGET(x)
+#endif
+
+namespace com::teamspeak
+{
+    namespace
+    {
+        void mix_scalar(int16_t* dst, const int16_t* src, size_t samples)
+        {
+            for (auto i = size_t{ 0 }; i < samples; ++i)
+            {
+                auto sum = int32_t{ dst[i] } + int32_t{ src[i] };
+                dst[i] = static_cast<int16_t>(std::clamp<int32_t>(sum, INT16_MIN, INT16_MAX));
+            }
+        }
+
+#ifdef MIXER_X86
+        MIXER_TARGET("sse2")
+        void mix_sse2(int16_t* dst, const int16_t* src, size_t samples)
+        {
+            auto i = size_t{ 0 };
+            for (; i + 8 <= samples; i += 8)
+            {
+                auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+                auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_adds_epi16(a, b));
+            }
+            mix_scalar(dst + i, src + i, samples - i);
+        }
+
+        MIXER_TARGET("avx2")
+        void mix_avx2(int16_t* dst, const int16_t* src, size_t samples)
+        {
+            auto i = size_t{ 0 };
+            for (; i + 16 <= samples; i += 16)
+            {
+                auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+                auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_adds_epi16(a, b));
+            }
+            mix_sse2(dst + i, src + i, samples - i);
+        }
+
+        bool cpu_has_avx2()
+        {
+#ifdef _MSC_VER
+            int info[4];
+            __cpuid(info, 0);
+            if (info[0] < 7)
+                return false;
+            __cpuid(info, 1);
+            // OSXSAVE and AVX, and the OS saves the YMM registers
+            if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 || (_xgetbv(0) & 6) != 6)
+                return false;
+            __cpuidex(info, 7, 0);
+            return (info[1] & (1 << 5)) != 0;
+#else
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2");
+#endif
+        }
+
+        bool cpu_has_sse2()
+        {
+#if defined(_M_X64) || defined(__x86_64__)
+            return true;  // part of x86-64
+#elif defined(_MSC_VER)
+            int info[4];
+            __cpuid(info, 1);
+            return (info[3] & (1 << 26)) != 0;
+#else
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("sse2");
+#endif
+        }
+#endif
+
+        Mix_Kernel select_kernel()
+        {
+#ifdef MIXER_X86
+            if (cpu_has_avx2())
+                return { mix_avx2, "avx2" };
+            if (cpu_has_sse2())
+                return { mix_sse2, "sse2" };
+#endif
+            return { mix_scalar, "scalar" };
+        }
+
+        const Mix_Kernel& kernel()
+        {
+            static const auto selected = select_kernel();
+            return selected;
+        }
+    }
+
+    void mix_saturating(int16_t* dst, const int16_t* src, size_t samples)
+    {
+        kernel().mix(dst, src, samples);
+    }
+
+    const char* mix_kernel_name()
+    {
+        return kernel().name;
+    }
+
+    std::vector<Mix_Kernel> mix_kernels()
+    {
+        auto result = std::vector<Mix_Kernel>{ { mix_scalar, "scalar" } };
+#ifdef MIXER_X86
+        if (cpu_has_sse2())
+            result.push_back({ mix_sse2, "sse2" });
+        if (cpu_has_avx2())
+            result.push_back({ mix_avx2, "avx2" });
+#endif
+        return result;
+    }
+}
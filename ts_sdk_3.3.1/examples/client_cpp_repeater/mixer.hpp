@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace com::teamspeak
+{
+    /*
+    * Adds src to dst sample by sample, saturating at the int16 range.
+    * Uses AVX2 or SSE2 when the CPU supports it, picked once at startup.
+    */
+    void mix_saturating(int16_t* dst, const int16_t* src, size_t samples);
+
+    /* Name of the kernel mix_saturating uses: "avx2", "sse2" or "scalar" */
+    const char* mix_kernel_name();
+
+    struct Mix_Kernel
+    {
+        void (*mix)(int16_t* dst, const int16_t* src, size_t samples);
+        const char* name;
+    };
+    /* Every kernel the CPU can run, scalar first, for comparing them */
+    std::vector<Mix_Kernel> mix_kernels();
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace com::teamspeak
+{
+    /*
+    * Bounded multi producer / single consumer queue of plain records. Every cell carries a sequence
+    * number, producers claim a position with one CAS and publish the cell by bumping its sequence.
+    * push() neither allocates nor locks. consume() must only be called from one thread.
+    */
+    template<typename T, size_t Capacity>
+    class Mpsc_Queue
+    {
+        static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    public:
+        Mpsc_Queue()
+            : _cells(std::make_unique<Cell[]>(Capacity))
+        {
+            for (auto i = size_t{ 0 }; i < Capacity; ++i)
+                _cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        /* Any thread. Returns false if the queue is full, the record is not queued then. */
+        bool push(const T& value)
+        {
+            auto position = _enqueue.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                auto& cell = _cells[position & (Capacity - 1)];
+                const auto sequence = cell.sequence.load(std::memory_order_acquire);
+                const auto lag = static_cast<std::ptrdiff_t>(sequence - position);
+                if (lag == 0)
+                {
+                    // the cell is free for this position, claim it
+                    if (_enqueue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        cell.value = value;
+                        cell.sequence.store(position + 1, std::memory_order_release);
+                        return true;
+                    }
+                    // lost the race, position was reloaded
+                }
+                else if (lag < 0)
+                {
+                    // the consumer hasn't freed the cell of the previous lap yet
+                    return false;
+                }
+                else
+                {
+                    position = _enqueue.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /* Consumer thread. Calls f(value) for every queued record and returns their number. */
+        template<typename F>
+        size_t consume(F&& f)
+        {
+            auto count = size_t{ 0 };
+            for (;;)
+            {
+                auto& cell = _cells[_dequeue & (Capacity - 1)];
+                if (cell.sequence.load(std::memory_order_acquire) != _dequeue + 1)
+                    return count;  // empty, or the next producer hasn't finished writing
+
+                f(static_cast<const T&>(cell.value));
+                // free the cell for the producer one lap ahead
+                cell.sequence.store(_dequeue + Capacity, std::memory_order_release);
+                ++_dequeue;
+                ++count;
+            }
+        }
+
+    private:
+        struct Cell
+        {
+            std::atomic<size_t> sequence;  // == position when free for it, position + 1 once filled
+            T value;
+        };
+
+        std::unique_ptr<Cell[]> _cells;
+        alignas(64) std::atomic<size_t> _enqueue{ 0 };  // claimed by the producers
+        alignas(64) size_t _dequeue = 0;  // consumer only
+    };
+}
@@ -0,0 +1,128 @@
+#include "reconnect_scheduler.hpp"
+
+#include "../common/pacer.h"
+
+#include <teamspeak/public_errors.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace com::teamspeak
+{
+    Reconnect_Scheduler::Reconnect_Scheduler(const Options& options, Connect connect)
+        : _options(options)
+        , _connect(std::move(connect))
+    {}
+
+    Reconnect_Scheduler::~Reconnect_Scheduler()
+    {
+        stop();
+    }
+
+    void Reconnect_Scheduler::start()
+    {
+        if (_running.exchange(true))
+            return;
+
+        _thread = std::thread([this]()
+            {
+                auto pacer = Pacer();
+                pacerInit(&pacer, _options.tick_ms);
+                while (_running)
+                    advance(pacerWait(&pacer));
+            });
+    }
+
+    void Reconnect_Scheduler::stop()
+    {
+        _running = false;
+        if (_thread.joinable())
+            _thread.join();
+    }
+
+    uint64_t Reconnect_Scheduler::delay_ticks(uint32_t attempt)
+    {
+        const auto shift = std::min<uint32_t>(attempt > 0 ? attempt - 1 : 0, 20);
+        const auto delay_ms = std::min<uint64_t>(uint64_t{ _options.base_delay_ms } << shift, _options.max_delay_ms);
+        // jitter down to half the delay
+        const auto jittered_ms = delay_ms / 2 + std::uniform_int_distribution<uint64_t>(0, delay_ms / 2)(_random);
+        return std::max<uint64_t>(1, jittered_ms / _options.tick_ms);
+    }
+
+    void Reconnect_Scheduler::schedule_locked(uint64_t connection_id)
+    {
+        if (!_scheduled.insert(connection_id).second)
+            return;  // already waiting
+        _wheel.add(delay_ticks(++_attempts[connection_id]), connection_id);
+    }
+
+    void Reconnect_Scheduler::disconnected(uint64_t connection_id)
+    {
+        auto lock = std::lock_guard(_mutex);
+        _connecting.erase(connection_id);
+        schedule_locked(connection_id);
+    }
+
+    void Reconnect_Scheduler::established(uint64_t connection_id)
+    {
+        auto lock = std::lock_guard(_mutex);
+        _connecting.erase(connection_id);
+        _attempts.erase(connection_id);
+    }
+
+    void Reconnect_Scheduler::remove(uint64_t connection_id)
+    {
+        auto lock = std::lock_guard(_mutex);
+        _connecting.erase(connection_id);
+        _attempts.erase(connection_id);
+        // a timer still on the wheel finds the connection gone and is dropped
+        _scheduled.erase(connection_id);
+        _due.erase(std::remove(_due.begin(), _due.end(), connection_id), _due.end());
+    }
+
+    void Reconnect_Scheduler::advance(unsigned int ticks)
+    {
+        auto to_connect = std::vector<uint64_t>();
+        {
+            auto lock = std::lock_guard(_mutex);
+            for (; ticks > 0; --ticks)
+            {
+                _wheel.tick([this](uint64_t connection_id)
+                    {
+                        if (_scheduled.erase(connection_id) == 0)
+                            return;  // removed meanwhile
+                        if (_connecting.size() + _due.size() >= _options.max_connecting)
+                            ++_deferred;
+                        _due.push_back(connection_id);
+                    });
+            }
+
+            while (!_due.empty() && _connecting.size() < _options.max_connecting)
+            {
+                const auto connection_id = _due.front();
+                _due.pop_front();
+                _connecting.insert(connection_id);
+                to_connect.push_back(connection_id);
+            }
+            _started += to_connect.size();
+        }
+
+        for (auto connection_id : to_connect)
+        {
+            if (_connect(connection_id) != ERROR_ok)
+                disconnected(connection_id);  // couldn't even start, back off
+        }
+    }
+
+    Reconnect_Scheduler::Stats Reconnect_Scheduler::stats()
+    {
+        auto lock = std::lock_guard(_mutex);
+        auto result = Stats();
+        result.attempts = _started;
+        result.deferred = _deferred;
+        result.scheduled = _scheduled.size();
+        result.waiting = _due.size();
+        result.connecting = _connecting.size();
+        return result;
+    }
+}
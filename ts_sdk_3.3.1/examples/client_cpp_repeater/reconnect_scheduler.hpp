@@ -0,0 +1,85 @@
+#pragma once
+
+#include "timer_wheel.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace com::teamspeak
+{
+    /*
+    * Schedules reconnects of lost connections on a timer wheel, off the SDK callback thread.
+    *
+    * The n-th attempt in a row waits min(base_delay * 2^(n-1), max_delay), jittered down to half of
+    * that, so connections lost at the same instant spread out instead of hitting the server together.
+    * At most max_connecting connections are connecting at once, due ones beyond that wait their turn.
+    */
+    class Reconnect_Scheduler
+    {
+    public:
+        struct Options
+        {
+            uint32_t tick_ms = 10;
+            uint32_t base_delay_ms = 1000;
+            uint32_t max_delay_ms = 60000;
+            uint32_t max_connecting = 8;
+        };
+
+        /* connect is called on the scheduler thread and returns the error of starting the connection */
+        using Connect = std::function<uint32_t(uint64_t connection_id)>;
+
+        Reconnect_Scheduler(const Options& options, Connect connect);
+        ~Reconnect_Scheduler();
+
+        /* Starts the thread driving the wheel. Without it advance() has to be called by hand, e.g. in simulations. */
+        void start();
+        void stop();
+
+        /* Any thread. The connection was lost or failed to connect, schedules its next attempt. */
+        void disconnected(uint64_t connection_id);
+        /* Any thread. The connection is established, resets its backoff. */
+        void established(uint64_t connection_id);
+        /* Any thread. Forgets the connection, e.g. when it is destroyed. */
+        void remove(uint64_t connection_id);
+
+        /* Advances the wheel by ticks and starts the due connects the concurrency cap allows */
+        void advance(unsigned int ticks);
+
+        struct Stats
+        {
+            uint64_t attempts = 0;        // connects started
+            uint64_t deferred = 0;        // due connects that had to wait for the concurrency cap
+            size_t scheduled = 0;         // connections waiting on the wheel
+            size_t waiting = 0;           // due connections waiting for the cap
+            size_t connecting = 0;
+        };
+        Stats stats();
+
+    private:
+        uint64_t delay_ticks(uint32_t attempt);
+        void schedule_locked(uint64_t connection_id);
+
+        const Options _options;
+        const Connect _connect;
+
+        std::mutex _mutex;  // guards everything below, never held while connecting
+        Timer_Wheel _wheel;
+        std::unordered_map<uint64_t, uint32_t> _attempts;  // failed attempts in a row
+        std::unordered_set<uint64_t> _scheduled;
+        std::unordered_set<uint64_t> _connecting;
+        std::deque<uint64_t> _due;
+        std::minstd_rand _random{ std::random_device{}() };
+        uint64_t _started = 0;
+        uint64_t _deferred = 0;
+
+        std::atomic<bool> _running{ false };
+        std::thread _thread;
+    };
+}
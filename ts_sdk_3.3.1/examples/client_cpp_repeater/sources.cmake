@@ -10,4 +10,23 @@ set (TS_SAMPLE_SRC
     "${CMAKE_CURRENT_LIST_DIR}/helpers.cpp"
     "${CMAKE_CURRENT_LIST_DIR}/custom_device.hpp"
     "${CMAKE_CURRENT_LIST_DIR}/custom_device.cpp"
+    "${CMAKE_CURRENT_LIST_DIR}/frame_ring.hpp"
+    "${CMAKE_CURRENT_LIST_DIR}/frame_ring.cpp"
+    "${CMAKE_CURRENT_LIST_DIR}/mixer.hpp"
+    "${CMAKE_CURRENT_LIST_DIR}/mixer.cpp"
+    "${CMAKE_CURRENT_LIST_DIR}/speaker_queues.hpp"
+    "${CMAKE_CURRENT_LIST_DIR}/speaker_queues.cpp"
+    "${CMAKE_CURRENT_LIST_DIR}/timer_wheel.hpp"
+    "${CMAKE_CURRENT_LIST_DIR}/timer_wheel.cpp"
+    "${CMAKE_CURRENT_LIST_DIR}/reconnect_scheduler.hpp"
+    "${CMAKE_CURRENT_LIST_DIR}/reconnect_scheduler.cpp"
+    "${CMAKE_CURRENT_LIST_DIR}/event_queue.hpp"
+    "${CMAKE_CURRENT_LIST_DIR}/event_queue.cpp"
+    "${CMAKE_CURRENT_LIST_DIR}/mpsc_queue.hpp"
+    "${CMAKE_CURRENT_LIST_DIR}/async_log.hpp"
+    "${CMAKE_CURRENT_LIST_DIR}/async_log.cpp"
+    "${CMAKE_CURRENT_LIST_DIR}/../common/pacer.h"
+    "${CMAKE_CURRENT_LIST_DIR}/../common/pacer.c"
+    "${CMAKE_CURRENT_LIST_DIR}/../common/silence_gate.h"
+    "${CMAKE_CURRENT_LIST_DIR}/../common/silence_gate.c"
 )
@@ -0,0 +1,119 @@
+#include "speaker_queues.hpp"
+
+namespace com::teamspeak
+{
+    Speaker_Queues::Speaker_Queues()
+        : _queues(std::make_unique<Queue[]>(max_speakers))
+    {
+        for (auto i = size_t{ 0 }; i < max_speakers; ++i)
+            _queues[i].samples = std::make_unique<int16_t[]>(queue_samples);
+    }
+
+    Speaker_Queues::Queue* Speaker_Queues::find(uint64_t key, bool claim)
+    {
+        // Released queues keep their key with released_bit set until the consumer recycled them, a
+        // full scan finds the speaker even behind freed queues. It's a few hundred compares once per
+        // audio chunk.
+        Queue* free_queue = nullptr;
+        for (auto i = size_t{ 0 }; i < max_speakers; ++i)
+        {
+            auto& queue = _queues[i];
+            const auto queue_key = queue.key.load(std::memory_order_acquire);
+            if (queue_key == key)
+                return &queue;
+            if (queue_key == 0 && !free_queue)
+                free_queue = &queue;
+        }
+        if (!claim)
+            return nullptr;
+
+        // claim a free queue, another audio thread may take it first
+        for (; free_queue < _queues.get() + max_speakers; ++free_queue)
+        {
+            auto expected = uint64_t{ 0 };
+            if (free_queue->key.compare_exchange_strong(expected, key, std::memory_order_acq_rel))
+                return free_queue;
+        }
+        return nullptr;
+    }
+
+    void Speaker_Queues::push(uint64_t connection_id, uint16_t client_id, const int16_t* samples, int sample_count, int channels)
+    {
+        if (sample_count <= 0 || channels <= 0)
+            return;
+
+        const auto key = make_key(connection_id, client_id);
+        Queue* queue = nullptr;
+        // a second try claims a new queue if the speaker's one was released meanwhile
+        for (auto attempt = 0; attempt < 2 && !queue; ++attempt)
+        {
+            if (!(queue = find(key, true)))
+                break;
+            // pairs with the writers check in consume(): either it sees us writing, or we see the key released
+            queue->writers.fetch_add(1);
+            if (queue->key.load() != key)
+            {
+                queue->writers.fetch_sub(1, std::memory_order_release);
+                queue = nullptr;
+            }
+        }
+        if (!queue)
+        {
+            _no_queue.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        constexpr auto mask = queue_samples - 1;
+        const auto head = queue->head.load(std::memory_order_relaxed);
+        const auto tail = queue->tail.load(std::memory_order_acquire);
+        if (queue_samples - (head - tail) < static_cast<size_t>(sample_count))
+        {
+            queue->writers.fetch_sub(1, std::memory_order_release);
+            _overflows.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        auto* dst = queue->samples.get();
+        if (channels == 1)
+        {
+            for (auto i = 0; i < sample_count; ++i)
+                dst[(head + i) & mask] = samples[i];
+        }
+        else
+        {
+            for (auto i = 0; i < sample_count; ++i)
+            {
+                auto sum = int32_t{ 0 };
+                for (auto c = 0; c < channels; ++c)
+                    sum += samples[i * channels + c];
+                dst[(head + i) & mask] = static_cast<int16_t>(sum / channels);
+            }
+        }
+        queue->head.store(head + sample_count, std::memory_order_release);
+        queue->writers.fetch_sub(1, std::memory_order_release);
+    }
+
+    void Speaker_Queues::release(Queue& queue, uint64_t key)
+    {
+        // fails if the queue was released or recycled meanwhile, then it isn't the speaker's anymore
+        queue.key.compare_exchange_strong(key, key | released_bit);
+    }
+
+    void Speaker_Queues::release(uint64_t connection_id, uint16_t client_id)
+    {
+        const auto key = make_key(connection_id, client_id);
+        if (auto* queue = find(key, false))
+            release(*queue, key);
+    }
+
+    void Speaker_Queues::release_connection(uint64_t connection_id)
+    {
+        for (auto i = size_t{ 0 }; i < max_speakers; ++i)
+        {
+            auto& queue = _queues[i];
+            const auto key = queue.key.load(std::memory_order_acquire);
+            if (key != 0 && !(key & released_bit) && key >> 16 == connection_id)
+                release(queue, key);
+        }
+    }
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace com::teamspeak
+{
+    /*
+    * Per-speaker sample queues, filled from onEditPlaybackVoiceDataEvent.
+    *
+    * Every speaker (connection and client id) owns one of a fixed number of single producer /
+    * single consumer rings of 48kHz mono samples. All memory is allocated up front, push() neither
+    * allocates nor locks, so it is safe on the SDK audio threads. consume() must only be called
+    * from one thread.
+    *
+    * A released queue is recycled by consume() only once no push() is writing to it, a push()
+    * counts itself in the queue's writers and checks the key again before it copies. So a push
+    * that raced release() either finds the queue released and drops its chunk, or finishes
+    * before the queue changes hands.
+    */
+    class Speaker_Queues
+    {
+    public:
+        static constexpr size_t max_speakers = 256;
+        static constexpr size_t queue_samples = 32768;  // ~680ms at 48kHz, a power of two
+
+        Speaker_Queues();
+
+        /* SDK audio thread. Copies the samples, downmixed to mono, into the queue of the speaker. */
+        void push(uint64_t connection_id, uint16_t client_id, const int16_t* samples, int sample_count, int channels);
+
+        /* Any thread. The queue of the speaker is emptied and reused by the next consume(). */
+        void release(uint64_t connection_id, uint16_t client_id);
+        /* Any thread. Releases the queues of all speakers of a connection. */
+        void release_connection(uint64_t connection_id);
+
+        /*
+        * Consumer thread. Calls f(connection_id, client_id, samples, count) for every speaker with
+        * queued samples, twice if the samples wrap around the end of its ring.
+        */
+        template<typename F>
+        void consume(F&& f);
+
+        uint64_t overflows() const { return _overflows.load(std::memory_order_relaxed); }  // chunks dropped because a queue was full
+        uint64_t no_queue() const { return _no_queue.load(std::memory_order_relaxed); }    // chunks dropped because all queues were taken
+
+    private:
+        static constexpr uint64_t released_bit = uint64_t{ 1 } << 63;
+
+        struct Queue
+        {
+            std::atomic<uint64_t> key{ 0 };  // connection_id << 16 | client_id, | released_bit once released, 0 if free
+            std::atomic<int> writers{ 0 };   // push() calls between their key check and the head update
+            std::unique_ptr<int16_t[]> samples;
+            alignas(64) std::atomic<size_t> head{ 0 };  // written by the producer
+            alignas(64) std::atomic<size_t> tail{ 0 };  // written by the consumer
+        };
+
+        static uint64_t make_key(uint64_t connection_id, uint16_t client_id) { return connection_id << 16 | client_id; }
+        Queue* find(uint64_t key, bool claim);
+        static void release(Queue& queue, uint64_t key);
+
+        std::unique_ptr<Queue[]> _queues;
+        std::atomic<uint64_t> _overflows{ 0 };
+        std::atomic<uint64_t> _no_queue{ 0 };
+    };
+
+    template<typename F>
+    void Speaker_Queues::consume(F&& f)
+    {
+        constexpr auto mask = queue_samples - 1;
+        for (auto i = size_t{ 0 }; i < max_speakers; ++i)
+        {
+            auto& queue = _queues[i];
+            const auto key = queue.key.load(std::memory_order_acquire);
+            if (key == 0)
+                continue;
+
+            const auto head = queue.head.load(std::memory_order_acquire);
+            if (key & released_bit)
+            {
+                // a push still writing saw the key before it was released, recycle on a later call
+                if (queue.writers.load() != 0)
+                    continue;
+                // drop what's left and hand the queue back to the producers
+                queue.tail.store(queue.head.load(std::memory_order_acquire), std::memory_order_relaxed);
+                queue.key.store(0, std::memory_order_release);
+                continue;
+            }
+
+            auto tail = queue.tail.load(std::memory_order_relaxed);
+            if (head == tail)
+                continue;
+
+            const auto connection_id = key >> 16;
+            const auto client_id = static_cast<uint16_t>(key & 0xffff);
+            const auto start = tail & mask;
+            const auto count = head - tail;
+            const auto first = count < queue_samples - start ? count : queue_samples - start;
+            f(connection_id, client_id, queue.samples.get() + start, first);
+            if (first < count)
+                f(connection_id, client_id, queue.samples.get(), count - first);
+            queue.tail.store(head, std::memory_order_release);
+        }
+    }
+}
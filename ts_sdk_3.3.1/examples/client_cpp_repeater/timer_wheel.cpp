@@ -0,0 +1,40 @@
+#include "timer_wheel.hpp"
+
+namespace com::teamspeak
+{
+    void Timer_Wheel::add(uint64_t delay, uint64_t id)
+    {
+        insert(Entry{ _now + (delay > 0 ? delay : 1), id });
+        ++_size;
+    }
+
+    void Timer_Wheel::insert(const Entry& entry)
+    {
+        const auto delta = entry.due - _now;
+        if (delta < level0_slots)
+            _level0[entry.due & (level0_slots - 1)].push_back(entry);
+        else if (delta < level0_slots * level1_slots)
+            _level1[(entry.due >> level0_bits) & (level1_slots - 1)].push_back(entry);
+        else
+            _overflow.push_back(entry);
+    }
+
+    /* moves the timers of the next 256 ticks from the second level into the first */
+    void Timer_Wheel::cascade()
+    {
+        const auto index = (_now >> level0_bits) & (level1_slots - 1);
+        if (index == 0 && !_overflow.empty())
+        {
+            _scratch.swap(_overflow);
+            for (auto&& entry : _scratch)
+                insert(entry);
+            _scratch.clear();
+        }
+
+        // a slot may also hold timers of the next round, insert() puts them back
+        _scratch.swap(_level1[index]);
+        for (auto&& entry : _scratch)
+            insert(entry);
+        _scratch.clear();
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace com::teamspeak
+{
+    /*
+    * Hierarchical timer wheel of ids. The first level holds the next 256 ticks, the second one the
+    * next 64 * 256 ticks, anything later waits in an overflow list. Adding a timer is O(1), a tick
+    * only touches the timers that are due or move down a level.
+    * Not thread safe.
+    */
+    class Timer_Wheel
+    {
+    public:
+        /* Schedules id to expire after delay ticks, at least one */
+        void add(uint64_t delay, uint64_t id);
+
+        /* Advances the wheel by one tick and calls expired(id) for every timer due */
+        template<typename F>
+        void tick(F&& expired);
+
+        uint64_t now() const { return _now; }
+        size_t size() const { return _size; }
+
+    private:
+        struct Entry
+        {
+            uint64_t due;
+            uint64_t id;
+        };
+
+        static constexpr uint64_t level0_bits = 8;
+        static constexpr uint64_t level0_slots = 1 << level0_bits;
+        static constexpr uint64_t level1_slots = 64;
+
+        void insert(const Entry& entry);
+        void cascade();
+
+        std::array<std::vector<Entry>, level0_slots> _level0;
+        std::array<std::vector<Entry>, level1_slots> _level1;
+        std::vector<Entry> _overflow;
+        std::vector<Entry> _scratch;
+        uint64_t _now = 0;
+        size_t _size = 0;
+    };
+
+    template<typename F>
+    void Timer_Wheel::tick(F&& expired)
+    {
+        ++_now;
+        if ((_now & (level0_slots - 1)) == 0)
+            cascade();
+
+        auto& slot = _level0[_now & (level0_slots - 1)];
+        if (slot.empty())
+            return;
+
+        _scratch.swap(slot);
+        for (auto&& entry : _scratch)
+        {
+            --_size;
+            expired(entry.id);
+        }
+        _scratch.clear();
+    }
+}
@@ -1,6 +1,8 @@
 #include "ts_client.hpp"
 
+#include "async_log.hpp"
 #include "helpers.hpp"
+#include "../common/pacer.h"
 
 #include <teamspeak/clientlib.h>
 #include <teamspeak/public_errors.h>
@@ -8,11 +10,41 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <initializer_list>
 #include <iostream>
 #include <memory>
 
 namespace com::teamspeak
 {
+    namespace
+    {
+        /* Copies a possibly null C string, truncated to fit */
+        template<size_t N>
+        void copy_text(char (&destination)[N], const char* source)
+        {
+            auto i = size_t{ 0 };
+            for (; source && source[i] && i + 1 < N; ++i)
+                destination[i] = source[i];
+            destination[i] = '\0';
+        }
+
+        void post_client_move(uint64_t connection_id, uint16_t client_id, uint64_t old_channel_id, uint64_t new_channel_id, int visibility)
+        {
+            if (!TS_Client::ts_client)
+                return;
+            auto&& events = TS_Client::ts_client->_events;
+            auto timer = Residency_Timer(events);
+
+            auto event = Event{ Event_Type::Client_Move };
+            event.connection_id = connection_id;
+            event.client_id = client_id;
+            event.old_channel_id = old_channel_id;
+            event.new_channel_id = new_channel_id;
+            event.status = visibility;
+            events.post(event);
+        }
+    }
+
     /*static*/ std::unique_ptr<TS_Client> TS_Client::ts_client;
 
     TS_Client::TS_Client(std::string_view path, bool& success)
@@ -39,38 +71,40 @@ namespace com::teamspeak
         */
         funcs.onConnectStatusChangeEvent = [](uint64_t connection_id, int32_t status, uint32_t error)
         {
-            if (TS_Client::ts_client)
-                TS_Client::ts_client->on_connect_status_change(connection_id, static_cast<ConnectStatus>(status), error);
+            if (!TS_Client::ts_client)
+                return;
+            auto&& events = TS_Client::ts_client->_events;
+            auto timer = Residency_Timer(events);
+
+            auto event = Event{ Event_Type::Connect_Status };
+            event.connection_id = connection_id;
+            event.status = status;
+            event.error = error;
+            events.post_reliable(event);  // a lost disconnect would never be reconnected
         };
         funcs.onClientMoveEvent = [](uint64 connection_id, anyID clientID, uint64 oldChannelID, uint64 newChannelID, int visibility, const char* /*msg*/)
         {
-            if (TS_Client::ts_client)
-                TS_Client::ts_client->on_client_move_common(connection_id, clientID, oldChannelID, newChannelID, static_cast<Visibility>(visibility));
+            post_client_move(connection_id, clientID, oldChannelID, newChannelID, visibility);
         };
         funcs.onClientMoveSubscriptionEvent = [](uint64 connection_id, anyID clientID, uint64 oldChannelID, uint64 newChannelID, int visibility)
         {
-            if (TS_Client::ts_client)
-                TS_Client::ts_client->on_client_move_common(connection_id, clientID, oldChannelID, newChannelID, static_cast<Visibility>(visibility));
+            post_client_move(connection_id, clientID, oldChannelID, newChannelID, visibility);
         };
         funcs.onClientMoveTimeoutEvent = [](uint64 connection_id, anyID clientID, uint64 oldChannelID, uint64 newChannelID, int visibility, const char* /*msg*/)
         {
-            if (TS_Client::ts_client)
-                TS_Client::ts_client->on_client_move_common(connection_id, clientID, oldChannelID, newChannelID, static_cast<Visibility>(visibility));
+            post_client_move(connection_id, clientID, oldChannelID, newChannelID, visibility);
         };
         funcs.onClientMoveMovedEvent = [](uint64 connection_id, anyID clientID, uint64 oldChannelID, uint64 newChannelID, int visibility, anyID /*moverID*/, const char* /*moverName*/, const char* /*moverUniqueIdentifier*/, const char* /*msg*/)
         {
-            if (TS_Client::ts_client)
-                TS_Client::ts_client->on_client_move_common(connection_id, clientID, oldChannelID, newChannelID, static_cast<Visibility>(visibility));
+            post_client_move(connection_id, clientID, oldChannelID, newChannelID, visibility);
         };
         funcs.onClientKickFromChannelEvent = [](uint64 connection_id, anyID clientID, uint64 oldChannelID, uint64 newChannelID, int visibility, anyID /*kickerID*/, const char* /*kickerName*/, const char* /*kickerUniqueIdentifier*/, const char* /*msg*/)
         {
-            if (TS_Client::ts_client)
-                TS_Client::ts_client->on_client_move_common(connection_id, clientID, oldChannelID, newChannelID, static_cast<Visibility>(visibility));
+            post_client_move(connection_id, clientID, oldChannelID, newChannelID, visibility);
         };
         funcs.onClientKickFromServerEvent = [](uint64 connection_id, anyID clientID, uint64 oldChannelID, uint64 newChannelID, int visibility, anyID /*kickerID */, const char* /*kickerName*/, const char* /*kickerUniqueIdentifier*/, const char* /*msg*/)
         {
-            if (TS_Client::ts_client)
-                TS_Client::ts_client->on_client_move_common(connection_id, clientID, oldChannelID, newChannelID, static_cast<Visibility>(visibility));
+            post_client_move(connection_id, clientID, oldChannelID, newChannelID, visibility);
         };
         /*
         * This event is called when a client starts or stops talking.
@@ -81,74 +115,85 @@ namespace com::teamspeak
         *   isReceivedWhisper         - 1 if this event was caused by whispering, 0 if caused by normal talking
         *   clientID                  - ID of the client who announced the talk status change
         */
-        funcs.onTalkStatusChangeEvent = [](uint64 serverConnectionHandlerID, int status, int isReceivedWhisper, anyID clientID)
+        funcs.onTalkStatusChangeEvent = [](uint64 serverConnectionHandlerID, int status, int /*isReceivedWhisper*/, anyID clientID)
         {
-            char* name = nullptr;
-            /* Query client nickname from ID */
-            if (ts3client_getClientVariableAsString(serverConnectionHandlerID, clientID, CLIENT_NICKNAME, &name) != ERROR_ok)
+            if (!TS_Client::ts_client)
                 return;
+            auto&& events = TS_Client::ts_client->_events;
+            auto timer = Residency_Timer(events);
 
-            auto status_str = std::string();
-            switch (status)
-            {
-            case TalkStatus::STATUS_TALKING:
-                status_str = "starts";
-                break;
-            case TalkStatus::STATUS_NOT_TALKING:
-                status_str = "stops";
-                break;
-            case TalkStatus::STATUS_TALKING_WHILE_DISABLED:
-                status_str = "starts (while disabled)";
-                break;
-            default:
-                break;
-            }
-            std::cout << "Client " << name << " " << status_str << " talking." << std::endl;
-            /* Release dynamically allocated memory only if function succeeded */
-            ts3client_freeMemory(name);
+            auto event = Event{ Event_Type::Talk_Status };
+            event.connection_id = serverConnectionHandlerID;
+            event.client_id = clientID;
+            event.status = status;
+            events.post(event);
         };
         funcs.onServerErrorEvent = [](uint64 connection_id, const char* error_msg, uint32_t error, const char* /*return_code*/, const char* extra_msg)
         {
-            auto msg = std::string("onServerError: ");
-            if (error_msg)
-                msg += error_msg;
-            
-            if (extra_msg)
-            {
-                auto extra = std::string(extra_msg);
-                if (!extra.empty())
-                    msg += " Extra Msg: " + extra;
-            }
-            if (error == ERROR_ok)
-                ts3client_logMessage(msg.c_str(), LogLevel::LogLevel_DEBUG, "", connection_id);
-            else
-                print_error(error, msg, connection_id);
+            if (!TS_Client::ts_client)
+                return;
+            auto&& events = TS_Client::ts_client->_events;
+            auto timer = Residency_Timer(events);
+
+            auto event = Event{ Event_Type::Server_Error };
+            event.connection_id = connection_id;
+            event.error = error;
+            copy_text(event.message, error_msg);
+            copy_text(event.extra_message, extra_msg);
+            events.post(event);
+        };
+        /*
+        * Called with every client's decoded audio before it is mixed into the playback.
+        * The samples are only copied, so the SDK's own mix stays untouched.
+        */
+        funcs.onEditPlaybackVoiceDataEvent = [](uint64 connection_id, anyID client_id, short* samples, int sample_count, int channels)
+        {
+            if (!TS_Client::ts_client || !TS_Client::ts_client->_speakers)
+                return;
+            auto timer = Residency_Timer(TS_Client::ts_client->_events);
+            TS_Client::ts_client->_speakers->push(connection_id, client_id, samples, sample_count, channels);
         };
         funcs.onIgnoredWhisperEvent = [](uint64 connection_id, anyID client_id)
         {
-            print_error(ts3client_allowWhispersFrom(connection_id, client_id), "Error allowing whisper", connection_id);
+            if (!TS_Client::ts_client)
+                return;
+            auto&& events = TS_Client::ts_client->_events;
+            auto timer = Residency_Timer(events);
+
+            auto event = Event{ Event_Type::Ignored_Whisper };
+            event.connection_id = connection_id;
+            event.client_id = client_id;
+            events.post(event);
         };
 
+        /* Everything the callbacks post is handled here, where blocking doesn't stall the SDK */
+        _event_worker_running = true;
+        _event_worker = std::thread([this]()
+            {
+                auto pacer = Pacer();
+                pacerInit(&pacer, 10);
+                while (_event_worker_running)
+                {
+                    pacerWait(&pacer);
+                    _events.consume([this](const Event& event) { process(event); });
+                }
+            });
+
         if (auto error = ts3client_initClientLib(&funcs, nullptr, LogType_FILE | LogType_CONSOLE | LogType_USERLOGGING, nullptr, path.data()); error != ERROR_ok)
         {
             print_error(error, "Error initialzing clientlib", 0);
             success = false;
         }
         _funcs = funcs;
-
-        if (success)
-        {
-            auto error = uint32_t{ ERROR_ok };
-            _custom_device = std::make_unique<Custom_Device>(error);
-            if (ERROR_ok != error)
-                _custom_device = {};
-
-            success = ERROR_ok == error;
-        }
     }
 
     TS_Client::~TS_Client()
     {
+        _event_worker_running = false;
+        if (_event_worker.joinable())
+            _event_worker.join();
+        Async_Log::instance().stop();  // the log thread writes through the client lib
+
         if (auto error = ts3client_destroyClientLib(); error != ERROR_ok)
         {
             print_error(error, "Failed to destroy clientlib", 0);
@@ -170,6 +215,7 @@ namespace com::teamspeak
             return false;
 
         TS_Client::ts_client.swap(result);
+        Async_Log::instance().start();
         return true;
     }
 
@@ -188,8 +234,76 @@ namespace com::teamspeak
         return true;
     }
 
+    void TS_Client::process(const Event& event)
+    {
+        switch (event.type)
+        {
+        case Event_Type::Connect_Status:
+            on_connect_status_change(event.connection_id, static_cast<ConnectStatus>(event.status), event.error);
+            break;
+        case Event_Type::Client_Move:
+            on_client_move_common(event.connection_id, event.client_id, event.old_channel_id, event.new_channel_id, static_cast<Visibility>(event.status));
+            break;
+        case Event_Type::Talk_Status:
+            on_talk_status_change(event.connection_id, event.client_id, static_cast<TalkStatus>(event.status));
+            break;
+        case Event_Type::Server_Error:
+            on_server_error(event.connection_id, event.error, event.message, event.extra_message);
+            break;
+        case Event_Type::Ignored_Whisper:
+            print_error(ts3client_allowWhispersFrom(event.connection_id, event.client_id), "Error allowing whisper", event.connection_id);
+            break;
+        }
+    }
+
+    void TS_Client::on_talk_status_change(uint64_t connection_id, uint16_t client_id, TalkStatus status)
+    {
+        char* name = nullptr;
+        /* Query client nickname from ID */
+        if (ts3client_getClientVariableAsString(connection_id, client_id, CLIENT_NICKNAME, &name) != ERROR_ok)
+            return;
+
+        auto status_str = std::string();
+        switch (status)
+        {
+        case TalkStatus::STATUS_TALKING:
+            status_str = "starts";
+            break;
+        case TalkStatus::STATUS_NOT_TALKING:
+            status_str = "stops";
+            break;
+        case TalkStatus::STATUS_TALKING_WHILE_DISABLED:
+            status_str = "starts (while disabled)";
+            break;
+        default:
+            break;
+        }
+        std::cout << "Client " << name << " " << status_str << " talking." << std::endl;
+        /* Release dynamically allocated memory only if function succeeded */
+        ts3client_freeMemory(name);
+    }
+
+    void TS_Client::on_server_error(uint64_t connection_id, uint32_t error, std::string_view error_msg, std::string_view extra_msg)
+    {
+        auto msg = std::string("onServerError: ");
+        msg += error_msg;
+
+        if (!extra_msg.empty())
+        {
+            msg += " Extra Msg: ";
+            msg += extra_msg;
+        }
+        if (error == ERROR_ok)
+            ts3client_logMessage(msg.c_str(), LogLevel::LogLevel_DEBUG, "", connection_id);
+        else
+            print_error(error, msg, connection_id);
+    }
+
     void TS_Client::on_client_move_common(uint64_t connection_id, uint16_t client_id, uint64_t oldChannelID, uint64_t newChannelID, Visibility visibility)
     {
+        /* client left the server, its speaker queue can be reused */
+        if (_speakers && newChannelID == 0)
+            _speakers->release(connection_id, client_id);
     }
 
     void TS_Client::on_connect_status_change(uint64_t connection_id, ConnectStatus status, uint32_t error)
@@ -205,17 +319,29 @@ namespace com::teamspeak
         }
         print_error(error, "onConnectStatusChange", connection_id);
 
+        if (_speakers && status == STATUS_DISCONNECTED)
+            _speakers->release_connection(connection_id);
+
         if (_shutting_down)
             return;
 
         /* pass the event on to the connection instance */
-        if (auto it = std::find_if(std::begin(_connections), std::end(_connections), [connection_id](auto&& connection)
-            {
-                return connection && connection_id == connection->_connection_id;
-            }); it != std::end(_connections))
-        {
-            auto&& connection = *it;
+        if (auto* connection = find_connection(connection_id))
             connection->on_connect_status_change(status, error);
+    }
+
+    Connection_Handler* TS_Client::find_connection(uint64_t connection_id)
+    {
+        for (auto* connections : { &_listeners, &_broadcasters })
+        {
+            if (auto it = std::find_if(std::begin(*connections), std::end(*connections), [connection_id](auto&& connection)
+                {
+                    return connection && connection_id == connection->_connection_id;
+                }); it != std::end(*connections))
+            {
+                return it->get();
+            }
         }
+        return nullptr;
     }
 }
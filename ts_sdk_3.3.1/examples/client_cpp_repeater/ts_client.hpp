@@ -2,14 +2,19 @@
 
 #include "connection_handler.hpp"
 #include "custom_device.hpp"
+#include "event_queue.hpp"
+#include "reconnect_scheduler.hpp"
+#include "speaker_queues.hpp"
 
 #include <teamspeak/public_definitions.h>
 
-#include <array>
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <vector>
 
 namespace com::teamspeak
 {
@@ -23,17 +28,30 @@ namespace com::teamspeak
 
         bool log_clientlib_version();
 
+        /* Event worker thread. The SDK callbacks only post events, they are handled here. */
+        void process(const Event& event);
         void on_client_move_common(uint64_t connection_id, uint16_t client_id, uint64_t old_channel_id, uint64_t new_channel_id, Visibility visibility);
         void on_connect_status_change(uint64_t connection_id, ConnectStatus status, uint32_t error);
+        void on_talk_status_change(uint64_t connection_id, uint16_t client_id, TalkStatus status);
+        void on_server_error(uint64_t connection_id, uint32_t error, std::string_view error_msg, std::string_view extra_msg);
+
+        /* The listener or broadcaster of connection_id, nullptr if there is none */
+        Connection_Handler* find_connection(uint64_t connection_id);
 
         ClientUIFunctions _funcs;
+        Event_Queue _events;  // posted to by the SDK callbacks
         std::string _identity = "";
-        std::array<std::unique_ptr<Connection_Handler>, 2> _connections;
-        bool _shutting_down = false;
+        std::vector<std::unique_ptr<Connection_Handler>> _listeners;
+        std::vector<std::unique_ptr<Custom_Device>> _listen_devices;  // one playback device per listener
+        std::vector<std::unique_ptr<Connection_Handler>> _broadcasters;
+        std::vector<std::unique_ptr<Custom_Device>> _broadcast_devices;  // one capture device per broadcaster
+        std::unique_ptr<Speaker_Queues> _speakers;  // set to copy every speaker's decoded audio into its own queue
+        std::unique_ptr<Reconnect_Scheduler> _reconnects;  // declared after the connections, so it's gone before them
+        std::atomic<bool> _shutting_down{ false };
+        std::atomic<bool> _event_worker_running{ false };
+        std::thread _event_worker;
         static constexpr bool _do_autoreconnect{ true };
-    private:
-        std::unique_ptr<Custom_Device> _custom_device;
-    public:
+
         static std::unique_ptr<TS_Client> ts_client;
     };
 }
\ No newline at end of file
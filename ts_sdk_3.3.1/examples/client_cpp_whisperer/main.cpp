@@ -18,8 +18,12 @@
 #include <teamspeak/public_errors.h>
 #include <teamspeak/clientlib.h>
 
-#include <algorithm>
+#include "whisper_updater.hpp"
+
+#include <chrono>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #ifdef _WIN32
@@ -31,17 +35,9 @@
 
 namespace {
     auto my_id = anyID{ 0 };
+    std::unique_ptr<com::teamspeak::Whisper_Updater> whisper_updater;  // whispers to everyone visible but us
     constexpr const auto* kWhisperApp = "Whisperer";
-
-    // for logging
-    auto client_id_array_to_string(const std::vector<anyID>& client_ids)->std::string
-    {
-        auto result = std::string();
-        for (const auto client_id : client_ids)
-            result += std::to_string(client_id);
-
-        return result;
-    }
+    constexpr auto kWhisperWindow = std::chrono::milliseconds(50);  // changes within it are sent as one list
 
     void print_error(uint32_t error, const std::string& msg, uint64 connection_id = 0)
     {
@@ -59,71 +55,82 @@ namespace {
         ts3client_logMessage(msg.c_str(), LogLevel_ERROR, kWhisperApp, connection_id);
     }
 
-    std::vector<anyID> get_client_ids(uint64 connection_id)
+    /* Fetches the full client list and their channels once, from then on the move events keep the index up to date */
+    void reset_whisper_targets(uint64 connection_id)
     {
+        auto own_channel_id = uint64{ 0 };
+        if (auto error = ts3client_getChannelOfClient(connection_id, my_id, &own_channel_id); error != ERROR_ok)
+            print_error(error, "Couldn't get own channel.", connection_id);
+
         anyID* client_ids = nullptr;
         if (auto error = ts3client_getClientList(connection_id, &client_ids); error != ERROR_ok)
         {
             print_error(error, "Couldn't get client list.", connection_id);
-            return {};
+            whisper_updater->clear();
+            return;
+        }
+        auto clients = std::vector<std::pair<anyID, uint64>>();
+        for (auto i = size_t{ 0 }; client_ids[i]; ++i)
+        {
+            auto channel_id = uint64{ 0 };
+            if (ts3client_getChannelOfClient(connection_id, client_ids[i], &channel_id) == ERROR_ok)
+                clients.emplace_back(client_ids[i], channel_id);
         }
-        auto result = std::vector<anyID>{};
-        for (auto i = size_t{ 0 }; client_ids[i]; i++)
-            result.push_back(client_ids[i]);
-
         ts3client_freeMemory(client_ids);
-        return result;
-    }
 
-    void filter_own_client_id(uint64 connection_id, std::vector<anyID>& client_ids)
-    {
-        if (auto it = std::find(std::begin(client_ids), std::end(client_ids), my_id); it != std::end(client_ids))
-            client_ids.erase(it);
+        whisper_updater->reset(connection_id, my_id, own_channel_id, clients);
     }
 
-    void set_whisper_to_all_visible(uint64 connection_id)
+    /* Sends the targets to the server, input is only active while there is someone to whisper to. Called by the updater. */
+    bool send_whisper_targets(uint64 connection_id, const com::teamspeak::Whisper_Updater::Plan& plan, bool was_empty)
     {
-        auto target_client_ids = get_client_ids(connection_id);
-        filter_own_client_id(connection_id, target_client_ids);
-        if (target_client_ids.size() > 0)
+        if (!plan.empty())
         {
-            target_client_ids.push_back(0);
-            auto whisper_log = std::string("Whisperlist set to ") + client_id_array_to_string(target_client_ids);
-            if (auto error = ts3client_requestClientSetWhisperList(connection_id, 0, nullptr, target_client_ids.data(), nullptr); error != ERROR_ok)
+            auto whisper_log = std::string("Whisperlist set to ") + std::to_string(plan.channel_ids.size() - 1) + " channels and "
+                + std::to_string(plan.client_ids.size() - 1) + " clients";
+            if (auto error = ts3client_requestClientSetWhisperList(connection_id, 0, plan.channel_ids.data(), plan.client_ids.data(), nullptr); error != ERROR_ok)
             {
                 print_error(error, whisper_log + ", but FAILED", connection_id);
-                return;
+                return false;
             }
             ts3client_logMessage(whisper_log.c_str(), LogLevel_INFO, kWhisperApp, connection_id);
 
+            if (!was_empty)
+                return true;
+
             if (auto error = ts3client_setClientSelfVariableAsInt(connection_id, CLIENT_INPUT_DEACTIVATED, InputDeactivationStatus::INPUT_ACTIVE); error != ERROR_ok && error != ERROR_ok_no_update)
             {
                 print_error(error, "Couldn't activate input.", connection_id);
-                return;
+                return false;
             }
             else if (error == ERROR_ok)
                 ts3client_logMessage("Activated Input for whispering.", LogLevel_INFO, kWhisperApp, connection_id);
 
-            return;
+            return true;
         }
 
         if (auto error = ts3client_setClientSelfVariableAsInt(connection_id, CLIENT_INPUT_DEACTIVATED, InputDeactivationStatus::INPUT_DEACTIVATED); error != ERROR_ok && error != ERROR_ok_no_update)
         {
             print_error(error, "Couldn't deactivate input.", connection_id);
+            return false;
         }
-        else
-        {
-            ts3client_logMessage("Deactivated Input: No whisper targets.", LogLevel_INFO, kWhisperApp, connection_id);
-        }
+        ts3client_logMessage("Deactivated Input: No whisper targets.", LogLevel_INFO, kWhisperApp, connection_id);
+        return true;
     }
 
     void on_client_move_common(uint64 connection_id, anyID client_id, uint64 oldChannelID, uint64 newChannelID, int visibility)
     {
-        if (visibility == Visibility::ENTER_VISIBILITY || visibility == Visibility::LEAVE_VISIBILITY)
-        {
-            if (!(newChannelID == 0 && client_id == my_id))
-                set_whisper_to_all_visible(connection_id);
-        }
+        /* moves before STATUS_CONNECTION_ESTABLISHED are dropped by the updater, the reset's client list has them */
+        if (!whisper_updater || (client_id == my_id && newChannelID == 0))
+            return;
+
+        /* only the one client moved, the updater sends the targets once the changes settled */
+        if (visibility == Visibility::ENTER_VISIBILITY)
+            whisper_updater->move(connection_id, client_id, 0, newChannelID);
+        else if (visibility == Visibility::LEAVE_VISIBILITY)
+            whisper_updater->move(connection_id, client_id, oldChannelID, 0);
+        else
+            whisper_updater->move(connection_id, client_id, oldChannelID, newChannelID);
     }
 }
 
@@ -152,8 +159,17 @@ void onConnectStatusChangeEvent(uint64 serverConnectionHandlerID, int newStatus,
             return;
         }
     }
+    else if (newStatus == STATUS_CONNECTION_ESTABLISHED && whisper_updater)
+    {
+        /* the clients already visible when we joined */
+        reset_whisper_targets(serverConnectionHandlerID);
+    }
     else if (newStatus == STATUS_DISCONNECTED)
+    {
         my_id = 0;
+        if (whisper_updater)
+            whisper_updater->clear();
+    }
 }
 
 /*
@@ -302,6 +318,8 @@ int main(int argc, char **argv) {
         print_error(ts3client_allowWhispersFrom(connection_id, client_id), "Error allowing whisper", connection_id);
     };
 
+    whisper_updater = std::make_unique<com::teamspeak::Whisper_Updater>(kWhisperWindow, send_whisper_targets);
+
     /* Initialize client lib with callbacks */
     /* Resource path points to the SDK\bin directory to locate the soundbackends*/
     path = programPath(argv[0]);
@@ -392,6 +410,18 @@ int main(int argc, char **argv) {
 
     SLEEP(200);
 
+    {
+        auto stats = whisper_updater->stats();
+        auto windows = stats.commands + stats.skipped;
+        printf("whisper lists: %llu moves, %llu changed the targets, sent as %llu commands (%llu saved, %llu windows ended unchanged) of %llu channel and %llu client ids in total, added latency avg %.1f ms, max %.1f ms\n",
+            (unsigned long long)stats.moves, (unsigned long long)stats.changes, (unsigned long long)stats.commands,
+            (unsigned long long)(stats.moves > stats.commands ? stats.moves - stats.commands : 0), (unsigned long long)stats.skipped,
+            (unsigned long long)stats.channel_ids_sent, (unsigned long long)stats.client_ids_sent,
+            windows ? std::chrono::duration<double, std::milli>(stats.total_latency).count() / windows : 0.0,
+            std::chrono::duration<double, std::milli>(stats.max_latency).count());
+        whisper_updater.reset();  // no more sends from here on
+    }
+
     /* Destroy server connection handler */
     if(auto error = ts3client_destroyServerConnectionHandler(scHandlerID); error != ERROR_ok) {
         printf("Error destroying clientlib: %d\n", error);
@@ -2,4 +2,10 @@ message("generating TeamSpeak SDK sample ${TS_SDK_SAMPLE}")
 
 set (TS_SAMPLE_SRC
     "${CMAKE_CURRENT_LIST_DIR}/main.cpp"
+    "${CMAKE_CURRENT_LIST_DIR}/whisper_targets.hpp"
+    "${CMAKE_CURRENT_LIST_DIR}/whisper_targets.cpp"
+    "${CMAKE_CURRENT_LIST_DIR}/whisper_planner.hpp"
+    "${CMAKE_CURRENT_LIST_DIR}/whisper_planner.cpp"
+    "${CMAKE_CURRENT_LIST_DIR}/whisper_updater.hpp"
+    "${CMAKE_CURRENT_LIST_DIR}/whisper_updater.cpp"
 )
@@ -0,0 +1,103 @@
+#include "whisper_planner.hpp"
+
+#include <algorithm>
+
+namespace com::teamspeak
+{
+    Whisper_Planner::Whisper_Planner()
+        : _channels{ 0 }
+    {}
+
+    void Whisper_Planner::reset(anyID own_id, uint64 own_channel_id)
+    {
+        _own_id = own_id;
+        _own_channel_id = own_channel_id;
+        _index.clear();
+        _channels.assign(1, 0);
+    }
+
+    const anyID* Whisper_Planner::clients() const
+    {
+        const auto it = _index.find(_own_channel_id);
+        return it != std::end(_index) ? it->second.data() : _no_clients.data();
+    }
+
+    size_t Whisper_Planner::client_count() const
+    {
+        const auto it = _index.find(_own_channel_id);
+        return it != std::end(_index) ? it->second.size() : 0;
+    }
+
+    bool Whisper_Planner::move(anyID client_id, uint64 old_channel_id, uint64 new_channel_id)
+    {
+        if (client_id == _own_id)
+        {
+            if (new_channel_id == 0 || new_channel_id == _own_channel_id)
+                return false;
+
+            // our old channel becomes a whole channel target, the new one a partial one
+            _own_channel_id = new_channel_id;
+            rebuild_channels();
+            return true;
+        }
+
+        auto changed = false;
+        if (old_channel_id != 0)
+        {
+            if (auto it = _index.find(old_channel_id); it != std::end(_index) && it->second.remove(client_id))
+            {
+                if (old_channel_id == _own_channel_id)
+                {
+                    changed = true;
+                }
+                else if (it->second.empty())
+                {
+                    _index.erase(it);
+                    remove_channel(old_channel_id);  // nobody left to whisper to in there
+                    changed = true;
+                }
+            }
+        }
+        if (new_channel_id != 0)
+        {
+            auto [it, created] = _index.try_emplace(new_channel_id);
+            if (created)
+                it->second.reset(_own_id, nullptr);
+            if (it->second.add(client_id))
+            {
+                if (new_channel_id == _own_channel_id)
+                    changed = true;
+                else if (it->second.size() == 1)
+                {
+                    add_channel(new_channel_id);  // first one to whisper to in there
+                    changed = true;
+                }
+            }
+        }
+        return changed;
+    }
+
+    void Whisper_Planner::add_channel(uint64 channel_id)
+    {
+        const auto end = std::end(_channels) - 1;  // before the terminator
+        _channels.insert(std::lower_bound(std::begin(_channels), end, channel_id), channel_id);
+    }
+
+    void Whisper_Planner::remove_channel(uint64 channel_id)
+    {
+        const auto end = std::end(_channels) - 1;
+        if (auto it = std::lower_bound(std::begin(_channels), end, channel_id); it != end && *it == channel_id)
+            _channels.erase(it);
+    }
+
+    void Whisper_Planner::rebuild_channels()
+    {
+        _channels.clear();
+        for (auto&& [channel_id, clients] : _index)
+        {
+            if (channel_id != _own_channel_id && !clients.empty())
+                _channels.push_back(channel_id);
+        }
+        _channels.push_back(0);
+    }
+}
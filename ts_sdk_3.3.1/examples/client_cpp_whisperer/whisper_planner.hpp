@@ -0,0 +1,56 @@
+#pragma once
+
+#include "whisper_targets.hpp"
+
+#include <teamspeak/public_definitions.h>
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+namespace com::teamspeak
+{
+    /*
+    * Plans the whisper list for "everyone visible but us" from a local channel -> clients index.
+    *
+    * Every other channel with visible clients is whispered to as a whole, by its channel id, so
+    * clients joining or leaving it don't need a new list. Only our own channel is partial, we must
+    * not be a target, its other clients are listed by id. The list changes when a channel gains
+    * its first or loses its last visible client, when someone enters or leaves our channel, and
+    * when we move.
+    */
+    class Whisper_Planner
+    {
+    public:
+        Whisper_Planner();
+
+        /* Empties the index, the plan is empty until clients are moved in */
+        void reset(anyID own_id, uint64 own_channel_id);
+        void clear() { reset(0, 0); }
+
+        /*
+        * A client moved from old_channel_id to new_channel_id, 0 standing for "not visible", e.g.
+        * for a client entering visibility or leaving the server. Moves of our own client change our
+        * channel. Returns true if the plan changed.
+        */
+        bool move(anyID client_id, uint64 old_channel_id, uint64 new_channel_id);
+
+        /* Zero terminated, for ts3client_requestClientSetWhisperList */
+        const uint64* channels() const { return _channels.data(); }
+        const anyID* clients() const;
+        size_t channel_count() const { return _channels.size() - 1; }
+        size_t client_count() const;
+        bool empty() const { return channel_count() == 0 && client_count() == 0; }
+
+    private:
+        void add_channel(uint64 channel_id);
+        void remove_channel(uint64 channel_id);
+        void rebuild_channels();
+
+        anyID _own_id = 0;
+        uint64 _own_channel_id = 0;
+        std::map<uint64, Whisper_Targets> _index;  // visible clients but us, per channel
+        std::vector<uint64> _channels;  // sorted, followed by a 0 terminator
+        Whisper_Targets _no_clients;
+    };
+}
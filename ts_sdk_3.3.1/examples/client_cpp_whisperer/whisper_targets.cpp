@@ -0,0 +1,55 @@
+#include "whisper_targets.hpp"
+
+#include <algorithm>
+
+namespace com::teamspeak
+{
+    Whisper_Targets::Whisper_Targets()
+        : _ids{ 0 }
+    {}
+
+    void Whisper_Targets::reset(anyID own_id, const anyID* client_ids)
+    {
+        _own_id = own_id;
+        _ids.clear();
+        for (auto i = size_t{ 0 }; client_ids && client_ids[i]; ++i)
+        {
+            if (client_ids[i] != own_id)
+                _ids.push_back(client_ids[i]);
+        }
+        std::sort(std::begin(_ids), std::end(_ids));
+        _ids.erase(std::unique(std::begin(_ids), std::end(_ids)), std::end(_ids));
+        _ids.push_back(0);
+    }
+
+    void Whisper_Targets::clear()
+    {
+        _own_id = 0;
+        _ids.assign(1, 0);
+    }
+
+    bool Whisper_Targets::add(anyID client_id)
+    {
+        if (client_id == 0 || client_id == _own_id)
+            return false;
+
+        const auto end = std::end(_ids) - 1;  // before the terminator
+        const auto it = std::lower_bound(std::begin(_ids), end, client_id);
+        if (it != end && *it == client_id)
+            return false;
+
+        _ids.insert(it, client_id);
+        return true;
+    }
+
+    bool Whisper_Targets::remove(anyID client_id)
+    {
+        const auto end = std::end(_ids) - 1;
+        const auto it = std::lower_bound(std::begin(_ids), end, client_id);
+        if (it == end || *it != client_id)
+            return false;
+
+        _ids.erase(it);
+        return true;
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <teamspeak/public_definitions.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace com::teamspeak
+{
+    /*
+    * A set of clients we whisper to, kept up to date from move events instead of refetching the client list.
+    *
+    * The ids are kept sorted and zero terminated in one array, so data() can be handed to
+    * ts3client_requestClientSetWhisperList as is. Lookups are a binary search, an insert or erase
+    * shifts the 2 byte ids behind it with one memmove.
+    */
+    class Whisper_Targets
+    {
+    public:
+        Whisper_Targets();
+
+        /* Replaces the targets by a zero terminated client list, own_id is left out now and later */
+        void reset(anyID own_id, const anyID* client_ids);
+        void clear();
+
+        /* Return true if the targets changed */
+        bool add(anyID client_id);
+        bool remove(anyID client_id);
+
+        const anyID* data() const { return _ids.data(); }
+        size_t size() const { return _ids.size() - 1; }
+        bool empty() const { return size() == 0; }
+
+    private:
+        std::vector<anyID> _ids;  // sorted, followed by a 0 terminator
+        anyID _own_id = 0;
+    };
+}
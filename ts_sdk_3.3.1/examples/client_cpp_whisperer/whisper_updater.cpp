@@ -0,0 +1,119 @@
+#include "whisper_updater.hpp"
+
+#include <algorithm>
+
+namespace com::teamspeak
+{
+    Whisper_Updater::Whisper_Updater(std::chrono::milliseconds window, Send send)
+        : _window(window)
+        , _send(std::move(send))
+        , _thread([this]() { run(); })
+    {}
+
+    Whisper_Updater::~Whisper_Updater()
+    {
+        {
+            auto lock = std::lock_guard(_mutex);
+            _stopping = true;
+        }
+        _wakeup.notify_one();
+        _thread.join();
+    }
+
+    void Whisper_Updater::reset(uint64 connection_id, anyID own_id, uint64 own_channel_id, const std::vector<std::pair<anyID, uint64>>& clients)
+    {
+        auto lock = std::lock_guard(_mutex);
+        _planner.reset(own_id, own_channel_id);
+        for (auto&& [client_id, channel_id] : clients)
+            _planner.move(client_id, 0, channel_id);
+        _sent_valid = false;  // send even if unchanged, the server doesn't know the plan yet
+        _connection_id = connection_id;
+        changed_locked();
+    }
+
+    void Whisper_Updater::clear()
+    {
+        auto lock = std::lock_guard(_mutex);
+        _planner.clear();
+        _sent = Plan();
+        _sent_valid = false;
+        _pending = false;
+        _connection_id = 0;
+    }
+
+    void Whisper_Updater::move(uint64 connection_id, anyID client_id, uint64 old_channel_id, uint64 new_channel_id)
+    {
+        auto lock = std::lock_guard(_mutex);
+        // before the reset the planner doesn't know our own id and channel yet
+        if (connection_id == 0 || connection_id != _connection_id)
+            return;
+
+        ++_stats.moves;
+        if (_planner.move(client_id, old_channel_id, new_channel_id))
+            changed_locked();
+    }
+
+    void Whisper_Updater::changed_locked()
+    {
+        ++_stats.changes;
+        if (_pending)
+            return;  // joins the open window
+
+        _pending = true;
+        _window_start = Clock::now();
+        _wakeup.notify_one();
+    }
+
+    void Whisper_Updater::run()
+    {
+        auto lock = std::unique_lock(_mutex);
+        auto plan = Plan();
+        while (!_stopping)
+        {
+            if (!_pending)
+            {
+                _wakeup.wait(lock);
+                continue;
+            }
+            if (const auto due = _window_start + _window; Clock::now() < due)
+            {
+                _wakeup.wait_until(lock, due);
+                continue;
+            }
+
+            _pending = false;
+            const auto latency = Clock::now() - _window_start;
+            _stats.total_latency += latency;
+            _stats.max_latency = std::max(_stats.max_latency, latency);
+
+            plan.channel_ids.assign(_planner.channels(), _planner.channels() + _planner.channel_count() + 1);
+            plan.client_ids.assign(_planner.clients(), _planner.clients() + _planner.client_count() + 1);
+            if (_sent_valid && plan == _sent)
+            {
+                ++_stats.skipped;
+                continue;
+            }
+
+            const auto was_empty = !_sent_valid || _sent.empty();
+            const auto connection_id = _connection_id;
+            _sent = plan;
+            _sent_valid = true;
+            ++_stats.commands;
+            _stats.channel_ids_sent += plan.channel_ids.size() - 1;
+            _stats.client_ids_sent += plan.client_ids.size() - 1;
+
+            // never call into the SDK with the lock held, the callbacks take it
+            lock.unlock();
+            const auto sent = _send(connection_id, plan, was_empty);
+            lock.lock();
+            if (!sent)
+                _sent_valid = false;
+        }
+    }
+
+    Whisper_Updater::Stats Whisper_Updater::stats()
+    {
+        auto lock = std::lock_guard(_mutex);
+        return _stats;
+    }
+}
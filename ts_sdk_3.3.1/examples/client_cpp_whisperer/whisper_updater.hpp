@@ -0,0 +1,94 @@
+#pragma once
+
+#include "whisper_planner.hpp"
+
+#include <teamspeak/public_definitions.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace com::teamspeak
+{
+    /*
+    * Coalesces whisper target changes into as few server commands as possible.
+    *
+    * The targets are planned by Whisper_Planner. The first change of the plan after a send opens a
+    * window, all changes within it are collected and the plan as it is at its end is sent once from
+    * the updater's thread. If it ended up as it was last sent, nothing is sent at all. This bounds
+    * the command rate during mass moves to one per window, at the cost of up to one window of latency.
+    */
+    class Whisper_Updater
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+        struct Plan
+        {
+            std::vector<uint64> channel_ids;  // both zero terminated
+            std::vector<anyID> client_ids;
+
+            bool empty() const { return channel_ids.size() <= 1 && client_ids.size() <= 1; }
+            bool operator==(const Plan& other) const { return channel_ids == other.channel_ids && client_ids == other.client_ids; }
+        };
+        /*
+        * Sends the plan, was_empty tells if the previous plan sent was empty or there was none.
+        * Returns false if sending failed, the next change sends the full plan again.
+        */
+        using Send = std::function<bool(uint64 connection_id, const Plan& plan, bool was_empty)>;
+
+        Whisper_Updater(std::chrono::milliseconds window, Send send);
+        ~Whisper_Updater();
+
+        /*
+        * Any thread. Starts over on the connection with the visible clients as (client, channel) pairs,
+        * the plan is always sent. Moves are only applied after this.
+        */
+        void reset(uint64 connection_id, anyID own_id, uint64 own_channel_id, const std::vector<std::pair<anyID, uint64>>& clients);
+        /* Any thread. Drops the plan and anything not sent yet, e.g. when disconnected. Moves are ignored until the next reset(). */
+        void clear();
+
+        /*
+        * Any thread. A client moved, 0 standing for a channel that isn't visible, see Whisper_Planner::move().
+        * Ignored unless the updater was reset() for the connection, the reset's client list includes it then.
+        */
+        void move(uint64 connection_id, anyID client_id, uint64 old_channel_id, uint64 new_channel_id);
+
+        struct Stats
+        {
+            uint64_t moves = 0;     // moves applied
+            uint64_t changes = 0;   // moves that changed the plan
+            uint64_t commands = 0;  // whisper lists sent
+            uint64_t channel_ids_sent = 0;
+            uint64_t client_ids_sent = 0;
+            uint64_t skipped = 0;   // windows that ended with the plan as last sent
+            Clock::duration total_latency{};  // from the first change of a window to its send
+            Clock::duration max_latency{};
+        };
+        Stats stats();
+
+    private:
+        void changed_locked();
+        void run();
+
+        const std::chrono::milliseconds _window;
+        const Send _send;
+
+        std::mutex _mutex;  // guards everything below
+        std::condition_variable _wakeup;
+        Whisper_Planner _planner;
+        Plan _sent;  // the plan last sent
+        bool _sent_valid = false;  // false before the first send and after a failed one
+        bool _pending = false;
+        Clock::time_point _window_start;
+        uint64 _connection_id = 0;  // of the last reset(), 0 if there is none or after clear()
+        Stats _stats;
+        bool _stopping = false;
+
+        std::thread _thread;
+    };
+}
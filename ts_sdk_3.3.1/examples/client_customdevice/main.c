@@ -30,6 +30,9 @@
 #endif
 
 #include "wave.h"
+#include "../common/pacer.h"
+#include "../common/resampler.h"
+#include "../common/silence_gate.h"
 
 /*The client lib works at 48Khz internally. 
   It is therefore advisable to use the same for your project */
@@ -228,8 +231,13 @@ int main(int argc, char** argv) {
     int    captureChannels;
     short* captureBuffer;
     int    captureBufferSamples;
+    struct Resampler* resampler;
+    short* convertedBuffer;
 
     int    audioPeriodCounter;
+    unsigned int duePeriods;
+    struct Pacer pacer;
+    struct SilenceGate gate;
     int    captureAudioOffset;
     int    capturePeriodSize;
 
@@ -259,6 +267,40 @@ int main(int argc, char** argv) {
     /* Read in the wave we are going to stream to the server */
     if (!readWave("welcome_to_teamspeak.wav", &captureFrequency, &captureChannels, &captureBuffer, &captureBufferSamples)) 
         return 1;
+
+    /* convert the wave to 48 kHz, so the client lib side runs at its native rate */
+    if (captureFrequency != PLAYBACK_FREQUENCY) {
+        int consumed = captureBufferSamples;
+        int capacity;
+        int converted;
+        int flushed = -1;
+
+        resampler = resamplerCreate(captureFrequency, captureChannels, PLAYBACK_FREQUENCY, captureChannels);
+        if (!resampler) {
+            printf("error: can not convert a %d Hz wave\n", captureFrequency);
+            return 1;
+        }
+        capacity = resamplerMaxOutput(resampler, captureBufferSamples + resamplerDelay(resampler));
+        convertedBuffer = (short*) malloc(capacity * sizeof(short) * captureChannels);
+        if (!convertedBuffer) {
+            printf("error: could not allocate memory for the converted wave\n");
+            return 1;
+        }
+        /* the output is sized for all of it and the flushed tail, so the whole wave is consumed in one call */
+        converted = resamplerProcess(resampler, captureBuffer, &consumed, convertedBuffer, capacity);
+        if (converted >= 0)
+            flushed = resamplerFlush(resampler, convertedBuffer + converted * captureChannels, capacity - converted);
+        resamplerDestroy(resampler);
+        if (flushed < 0) {
+            printf("error: could not allocate memory to convert the wave\n");
+            return 1;
+        }
+        captureBufferSamples = converted + flushed;
+
+        free(captureBuffer);
+        captureBuffer = convertedBuffer;
+        captureFrequency = PLAYBACK_FREQUENCY;
+    }
     
     /* allocate AUDIO_PROCESS_SECONDS seconds worth of PLAYBACK_FREQUENCY 16bit PLAYBACK_CHANNELS channels */
     playbackBuffer = (short*) malloc(AUDIO_PROCESS_SECONDS * PLAYBACK_FREQUENCY * sizeof(short) * PLAYBACK_CHANNELS);
@@ -278,7 +320,7 @@ int main(int argc, char** argv) {
         return 1;
     }
 
-    /* register a new custom sound device, that captures at read wave freq+channels and plays PLAYBACK_CHANNELS channels at PLAYBACK_FREQUENCY */
+    /* register a new custom sound device, that captures at read wave channels and both captures and plays at PLAYBACK_FREQUENCY */
     if ((error = ts3client_registerCustomDevice("customWaveDeviceId", "Nice displayable wave device name", captureFrequency, captureChannels, PLAYBACK_FREQUENCY, PLAYBACK_CHANNELS)) != ERROR_ok) {
         char* errormsg;
         if(ts3client_getErrorMessage(error, &errormsg) == ERROR_ok) {
@@ -341,33 +383,41 @@ int main(int argc, char** argv) {
 
     captureAudioOffset = 0;
     playbackAudioOffset = 0;
-    for(audioPeriodCounter = 0; audioPeriodCounter < 50*AUDIO_PROCESS_SECONDS; ++audioPeriodCounter){ /*50*20=1000*/
-        /* wait 20 ms */
-        SLEEP(20);
-
-        /* make sure we dont stream past the end of our wave sample */
-        if (captureAudioOffset + capturePeriodSize > captureBufferSamples)
-            captureAudioOffset = 0;
-
-        /* stream capture data to the client lib */
-        if((error = ts3client_processCustomCaptureData("customWaveDeviceId", captureBuffer + captureAudioOffset*captureChannels, capturePeriodSize)) != ERROR_ok){
-            printf("Failed to get stream capture data: %d\n", error);
-            return 1;
-        }
+    pacerInit(&pacer, 20);
+    silenceGateInit(&gate, SILENCE_GATE_OPEN_DB, SILENCE_GATE_CLOSE_DB, SILENCE_GATE_HANGOVER);
+    for(audioPeriodCounter = 0; audioPeriodCounter < 50*AUDIO_PROCESS_SECONDS; ){ /*50*20=1000*/
+        /* wait for the next 20 ms deadline. After a late wakeup several periods are due, process all of them to catch up */
+        duePeriods = pacerWait(&pacer);
+
+        for(; duePeriods > 0 && audioPeriodCounter < 50*AUDIO_PROCESS_SECONDS; --duePeriods, ++audioPeriodCounter){
+            /* make sure we dont stream past the end of our wave sample */
+            if (captureAudioOffset + capturePeriodSize > captureBufferSamples)
+                captureAudioOffset = 0;
+
+            /* stream capture data to the client lib, silent periods are skipped and cost no encoding */
+            if(silenceGateProcess(&gate, captureBuffer + captureAudioOffset*captureChannels, capturePeriodSize*captureChannels)){
+                if((error = ts3client_processCustomCaptureData("customWaveDeviceId", captureBuffer + captureAudioOffset*captureChannels, capturePeriodSize)) != ERROR_ok){
+                    printf("Failed to get stream capture data: %d\n", error);
+                    return 1;
+                }
+            }
 
-        /* get playback data from the client lib */
-        if((error = ts3client_acquireCustomPlaybackData("customWaveDeviceId", playbackBuffer + playbackAudioOffset*PLAYBACK_CHANNELS, playbackPeriodSize))!= ERROR_ok){
-            if(error != ERROR_sound_no_data) { //this error signals us to play silence
-                printf("Failed to get acquire playback data: %d\n", error);
-                return 1;
+            /* get playback data from the client lib */
+            if((error = ts3client_acquireCustomPlaybackData("customWaveDeviceId", playbackBuffer + playbackAudioOffset*PLAYBACK_CHANNELS, playbackPeriodSize))!= ERROR_ok){
+                if(error != ERROR_sound_no_data) { //this error signals us to play silence
+                    printf("Failed to get acquire playback data: %d\n", error);
+                    return 1;
+                }
+                memset(playbackBuffer + playbackAudioOffset * PLAYBACK_CHANNELS, 0, playbackPeriodSize*2);
             }
-            memset(playbackBuffer + playbackAudioOffset * PLAYBACK_CHANNELS, 0, playbackPeriodSize*2);
-        }
 
-        /*update buffer offsets */
-        captureAudioOffset += capturePeriodSize;
-        playbackAudioOffset += playbackPeriodSize; 
+            /*update buffer offsets */
+            captureAudioOffset += capturePeriodSize;
+            playbackAudioOffset += playbackPeriodSize;
+        }
     }
+    pacerPrintStats(&pacer, "audio");
+    silenceGatePrintStats(&gate, "capture");
 
     /* Disconnect from server */
     if((error = ts3client_stopConnection(scHandlerID, "leaving")) != ERROR_ok) {
@@ -4,4 +4,10 @@ set (TS_SAMPLE_SRC
     "${CMAKE_CURRENT_LIST_DIR}/main.c"
     "${CMAKE_CURRENT_LIST_DIR}/wave.c"
     "${CMAKE_CURRENT_LIST_DIR}/wave.h"
+    "${CMAKE_CURRENT_LIST_DIR}/../common/pacer.h"
+    "${CMAKE_CURRENT_LIST_DIR}/../common/pacer.c"
+    "${CMAKE_CURRENT_LIST_DIR}/../common/resampler.h"
+    "${CMAKE_CURRENT_LIST_DIR}/../common/resampler.c"
+    "${CMAKE_CURRENT_LIST_DIR}/../common/silence_gate.h"
+    "${CMAKE_CURRENT_LIST_DIR}/../common/silence_gate.c"
 )
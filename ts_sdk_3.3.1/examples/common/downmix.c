@@ -0,0 +1,357 @@
+#include <string.h>
+
+#include <teamspeak/public_definitions.h>
+
+#include "downmix.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define DOWNMIX_X86
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define TARGET_SSE41
+#define TARGET_AVX2
+#else
+/* compiled for these instruction sets regardless of the build flags, only called if the CPU has them */
+#define TARGET_SSE41 __attribute__((target("sse4.1")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+#define LEFT_SPEAKERS  (SPEAKER_FRONT_LEFT  | SPEAKER_FRONT_CENTER | SPEAKER_BACK_LEFT  | SPEAKER_FRONT_LEFT_OF_CENTER  | SPEAKER_BACK_CENTER | SPEAKER_SIDE_LEFT  | SPEAKER_TOP_CENTER | SPEAKER_TOP_FRONT_LEFT  | SPEAKER_TOP_FRONT_CENTER | SPEAKER_TOP_BACK_LEFT  | SPEAKER_TOP_BACK_CENTER)
+#define RIGHT_SPEAKERS (SPEAKER_FRONT_RIGHT | SPEAKER_FRONT_CENTER | SPEAKER_BACK_RIGHT | SPEAKER_FRONT_RIGHT_OF_CENTER | SPEAKER_BACK_CENTER | SPEAKER_SIDE_RIGHT | SPEAKER_TOP_CENTER | SPEAKER_TOP_FRONT_RIGHT | SPEAKER_TOP_FRONT_CENTER | SPEAKER_TOP_BACK_RIGHT | SPEAKER_TOP_BACK_CENTER)
+
+/* the kernels load a frame as 8 samples, so they handle layouts up to this many channels */
+#define SIMD_MAX_CHANNELS 8
+
+#define ROUNDING (1 << (DOWNMIX_COEFFICIENT_BITS - 1))
+
+static short saturate(int sum) {
+    sum = (sum + ROUNDING) >> DOWNMIX_COEFFICIENT_BITS;
+    return (short)(sum > 32767 ? 32767 : sum < -32768 ? -32768 : sum);
+}
+
+/*
+ * Sums only the channels picked by downmixConfigure, then scales each sum by the coefficient the
+ * channels of that output share. Built into a kernel per common channel count, there channels is
+ * a constant the loops are bounded by, which lets the compiler unroll them.
+ */
+static void mixScalar(const struct Downmix* downmix, const short* in, int frames, short* out, const int channels) {
+    const int outChannels = downmix->outChannels;
+    const int leftCount = downmix->sourceCounts[0];
+    const int rightCount = downmix->sourceCounts[1];
+    const int leftCoefficient = downmix->sourceCoefficients[0];
+    const int rightCoefficient = downmix->sourceCoefficients[1];
+    /* local copies, the stores to out could alias the ones in downmix */
+    int left[DOWNMIX_MAX_CHANNELS], right[DOWNMIX_MAX_CHANNELS];
+    int leftSum, rightSum;
+    int frame;
+    int i;
+
+    for (i = 0; i < channels && i < leftCount; ++i)
+        left[i] = downmix->sources[0][i];
+    for (i = 0; i < channels && i < rightCount; ++i)
+        right[i] = downmix->sources[1][i];
+
+    if (outChannels == 1) {
+        for (frame = 0; frame < frames; ++frame, in += channels) {
+            leftSum = 0;
+            for (i = 0; i < channels && i < leftCount; ++i)
+                leftSum += in[left[i]];
+            out[frame] = saturate(leftSum * leftCoefficient);
+        }
+        return;
+    }
+
+    for (frame = 0; frame < frames; ++frame, in += channels, out += 2) {
+        leftSum = 0;
+        for (i = 0; i < channels && i < leftCount; ++i)
+            leftSum += in[left[i]];
+        rightSum = 0;
+        for (i = 0; i < channels && i < rightCount; ++i)
+            rightSum += in[right[i]];
+        /* both sums before any store, out may overlap this frame */
+        out[0] = saturate(leftSum * leftCoefficient);
+        out[1] = saturate(rightSum * rightCoefficient);
+    }
+}
+
+static void kernelScalar(const struct Downmix* downmix, const short* in, int frames, short* out) {
+    mixScalar(downmix, in, frames, out, downmix->channels);
+}
+
+static void kernelScalar4(const struct Downmix* downmix, const short* in, int frames, short* out) {
+    mixScalar(downmix, in, frames, out, 4);
+}
+
+static void kernelScalar6(const struct Downmix* downmix, const short* in, int frames, short* out) {
+    mixScalar(downmix, in, frames, out, 6);
+}
+
+static void kernelScalar8(const struct Downmix* downmix, const short* in, int frames, short* out) {
+    mixScalar(downmix, in, frames, out, 8);
+}
+
+/* quad, 5.1 and 7.1 have a scalar kernel of their own */
+static DownmixKernel scalarKernel(int channels) {
+    switch (channels) {
+    case 4:
+        return kernelScalar4;
+    case 6:
+        return kernelScalar6;
+    case 8:
+        return kernelScalar8;
+    }
+    return kernelScalar;
+}
+
+#ifdef DOWNMIX_X86
+/*
+ * The kernels multiply a frame with a coefficient row and add neighbouring products in one
+ * pmaddwd, then add those up across frames with horizontal adds until a register holds finished
+ * sums in output order. Each frame is loaded as 8 samples whatever the layout, samples past its
+ * channels belong to the next frame and meet zero coefficients. The last frames are left to the
+ * scalar kernel, so no load reads past the input. All loads of a block come before its store,
+ * which keeps in place mixing working.
+ */
+
+TARGET_SSE41 static __m128i scale128(__m128i sums) {
+    return _mm_srai_epi32(_mm_add_epi32(sums, _mm_set1_epi32(ROUNDING)), DOWNMIX_COEFFICIENT_BITS);
+}
+
+TARGET_SSE41 static void kernelStereoSse41(const struct Downmix* downmix, const short* in, int frames, short* out) {
+    const int channels = downmix->channels;
+    const __m128i left = _mm_loadu_si128((const __m128i*)downmix->coefficients[0]);
+    const __m128i right = _mm_loadu_si128((const __m128i*)downmix->coefficients[1]);
+    __m128i f0, f1, f2, f3;
+    int frame = 0;
+
+    for (; (frame + 3) * channels + SIMD_MAX_CHANNELS <= frames * channels; frame += 4, in += 4 * channels, out += 8) {
+        f0 = _mm_loadu_si128((const __m128i*)in);
+        f1 = _mm_loadu_si128((const __m128i*)(in + channels));
+        f2 = _mm_loadu_si128((const __m128i*)(in + 2 * channels));
+        f3 = _mm_loadu_si128((const __m128i*)(in + 3 * channels));
+
+        /* per frame partial sums l l r r, then l0 r0 l1 r1 */
+        f0 = _mm_hadd_epi32(_mm_madd_epi16(f0, left), _mm_madd_epi16(f0, right));
+        f1 = _mm_hadd_epi32(_mm_madd_epi16(f1, left), _mm_madd_epi16(f1, right));
+        f2 = _mm_hadd_epi32(_mm_madd_epi16(f2, left), _mm_madd_epi16(f2, right));
+        f3 = _mm_hadd_epi32(_mm_madd_epi16(f3, left), _mm_madd_epi16(f3, right));
+        f0 = scale128(_mm_hadd_epi32(f0, f1));
+        f2 = scale128(_mm_hadd_epi32(f2, f3));
+
+        _mm_storeu_si128((__m128i*)out, _mm_packs_epi32(f0, f2));
+    }
+    kernelScalar(downmix, in, frames - frame, out);
+}
+
+TARGET_SSE41 static __m128i mono4Sse41(const short* in, int channels, __m128i mono) {
+    __m128i f0 = _mm_madd_epi16(_mm_loadu_si128((const __m128i*)in), mono);
+    __m128i f1 = _mm_madd_epi16(_mm_loadu_si128((const __m128i*)(in + channels)), mono);
+    __m128i f2 = _mm_madd_epi16(_mm_loadu_si128((const __m128i*)(in + 2 * channels)), mono);
+    __m128i f3 = _mm_madd_epi16(_mm_loadu_si128((const __m128i*)(in + 3 * channels)), mono);
+
+    return scale128(_mm_hadd_epi32(_mm_hadd_epi32(f0, f1), _mm_hadd_epi32(f2, f3)));
+}
+
+TARGET_SSE41 static void kernelMonoSse41(const struct Downmix* downmix, const short* in, int frames, short* out) {
+    const int channels = downmix->channels;
+    const __m128i mono = _mm_loadu_si128((const __m128i*)downmix->coefficients[0]);
+    __m128i low, high;
+    int frame = 0;
+
+    for (; (frame + 7) * channels + SIMD_MAX_CHANNELS <= frames * channels; frame += 8, in += 8 * channels, out += 8) {
+        low = mono4Sse41(in, channels, mono);
+        high = mono4Sse41(in + 4 * channels, channels, mono);
+        _mm_storeu_si128((__m128i*)out, _mm_packs_epi32(low, high));
+    }
+    kernelScalar(downmix, in, frames - frame, out);
+}
+
+/* frames at in and in + 4 * channels in the low and high lane, the lanes stay apart until the store */
+TARGET_AVX2 static __m256i load2(const short* in, int channels) {
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)in)), _mm_loadu_si128((const __m128i*)(in + 4 * channels)), 1);
+}
+
+TARGET_AVX2 static __m256i scale256(__m256i sums) {
+    return _mm256_srai_epi32(_mm256_add_epi32(sums, _mm256_set1_epi32(ROUNDING)), DOWNMIX_COEFFICIENT_BITS);
+}
+
+TARGET_AVX2 static void kernelStereoAvx2(const struct Downmix* downmix, const short* in, int frames, short* out) {
+    const int channels = downmix->channels;
+    const __m256i left = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)downmix->coefficients[0]));
+    const __m256i right = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)downmix->coefficients[1]));
+    __m256i f0, f1, f2, f3;
+    int frame = 0;
+
+    for (; (frame + 7) * channels + SIMD_MAX_CHANNELS <= frames * channels; frame += 8, in += 8 * channels, out += 16) {
+        /* frames 0|4, 1|5, 2|6, 3|7 */
+        f0 = load2(in, channels);
+        f1 = load2(in + channels, channels);
+        f2 = load2(in + 2 * channels, channels);
+        f3 = load2(in + 3 * channels, channels);
+
+        f0 = _mm256_hadd_epi32(_mm256_madd_epi16(f0, left), _mm256_madd_epi16(f0, right));
+        f1 = _mm256_hadd_epi32(_mm256_madd_epi16(f1, left), _mm256_madd_epi16(f1, right));
+        f2 = _mm256_hadd_epi32(_mm256_madd_epi16(f2, left), _mm256_madd_epi16(f2, right));
+        f3 = _mm256_hadd_epi32(_mm256_madd_epi16(f3, left), _mm256_madd_epi16(f3, right));
+        f0 = scale256(_mm256_hadd_epi32(f0, f1)); /* l0 r0 l1 r1 | l4 r4 l5 r5 */
+        f2 = scale256(_mm256_hadd_epi32(f2, f3)); /* l2 r2 l3 r3 | l6 r6 l7 r7 */
+
+        _mm256_storeu_si256((__m256i*)out, _mm256_packs_epi32(f0, f2));
+    }
+    kernelScalar(downmix, in, frames - frame, out);
+}
+
+TARGET_AVX2 static __m256i mono8Avx2(const short* in, int channels, __m256i mono) {
+    __m256i f0 = _mm256_madd_epi16(load2(in, channels), mono);
+    __m256i f1 = _mm256_madd_epi16(load2(in + channels, channels), mono);
+    __m256i f2 = _mm256_madd_epi16(load2(in + 2 * channels, channels), mono);
+    __m256i f3 = _mm256_madd_epi16(load2(in + 3 * channels, channels), mono);
+
+    /* m0 m1 m2 m3 | m4 m5 m6 m7 */
+    return scale256(_mm256_hadd_epi32(_mm256_hadd_epi32(f0, f1), _mm256_hadd_epi32(f2, f3)));
+}
+
+TARGET_AVX2 static void kernelMonoAvx2(const struct Downmix* downmix, const short* in, int frames, short* out) {
+    const int channels = downmix->channels;
+    const __m256i mono = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)downmix->coefficients[0]));
+    __m256i low, high;
+    int frame = 0;
+
+    for (; (frame + 15) * channels + SIMD_MAX_CHANNELS <= frames * channels; frame += 16, in += 16 * channels, out += 16) {
+        low = mono8Avx2(in, channels, mono);
+        high = mono8Avx2(in + 8 * channels, channels, mono);
+        /* the pack interleaves the lanes as 0-3 8-11 | 4-7 12-15, put the quarters back in order */
+        _mm256_storeu_si256((__m256i*)out, _mm256_permute4x64_epi64(_mm256_packs_epi32(low, high), 0xD8));
+    }
+    kernelScalar(downmix, in, frames - frame, out);
+}
+
+enum { CPU_UNKNOWN = 0, CPU_BASIC, CPU_SSE41, CPU_AVX2 };
+
+static int cpuLevel(void) {
+    /* detected once, racing threads would all store the same */
+    static int level = CPU_UNKNOWN;
+
+    if (level != CPU_UNKNOWN)
+        return level;
+#if defined(_MSC_VER) && !defined(__clang__)
+    {
+        int info[4];
+        int sse41, avx;
+
+        __cpuid(info, 1);
+        sse41 = (info[2] & (1 << 19)) != 0;
+        /* AVX needs the OS to save the ymm registers too */
+        avx = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 6) == 6;
+        __cpuidex(info, 7, 0);
+        level = avx && (info[1] & (1 << 5)) != 0 ? CPU_AVX2 : sse41 ? CPU_SSE41 : CPU_BASIC;
+    }
+#else
+    __builtin_cpu_init();
+    level = __builtin_cpu_supports("avx2") ? CPU_AVX2 : __builtin_cpu_supports("sse4.1") ? CPU_SSE41 : CPU_BASIC;
+#endif
+    return level;
+}
+#endif
+
+static DownmixKernel selectKernel(int channels, int outChannels) {
+#ifdef DOWNMIX_X86
+    if (channels <= SIMD_MAX_CHANNELS) {
+        switch (cpuLevel()) {
+        case CPU_AVX2:
+            return outChannels == 2 ? kernelStereoAvx2 : kernelMonoAvx2;
+        case CPU_SSE41:
+            return outChannels == 2 ? kernelStereoSse41 : kernelMonoSse41;
+        }
+    }
+#endif
+    return scalarKernel(channels);
+}
+
+void downmixInit(struct Downmix* downmix, int outChannels) {
+    memset(downmix, 0, sizeof(*downmix));
+    downmix->outChannels = outChannels == 1 ? 1 : 2;
+    downmix->kernel = kernelScalar;
+}
+
+void downmixConfigure(struct Downmix* downmix, int channels, const unsigned int* channelSpeakerArray, unsigned int channelFillMask) {
+    unsigned int sides[DOWNMIX_MAX_CHANNELS];
+    int counts[2] = { 0, 0 };
+    int channel;
+    int i;
+
+    if (channels == downmix->channels && channelFillMask == downmix->fillMask &&
+        memcmp(channelSpeakerArray, downmix->speakers, channels * sizeof(unsigned int)) == 0)
+        return;
+
+    downmix->channels = channels;
+    downmix->fillMask = channelFillMask;
+    memcpy(downmix->speakers, channelSpeakerArray, channels * sizeof(unsigned int));
+    ++downmix->layoutChanges;
+
+    /* bit 0 for the left or mono output, bit 1 for the right one. Channels without valid data are left out, their content is undefined. */
+    for (channel = 0; channel < channels; ++channel) {
+        sides[channel] = 0;
+        if ((channelFillMask & (1u << channel)) == 0)
+            continue;
+        if (downmix->outChannels == 1) {
+            if ((channelSpeakerArray[channel] & (LEFT_SPEAKERS | RIGHT_SPEAKERS)) != 0)
+                sides[channel] = 1;
+        } else {
+            if ((channelSpeakerArray[channel] & LEFT_SPEAKERS) != 0)
+                sides[channel] |= 1;
+            if ((channelSpeakerArray[channel] & RIGHT_SPEAKERS) != 0)
+                sides[channel] |= 2;
+        }
+        for (i = 0; i < 2; ++i)
+            counts[i] += (sides[channel] >> i) & 1;
+    }
+
+    memset(downmix->coefficients, 0, sizeof(downmix->coefficients));
+    for (i = 0; i < 2; ++i) {
+        downmix->sourceCounts[i] = 0;
+        downmix->sourceCoefficients[i] = counts[i] > 0 ? ((1 << DOWNMIX_COEFFICIENT_BITS) + counts[i] / 2) / counts[i] : 0;
+    }
+    for (channel = 0; channel < channels; ++channel) {
+        for (i = 0; i < 2; ++i) {
+            if ((sides[channel] >> i) & 1) {
+                downmix->coefficients[i][channel] = (short)downmix->sourceCoefficients[i];
+                downmix->sources[i][downmix->sourceCounts[i]++] = (unsigned char)channel;
+            }
+        }
+    }
+
+    downmix->kernel = selectKernel(channels, downmix->outChannels);
+}
+
+void downmixProcess(const struct Downmix* downmix, const short* in, int frames, short* out) {
+    if (frames > 0 && downmix->channels > 0)
+        downmix->kernel(downmix, in, frames, out);
+}
+
+const char* downmixKernelName(const struct Downmix* downmix) {
+#ifdef DOWNMIX_X86
+    if (downmix->kernel == kernelStereoAvx2 || downmix->kernel == kernelMonoAvx2)
+        return "avx2";
+    if (downmix->kernel == kernelStereoSse41 || downmix->kernel == kernelMonoSse41)
+        return "sse4.1";
+#endif
+    return "scalar";
+}
+
+int downmixKernels(const struct Downmix* downmix, DownmixKernel kernels[DOWNMIX_MAX_KERNELS]) {
+    int count = 0;
+
+    kernels[count++] = scalarKernel(downmix->channels);
+#ifdef DOWNMIX_X86
+    if (downmix->channels <= SIMD_MAX_CHANNELS) {
+        if (cpuLevel() >= CPU_SSE41)
+            kernels[count++] = downmix->outChannels == 2 ? kernelStereoSse41 : kernelMonoSse41;
+        if (cpuLevel() >= CPU_AVX2)
+            kernels[count++] = downmix->outChannels == 2 ? kernelStereoAvx2 : kernelMonoAvx2;
+    }
+#endif
+    return count;
+}
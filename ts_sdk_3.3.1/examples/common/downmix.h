@@ -0,0 +1,70 @@
+#ifndef DOWNMIX_H
+#define DOWNMIX_H
+
+/*
+ * Downmixes interleaved multi-channel voice data to stereo or mono.
+ *
+ * Takes the layout as the client lib passes it to onEditMixedPlaybackVoiceDataEvent and
+ * onEditPostProcessVoiceDataEvent. Each output channel is the average of the input channels that
+ * have valid data in channelFillMask and whose speaker belongs to that side, mono averages both
+ * sides. The averages are kept as a matrix of Q14 coefficients that is only rebuilt when the
+ * layout changes. Layouts up to 8 channels (quad, 5.1, 7.1) run on SSE4.1 or AVX2 kernels when
+ * the CPU has them, everything else on the scalar one. All of them round and saturate the same way,
+ * so the result doesn't depend on the kernel.
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* channelFillMask has one bit per channel */
+#define DOWNMIX_MAX_CHANNELS 32
+#define DOWNMIX_COEFFICIENT_BITS 14
+#define DOWNMIX_MAX_KERNELS 3
+
+struct Downmix;
+typedef void (*DownmixKernel)(const struct Downmix* downmix, const short* in, int frames, short* out);
+
+struct Downmix {
+    int outChannels;        /* 1 or 2 */
+
+    /* the layout the coefficients are for, channels is 0 before the first one */
+    int channels;
+    unsigned int fillMask;
+    unsigned int speakers[DOWNMIX_MAX_CHANNELS];
+
+    /* per output channel one coefficient per input channel, rows of at least 8 for the kernels */
+    short coefficients[2][DOWNMIX_MAX_CHANNELS];
+    /* for the scalar kernel: per output channel the input channels with a coefficient, and the one they share */
+    unsigned char sources[2][DOWNMIX_MAX_CHANNELS];
+    int sourceCounts[2];
+    int sourceCoefficients[2];
+    DownmixKernel kernel;
+
+    uint64_t layoutChanges;
+};
+
+void downmixInit(struct Downmix* downmix, int outChannels);
+
+/* Call before downmixProcess with the layout of the data, at most DOWNMIX_MAX_CHANNELS. Rebuilds the coefficients only if it changed. */
+void downmixConfigure(struct Downmix* downmix, int channels, const unsigned int* channelSpeakerArray, unsigned int channelFillMask);
+
+/* Mixes frames of the configured layout into outChannels interleaved channels. out may be the same buffer as in if there are no more output than input channels. */
+void downmixProcess(const struct Downmix* downmix, const short* in, int frames, short* out);
+
+/* Name of the kernel the configured layout runs on */
+const char* downmixKernelName(const struct Downmix* downmix);
+
+/*
+ * Every kernel the CPU can run the configured layout on, scalar first and the one downmixConfigure
+ * picked last. Returns their number. For comparing them, set the kernel member to one of them.
+ */
+int downmixKernels(const struct Downmix* downmix, DownmixKernel kernels[DOWNMIX_MAX_KERNELS]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DOWNMIX_H */
@@ -0,0 +1,131 @@
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#define _POSIX_C_SOURCE 200112L
+#include <errno.h>
+#include <time.h>
+#endif
+#include <stdio.h>
+#include <string.h>
+
+#include "pacer.h"
+
+static uint64_t monotonicNs(void) {
+#ifdef _WIN32
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+
+    if (frequency.QuadPart == 0)
+        QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)(counter.QuadPart / frequency.QuadPart) * 1000000000u +
+           (uint64_t)(counter.QuadPart % frequency.QuadPart) * 1000000000u / (uint64_t)frequency.QuadPart;
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+uint64_t pacerNowNs(void) {
+    return monotonicNs();
+}
+
+static void sleepUntil(uint64_t deadline) {
+#if defined(__linux__)
+    struct timespec ts;
+
+    ts.tv_sec = (time_t)(deadline / 1000000000u);
+    ts.tv_nsec = (long)(deadline % 1000000000u);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+        ;
+#else
+    /* no absolute sleep available, sleep the remaining time. The deadline stays absolute, so this doesn't drift either. */
+    uint64_t now = monotonicNs();
+
+    if (now >= deadline)
+        return;
+#ifdef _WIN32
+    Sleep((DWORD)((deadline - now + 999999u) / 1000000u));
+#else
+    {
+        struct timespec ts;
+
+        ts.tv_sec = (time_t)((deadline - now) / 1000000000u);
+        ts.tv_nsec = (long)((deadline - now) % 1000000000u);
+        while (nanosleep(&ts, &ts) == -1 && errno == EINTR)
+            ;
+    }
+#endif
+#endif
+}
+
+static void record(unsigned int* histogram, uint64_t ns) {
+    uint64_t us = ns / 1000u;
+    int bucket = 0;
+
+    while (bucket < PACER_HISTOGRAM_BUCKETS - 1 && us >= ((uint64_t)1 << bucket))
+        ++bucket;
+    ++histogram[bucket];
+}
+
+void pacerInit(struct Pacer* pacer, unsigned int periodMs) {
+    memset(pacer, 0, sizeof(*pacer));
+    pacer->periodNs = (uint64_t)periodMs * 1000000u;
+}
+
+unsigned int pacerWait(struct Pacer* pacer) {
+    uint64_t now = monotonicNs();
+    uint64_t due;
+
+    if (pacer->lastWakeup == 0) {
+        /* first period starts now */
+        pacer->deadline = now + pacer->periodNs;
+    } else {
+        record(pacer->workHistogram, now - pacer->lastWakeup);
+    }
+
+    sleepUntil(pacer->deadline);
+    now = monotonicNs();
+    pacer->lastWakeup = now;
+    record(pacer->jitterHistogram, now > pacer->deadline ? now - pacer->deadline : 0);
+
+    /* the deadline that woke us plus every one that passed while we slept or worked */
+    due = 1;
+    if (now > pacer->deadline)
+        due += (now - pacer->deadline) / pacer->periodNs;
+
+    if (due > PACER_MAX_CATCH_UP) {
+        /* too far behind, e.g. the process was suspended. Drop the backlog instead of bursting. */
+        pacer->skipped += due - 1;
+        due = 1;
+        pacer->deadline = now + pacer->periodNs;
+    } else {
+        pacer->deadline += due * pacer->periodNs;
+    }
+
+    pacer->periods += due;
+    return (unsigned int)due;
+}
+
+static void printHistogram(const unsigned int* histogram) {
+    int i;
+
+    for (i = 0; i < PACER_HISTOGRAM_BUCKETS; ++i) {
+        if (histogram[i] == 0)
+            continue;
+        if (i == PACER_HISTOGRAM_BUCKETS - 1)
+            printf("    >= %6u us: %u\n", 1u << (i - 1), histogram[i]);
+        else
+            printf("    <  %6u us: %u\n", 1u << i, histogram[i]);
+    }
+}
+
+void pacerPrintStats(const struct Pacer* pacer, const char* name) {
+    printf("%s: %llu periods, %llu skipped\n", name, (unsigned long long)pacer->periods, (unsigned long long)pacer->skipped);
+    printf("  wakeup jitter:\n");
+    printHistogram(pacer->jitterHistogram);
+    printf("  processing time per period:\n");
+    printHistogram(pacer->workHistogram);
+}
@@ -0,0 +1,50 @@
+#ifndef PACER_H
+#define PACER_H
+
+/*
+ * Paces audio periods against absolute deadlines.
+ *
+ * Sleeping a fixed time after the work of a period drifts by the processing time every period.
+ * The pacer instead advances a deadline by exactly one period each time and sleeps until it,
+ * so processing time and late wakeups don't accumulate. After a late wakeup it reports how many
+ * periods are due, so the caller can catch up.
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* histogram bucket i counts durations below 2^i microseconds, the last one everything above */
+#define PACER_HISTOGRAM_BUCKETS 16
+
+/* periods behind after which the pacer gives up catching up and restarts from now */
+#define PACER_MAX_CATCH_UP 5
+
+struct Pacer {
+    uint64_t periodNs;
+    uint64_t deadline;      /* monotonic time of the next period, in ns */
+    uint64_t lastWakeup;    /* 0 before the first wait */
+
+    uint64_t periods;       /* periods handed to the caller */
+    uint64_t skipped;       /* periods dropped because the pacer fell too far behind */
+    unsigned int jitterHistogram[PACER_HISTOGRAM_BUCKETS]; /* wakeup time minus deadline */
+    unsigned int workHistogram[PACER_HISTOGRAM_BUCKETS];   /* time between a wakeup and the next wait */
+};
+
+void pacerInit(struct Pacer* pacer, unsigned int periodMs);
+
+/* Waits for the next deadline and returns the number of periods due, normally 1 */
+unsigned int pacerWait(struct Pacer* pacer);
+
+void pacerPrintStats(const struct Pacer* pacer, const char* name);
+
+/* The monotonic clock the pacer runs on, in ns */
+uint64_t pacerNowNs(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PACER_H */
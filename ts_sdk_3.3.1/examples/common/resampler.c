@@ -0,0 +1,311 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RESAMPLER_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "resampler.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/* taps per phase when upsampling, scaled by the rate ratio when downsampling. A multiple of 4. */
+#define BASE_TAPS 32
+/* the filter passes this fraction of the lower Nyquist frequency */
+#define ROLLOFF 0.91
+/* Kaiser window, about 90 dB stopband attenuation */
+#define KAISER_BETA 9.0
+/* highest number of phases, i.e. numerator of the reduced rate ratio */
+#define MAX_PHASES 1024
+/* samples per channel buffered at most, larger input is converted in pieces */
+#define MAX_HISTORY 65536
+/* frames of silence resamplerFlush passes in one resamplerProcess call */
+#define FLUSH_FRAMES 64
+
+struct Resampler {
+    int inChannels;
+    int outChannels;
+    int up;          /* the rate ratio outRate/inRate reduced to up/down */
+    int down;
+    int taps;        /* per phase */
+    float* coefs;    /* up phases of taps coefficients, each in input order */
+
+    float* history[2];  /* per output channel: taps-1 samples of history followed by pending input */
+    int historyCapacity;
+    int historyLength;
+    int position;    /* first history sample of the next output's window, may lie beyond the history */
+    int phase;
+};
+
+static int gcd(int a, int b) {
+    while (b != 0) {
+        int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/* zeroth order modified Bessel function of the first kind */
+static double besselI0(double x) {
+    double sum = 1.0;
+    double term = 1.0;
+    int k;
+
+    for (k = 1; k < 50; ++k) {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+        if (term < sum * 1e-12)
+            break;
+    }
+    return sum;
+}
+
+/*
+ * Designs the prototype low pass at up times the input rate and splits it into up phases.
+ * Output sample n uses phase (n*down) % up against the input samples ending at (n*down) / up.
+ */
+static int designFilter(struct Resampler* r) {
+    int length = r->up * r->taps;
+    double center = (length - 1) / 2.0;
+    double cutoff = ROLLOFF * 0.5 / (r->up > r->down ? r->up : r->down); /* cycles per prototype sample */
+    double norm = 1.0 / besselI0(KAISER_BETA);
+    int p, k;
+
+    r->coefs = (float*)malloc(sizeof(float) * length);
+    if (!r->coefs)
+        return 0;
+
+    for (p = 0; p < r->up; ++p) {
+        for (k = 0; k < r->taps; ++k) {
+            /* tap k of phase p weighs input sample i-k, stored reversed so the inner loop runs forward */
+            double t = (p + k * r->up) - center;
+            double x = 2.0 * cutoff * t;
+            double sinc = fabs(x) < 1e-9 ? 1.0 : sin(M_PI * x) / (M_PI * x);
+            double w = 2.0 * (p + k * r->up) / (length - 1) - 1.0;
+            double window = besselI0(KAISER_BETA * sqrt(w * w < 1.0 ? 1.0 - w * w : 0.0)) * norm;
+            r->coefs[p * r->taps + (r->taps - 1 - k)] = (float)(2.0 * cutoff * r->up * sinc * window);
+        }
+    }
+    return 1;
+}
+
+struct Resampler* resamplerCreate(int inRate, int inChannels, int outRate, int outChannels) {
+    struct Resampler* r;
+    int divisor;
+    int ch;
+
+    if (inRate < RESAMPLER_MIN_RATE || inRate > RESAMPLER_MAX_RATE || outRate < RESAMPLER_MIN_RATE || outRate > RESAMPLER_MAX_RATE)
+        return NULL;
+    if ((inChannels != 1 && inChannels != 2 && inChannels != 6) || (outChannels != 1 && outChannels != 2))
+        return NULL;
+
+    divisor = gcd(inRate, outRate);
+    if (outRate / divisor > MAX_PHASES)
+        return NULL;
+
+    r = (struct Resampler*)calloc(1, sizeof(struct Resampler));
+    if (!r)
+        return NULL;
+
+    r->inChannels = inChannels;
+    r->outChannels = outChannels;
+    r->up = outRate / divisor;
+    r->down = inRate / divisor;
+    r->taps = BASE_TAPS;
+    if (r->down > r->up)
+        r->taps = ((BASE_TAPS * r->down / r->up) + 3) & ~3;
+
+    if (!designFilter(r)) {
+        resamplerDestroy(r);
+        return NULL;
+    }
+
+    r->historyCapacity = r->taps - 1 + 1024;
+    for (ch = 0; ch < outChannels; ++ch) {
+        r->history[ch] = (float*)calloc(r->historyCapacity, sizeof(float));
+        if (!r->history[ch]) {
+            resamplerDestroy(r);
+            return NULL;
+        }
+    }
+    r->historyLength = r->taps - 1; /* starts out with silence */
+    return r;
+}
+
+void resamplerDestroy(struct Resampler* r) {
+    if (!r)
+        return;
+    free(r->coefs);
+    free(r->history[0]);
+    free(r->history[1]);
+    free(r);
+}
+
+int resamplerMaxOutput(const struct Resampler* r, int inFrames) {
+    return (int)(((long long)(r->historyLength + inFrames) * r->up) / r->down) + 1;
+}
+
+/* appends input frames to the history, converted to the output layout */
+static void appendInput(struct Resampler* r, const short* in, int frames) {
+    float* left = r->history[0] + r->historyLength;
+    float* right = r->outChannels == 2 ? r->history[1] + r->historyLength : NULL;
+    const float s = 1.0f / 32768.0f;
+    /* 5.1: center and surrounds folded in at -3 dB, LFE dropped, scaled so a full scale signal can't clip */
+    const float c = 0.70710678f;
+    const float g = 1.0f / (1.0f + 2.0f * 0.70710678f);
+    int i;
+
+    for (i = 0; i < frames; ++i) {
+        const short* f = in + i * r->inChannels;
+        float l, rt;
+
+        switch (r->inChannels) {
+        case 1:
+            l = rt = f[0] * s;
+            break;
+        case 2:
+            l = f[0] * s;
+            rt = f[1] * s;
+            break;
+        default:
+            l = (f[0] + c * f[2] + c * f[4]) * s * g;
+            rt = (f[1] + c * f[2] + c * f[5]) * s * g;
+            break;
+        }
+
+        if (right) {
+            left[i] = l;
+            right[i] = rt;
+        } else {
+            left[i] = r->inChannels == 1 ? l : 0.5f * (l + rt);
+        }
+    }
+    r->historyLength += frames;
+}
+
+static float dot(const float* a, const float* b, int n) {
+#ifdef RESAMPLER_SSE2
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = _mm_setzero_ps();
+    float sums[4];
+    int i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(a + i + 4), _mm_loadu_ps(b + i + 4)));
+    }
+    for (; i < n; i += 4) /* n is a multiple of 4 */
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    _mm_storeu_ps(sums, _mm_add_ps(acc0, acc1));
+    return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+#else
+    /* four independent sums so the compiler can vectorize */
+    float s0 = 0.0f, s1 = 0.0f, s2 = 0.0f, s3 = 0.0f;
+    int i;
+
+    for (i = 0; i < n; i += 4) {
+        s0 += a[i] * b[i];
+        s1 += a[i + 1] * b[i + 1];
+        s2 += a[i + 2] * b[i + 2];
+        s3 += a[i + 3] * b[i + 3];
+    }
+    return (s0 + s1) + (s2 + s3);
+#endif
+}
+
+static short toSample(float v) {
+    v *= 32768.0f;
+    if (v >= 32767.0f)
+        return 32767;
+    if (v <= -32768.0f)
+        return -32768;
+    return (short)(v >= 0.0f ? v + 0.5f : v - 0.5f);
+}
+
+int resamplerProcess(struct Resampler* r, const short* in, int* inFrames, short* out, int outCapacity) {
+    int remaining = *inFrames;
+    int written = 0;
+    int ch;
+
+    for (;;) {
+        int chunk = remaining;
+
+        /* make room for the input, in pieces once the history reached its maximum size */
+        if (r->historyLength + chunk > r->historyCapacity) {
+            int capacity = r->historyLength + chunk;
+            if (capacity > MAX_HISTORY)
+                capacity = r->historyCapacity > MAX_HISTORY ? r->historyCapacity : MAX_HISTORY;
+            if (capacity > r->historyCapacity) {
+                for (ch = 0; ch < r->outChannels; ++ch) {
+                    float* grown = (float*)realloc(r->history[ch], sizeof(float) * capacity);
+                    if (!grown) {
+                        *inFrames -= remaining;
+                        return -1;
+                    }
+                    r->history[ch] = grown;
+                }
+                r->historyCapacity = capacity;
+            }
+            if (r->historyLength + chunk > capacity)
+                chunk = capacity - r->historyLength;
+        }
+        appendInput(r, in, chunk);
+        in += chunk * r->inChannels;
+        remaining -= chunk;
+
+        while (written < outCapacity && r->position + r->taps <= r->historyLength) {
+            const float* coefs = r->coefs + r->phase * r->taps;
+            for (ch = 0; ch < r->outChannels; ++ch)
+                out[written * r->outChannels + ch] = toSample(dot(coefs, r->history[ch] + r->position, r->taps));
+            ++written;
+
+            r->phase += r->down;
+            r->position += r->phase / r->up;
+            r->phase %= r->up;
+        }
+
+        /* drop the samples no output needs anymore */
+        if (r->position <= r->historyLength) {
+            for (ch = 0; ch < r->outChannels; ++ch)
+                memmove(r->history[ch], r->history[ch] + r->position, sizeof(float) * (r->historyLength - r->position));
+            r->historyLength -= r->position;
+            r->position = 0;
+        } else {
+            /* downsampling skipped past the input received so far */
+            r->position -= r->historyLength;
+            r->historyLength = 0;
+        }
+
+        /* input beyond the history cap that out has no room for is left to the caller */
+        if (remaining == 0 || written >= outCapacity) {
+            *inFrames -= remaining;
+            return written;
+        }
+    }
+}
+
+int resamplerDelay(const struct Resampler* r) {
+    return r->taps / 2;
+}
+
+int resamplerFlush(struct Resampler* r, short* out, int outCapacity) {
+    static const short silence[FLUSH_FRAMES * 6];
+    int remaining = resamplerDelay(r);
+    int written = 0;
+
+    while (remaining > 0 && written < outCapacity) {
+        int frames = remaining < FLUSH_FRAMES ? remaining : FLUSH_FRAMES;
+        int produced = resamplerProcess(r, silence, &frames, out + written * r->outChannels, outCapacity - written);
+
+        if (produced < 0)
+            return -1;
+        written += produced;
+        remaining -= frames;
+    }
+    return written;
+}
@@ -0,0 +1,53 @@
+#ifndef RESAMPLER_H
+#define RESAMPLER_H
+
+/*
+ * Sample rate and channel layout converter for 16 bit interleaved audio.
+ *
+ * Converts between rates of 8 to 96 kHz with a windowed sinc polyphase filter, and from
+ * mono, stereo or 5.1 (L R C LFE Ls Rs) to mono or stereo. Lets custom devices always run
+ * the client lib side at 48 kHz while the sound source or sink uses its own format.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RESAMPLER_MIN_RATE 8000
+#define RESAMPLER_MAX_RATE 96000
+
+struct Resampler;
+
+/* Returns NULL if the rates or channel counts aren't supported, or out of memory */
+struct Resampler* resamplerCreate(int inRate, int inChannels, int outRate, int outChannels);
+void resamplerDestroy(struct Resampler* resampler);
+
+/* Upper bound of the output frames resamplerProcess produces for inFrames input frames */
+int resamplerMaxOutput(const struct Resampler* resampler, int inFrames);
+
+/*
+ * Converts *inFrames interleaved input frames and writes up to outCapacity frames to out.
+ * Returns the number of frames written, or -1 if out of memory, and sets *inFrames to the input
+ * frames consumed. That is all of them unless out filled up first, the rest has to be passed
+ * again. Consumed input that doesn't produce output yet is kept for the next call, so a stream
+ * can be converted in blocks of any size. With outCapacity of resamplerMaxOutput all input is
+ * always consumed.
+ */
+int resamplerProcess(struct Resampler* resampler, const short* in, int* inFrames, short* out, int outCapacity);
+
+/* Input frames the output lags behind the input, the last ones only come out of resamplerFlush */
+int resamplerDelay(const struct Resampler* resampler);
+
+/*
+ * Ends the stream: converts resamplerDelay frames of silence so the output of the input passed so
+ * far comes out completely. Returns the frames written to out, or -1 if out of memory. Reserving
+ * resamplerMaxOutput(resampler, inFrames + resamplerDelay(resampler)) frames before the last
+ * resamplerProcess call leaves room for both.
+ */
+int resamplerFlush(struct Resampler* resampler, short* out, int outCapacity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RESAMPLER_H */
@@ -0,0 +1,117 @@
+#include <math.h>
+#include <stdio.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SILENCE_GATE_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "silence_gate.h"
+
+static double meanSquare(double db) {
+    double amplitude = 32768.0 * pow(10.0, db / 20.0);
+    return amplitude * amplitude;
+}
+
+void silenceGateInit(struct SilenceGate* gate, double openDb, double closeDb, int hangoverFrames) {
+    gate->openLevel = meanSquare(openDb);
+    gate->closeLevel = meanSquare(closeDb < openDb ? closeDb : openDb);
+    gate->hangoverFrames = hangoverFrames;
+    gate->hangoverLeft = 0;
+    gate->open = 0;
+
+    gate->frames = 0;
+    gate->gatedFrames = 0;
+    gate->opened = 0;
+    gate->gatedPeak = 0;
+}
+
+void silenceGateMeasure(const short* samples, int count, uint64_t* sumSquares, int* peak) {
+    uint64_t sum = 0;
+    int maximum = 0;
+    int i = 0;
+
+#ifdef SILENCE_GATE_SSE2
+    {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i sum64 = _mm_setzero_si128();
+        __m128i max16 = _mm_setzero_si128();
+        uint64_t sums[2];
+        short maxima[8];
+        int k;
+
+        for (; i + 8 <= count; i += 8) {
+            __m128i v = _mm_loadu_si128((const __m128i*)(samples + i));
+            /* pairwise sums of squares, at most 2^31, so exact when read as unsigned */
+            __m128i squares = _mm_madd_epi16(v, v);
+
+            sum64 = _mm_add_epi64(sum64, _mm_unpacklo_epi32(squares, zero));
+            sum64 = _mm_add_epi64(sum64, _mm_unpackhi_epi32(squares, zero));
+            /* saturating negation turns -32768 into 32767 */
+            max16 = _mm_max_epi16(max16, _mm_max_epi16(v, _mm_subs_epi16(zero, v)));
+        }
+
+        _mm_storeu_si128((__m128i*)sums, sum64);
+        _mm_storeu_si128((__m128i*)maxima, max16);
+        sum = sums[0] + sums[1];
+        for (k = 0; k < 8; ++k) {
+            if (maxima[k] > maximum)
+                maximum = maxima[k];
+        }
+    }
+#endif
+
+    for (; i < count; ++i) {
+        int s = samples[i];
+        int magnitude = s < 0 ? -s : s;
+
+        sum += (uint64_t)(s * s);
+        if (magnitude > maximum)
+            maximum = magnitude;
+    }
+
+    *sumSquares = sum;
+    *peak = maximum > 32767 ? 32767 : maximum;
+}
+
+int silenceGateProcess(struct SilenceGate* gate, const short* samples, int count) {
+    uint64_t sumSquares;
+    int peak;
+    double level;
+
+    silenceGateMeasure(samples, count, &sumSquares, &peak);
+    level = count > 0 ? (double)sumSquares / count : 0.0;
+    ++gate->frames;
+
+    if (level >= gate->openLevel) {
+        if (!gate->open)
+            ++gate->opened;
+        gate->open = 1;
+        gate->hangoverLeft = gate->hangoverFrames;
+    } else if (gate->open && level < gate->closeLevel) {
+        /* quiet, close once the hangover ran out */
+        if (gate->hangoverLeft > 0)
+            --gate->hangoverLeft;
+        else
+            gate->open = 0;
+    } else if (gate->open) {
+        /* between the thresholds: stay open and restart the hangover */
+        gate->hangoverLeft = gate->hangoverFrames;
+    }
+
+    if (!gate->open) {
+        ++gate->gatedFrames;
+        if (peak > gate->gatedPeak)
+            gate->gatedPeak = peak;
+    }
+    return gate->open;
+}
+
+void silenceGatePrintStats(const struct SilenceGate* gate, const char* name) {
+    double share = gate->frames ? 100.0 * gate->gatedFrames / gate->frames : 0.0;
+    double peakDb = gate->gatedPeak > 0 ? 20.0 * log10(gate->gatedPeak / 32768.0) : -96.0;
+
+    printf("%s: %llu of %llu frames gated as silence (%.1f%%), opened %llu times, loudest gated sample %.1f dBFS\n",
+           name, (unsigned long long)gate->gatedFrames, (unsigned long long)gate->frames, share,
+           (unsigned long long)gate->opened, peakDb);
+}
@@ -0,0 +1,51 @@
+#ifndef SILENCE_GATE_H
+#define SILENCE_GATE_H
+
+/*
+ * Energy based silence gate for capture frames.
+ *
+ * Measures the RMS level of each frame and closes when it stays below a threshold, so silent
+ * periods need not be handed to the client lib and encoded at all. The gate opens above
+ * openDb and only closes below the lower closeDb (hysteresis), and then only after
+ * hangoverFrames quiet frames in a row, so word endings and short pauses pass through.
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SILENCE_GATE_OPEN_DB  -50.0
+#define SILENCE_GATE_CLOSE_DB -56.0
+#define SILENCE_GATE_HANGOVER 15   /* frames, 300 ms of 20 ms frames */
+
+struct SilenceGate {
+    double openLevel;        /* thresholds as mean square of the samples */
+    double closeLevel;
+    int hangoverFrames;
+    int hangoverLeft;
+    int open;
+
+    uint64_t frames;
+    uint64_t gatedFrames;    /* frames the gate was closed for */
+    uint64_t opened;         /* times the gate opened */
+    int gatedPeak;           /* highest sample magnitude in a gated frame */
+};
+
+/* Levels are in dBFS, the gate starts out closed */
+void silenceGateInit(struct SilenceGate* gate, double openDb, double closeDb, int hangoverFrames);
+
+/* Measures count interleaved samples, returns 1 if the frame should be sent and 0 if it is gated */
+int silenceGateProcess(struct SilenceGate* gate, const short* samples, int count);
+
+/* Sum of the squared samples and the highest magnitude of count samples */
+void silenceGateMeasure(const short* samples, int count, uint64_t* sumSquares, int* peak);
+
+void silenceGatePrintStats(const struct SilenceGate* gate, const char* name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SILENCE_GATE_H */